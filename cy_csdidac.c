@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_csdidac.c
-* \version 2.10
+* \version 2.20
 *
 * \brief
 * This file provides the CSD HW block IDAC functionality implementation.
@@ -32,10 +32,50 @@
 * \addtogroup group_csdidac_internal
 * \{
 */
-static void Cy_CSDIDAC_ConnectChannelA(cy_stc_csdidac_context_t * context);
-static void Cy_CSDIDAC_ConnectChannelB(cy_stc_csdidac_context_t * context);
+static uint32_t Cy_CSDIDAC_ConnectPinA(bool configurePin, const cy_stc_csdidac_context_t * context);
+static uint32_t Cy_CSDIDAC_ConnectPinB(bool configurePin, const cy_stc_csdidac_context_t * context);
 static void Cy_CSDIDAC_DisconnectChannelA(cy_stc_csdidac_context_t * context);
 static void Cy_CSDIDAC_DisconnectChannelB(cy_stc_csdidac_context_t * context);
+static void Cy_CSDIDAC_DisconnectPinA(const cy_stc_csdidac_context_t * context);
+static void Cy_CSDIDAC_DisconnectPinB(const cy_stc_csdidac_context_t * context);
+#if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+    static uint32_t Cy_CSDIDAC_GetRequiredRoutes(
+                    uint32_t active,
+                    const cy_stc_csdidac_context_t * context);
+    static uint32_t Cy_CSDIDAC_GetRouteWrites(
+                    uint32_t routes,
+                    bool connect,
+                    const cy_stc_csdidac_context_t * context);
+    static void Cy_CSDIDAC_AutoRouteUpdate(cy_stc_csdidac_context_t * context);
+    static void Cy_CSDIDAC_AutoRouteEnable(
+                    uint32_t mask,
+                    bool isZero,
+                    cy_stc_csdidac_context_t * context);
+    static void Cy_CSDIDAC_AutoRouteRelease(
+                    uint32_t mask,
+                    cy_stc_csdidac_context_t * context);
+#endif
+#if (0u != CY_CSDIDAC_BACKEND_EN)
+    static cy_en_csd_status_t Cy_CSDIDAC_PdlCsdInit(void * param, CSD_Type * base, cy_stc_csd_config_t const * config,
+                                                    cy_en_csd_key_t key, cy_stc_csd_context_t * context);
+    static cy_en_csd_status_t Cy_CSDIDAC_PdlCsdDeInit(void * param, const CSD_Type * base, cy_en_csd_key_t key,
+                                                      cy_stc_csd_context_t * context);
+    static cy_en_csd_key_t Cy_CSDIDAC_PdlCsdGetLockStatus(void * param, const CSD_Type * base,
+                                                          const cy_stc_csd_context_t * context);
+    static cy_en_csd_status_t Cy_CSDIDAC_PdlCsdGetConversionStatus(void * param, const CSD_Type * base,
+                                                                   const cy_stc_csd_context_t * context);
+    static uint32_t Cy_CSDIDAC_PdlCsdReadReg(void * param, const CSD_Type * base, uint32_t offset);
+    static void Cy_CSDIDAC_PdlCsdWriteReg(void * param, CSD_Type * base, uint32_t offset, uint32_t value);
+    static void Cy_CSDIDAC_PdlCsdSetBits(void * param, CSD_Type * base, uint32_t offset, uint32_t mask);
+    static void Cy_CSDIDAC_PdlCsdClrBits(void * param, CSD_Type * base, uint32_t offset, uint32_t mask);
+    static void Cy_CSDIDAC_PdlGpioSetDrivemode(void * param, GPIO_PRT_Type * base, uint32_t pinNum, uint32_t value);
+    static uint32_t Cy_CSDIDAC_PdlGpioGetDrivemode(void * param, GPIO_PRT_Type * base, uint32_t pinNum);
+    static void Cy_CSDIDAC_PdlGpioSetHsiom(void * param, GPIO_PRT_Type * base, uint32_t pinNum, en_hsiom_sel_t value);
+    static en_hsiom_sel_t Cy_CSDIDAC_PdlGpioGetHsiom(void * param, GPIO_PRT_Type * base, uint32_t pinNum);
+    static void Cy_CSDIDAC_PdlDelayUs(void * param, uint16_t microseconds);
+    static uint32_t Cy_CSDIDAC_PdlEnterCriticalSection(void * param);
+    static void Cy_CSDIDAC_PdlExitCriticalSection(void * param, uint32_t savedIntrStatus);
+#endif
 /** \}
 * \endcond */
 
@@ -45,48 +85,9 @@ static void Cy_CSDIDAC_DisconnectChannelB(cy_stc_csdidac_context_t * context);
 *******************************************************************************/
 #define CY_CSDIDAC_FSM_ABORT                        (0x08u)
 
-/* IDAC configuration register */
-/* +--------+---------------+-------------------------------------------------------------------+
- * |  BITS  |   FIELD       |             DEFAULT MODE                                          |
- * |--------|---------------|-------------------------------------------------------------------|
- * | 6:0    | VAL           | 0x00(Sets the IDAC value to "0")                                  |
- * | 7      | POL_STATIC    | 0x00(Sets the static IDAC polarity)                               |
- * | 9:8    | POLARITY      | 0x00(IDAC polarity SOURCE)                                        |
- * | 11:10  | BAL_MODE      | 0x00(IDAC is enabled in PHI2 and disabled at the end of balancing)|
- * | 17:16  | LEG1_MODE     | 0x00(Configures LEG1 to GP_static mode)                           |
- * | 19:18  | LEG2_MODE     | 0x00(Configures LEG1 to GP_static mode)                           |
- * | 21     | DSI_CTRL_EN   | 0x00(The IDAC DSI control is disabled)                            |
- * | 23:22  | RANGE         | 0x00(Sets the range parameter value to low: 1LSB = 37.5 nA)       |
- * | 24     | LEG1_EN       | 0x00(The output for LEG1 is disabled)                             |
- * | 25     | LEG2_EN       | 0x00(The output for LEG2 is disabled)                             |
- * +--------+---------------+-------------------------------------------------------------------+*/
-#define CY_CSDIDAC_DEFAULT_CFG                      (0x01800000uL)
-#define CY_CSDIDAC_POLARITY_POS                     (8uL)
-#define CY_CSDIDAC_POLARITY_MASK                    (3uL << CY_CSDIDAC_POLARITY_POS)
-#define CY_CSDIDAC_LSB_POS                          (22uL)
-#define CY_CSDIDAC_LSB_MASK                         (3uL << CY_CSDIDAC_LSB_POS)
-#define CY_CSDIDAC_LEG1_EN_POS                      (24uL)
-#define CY_CSDIDAC_LEG1_EN_MASK                     (1uL << CY_CSDIDAC_LEG1_EN_POS)
-#define CY_CSDIDAC_LEG2_EN_POS                      (25uL)
-#define CY_CSDIDAC_LEG2_EN_MASK                     (1uL << CY_CSDIDAC_LEG2_EN_POS)
-#define CY_CSDIDAC_RANGE_MASK                       (CY_CSDIDAC_LSB_MASK | CY_CSDIDAC_LEG1_EN_MASK | CY_CSDIDAC_LEG2_EN_MASK)
-
-/*
-* All the defines below correspond to IDAC LSB in pA
-*/
-#define CY_CSDIDAC_LSB_37                           (  37500u)
-#define CY_CSDIDAC_LSB_75                           (  75000u)
-#define CY_CSDIDAC_LSB_300                          ( 300000u)
-#define CY_CSDIDAC_LSB_600                          ( 600000u)
-#define CY_CSDIDAC_LSB_2400                         (2400000u)
-#define CY_CSDIDAC_LSB_4800                         (4800000u)
-
-#define CY_CSDIDAC_LSB_37_MAX_CURRENT             (  4762500u)
-#define CY_CSDIDAC_LSB_75_MAX_CURRENT             (  9525000u)
-#define CY_CSDIDAC_LSB_300_MAX_CURRENT            ( 38100000u)
-#define CY_CSDIDAC_LSB_600_MAX_CURRENT            ( 76200000u)
-#define CY_CSDIDAC_LSB_2400_MAX_CURRENT           (304800000u)
-#define CY_CSDIDAC_LSB_4800_MAX_CURRENT           (609600000u)
+/* The channel masks of the automatic routing */
+#define CY_CSDIDAC_ROUTE_A_MSK                      (0x01u)
+#define CY_CSDIDAC_ROUTE_B_MSK                      (0x02u)
 
 #define CY_CSDIDAC_CODE_MASK                        (127u)
 #define CY_CSDIDAC_CONST_2                          (2u)
@@ -94,6 +95,16 @@ static void Cy_CSDIDAC_DisconnectChannelB(cy_stc_csdidac_context_t * context);
 #define CY_CSDIDAC_CONST_1000                       (1000u)
 #define CY_CSDIDAC_CONST_1000000                    (1000000u)
 
+/*
+* The division-free rounding of the pA current to the IDAC code. The doubled
+* LSB of any range is (9375 << (CY_CSDIDAC_PA_UNIT_SHIFT + range shift)) pA,
+* the division by 9375 is replaced by the multiplication by the reciprocal
+* ceil(2^42 / 9375), that is exact for all dividends below 2^28.
+*/
+#define CY_CSDIDAC_PA_UNIT_SHIFT                    (3u)
+#define CY_CSDIDAC_PA_RECIPROCAL                    (469124962uL)
+#define CY_CSDIDAC_PA_RECIPROCAL_SHIFT              (42u)
+
 /* CSD HW block CONFIG register definitions */
 #define CY_CSDIDAC_CSD_REG_CONFIG_INIT              (0x80001000uL)
 #define CY_CSDIDAC_CSD_REG_CONFIG_DEFAULT           (CY_CSDIDAC_CSD_REG_CONFIG_INIT)
@@ -117,7 +128,12 @@ static void Cy_CSDIDAC_DisconnectChannelB(cy_stc_csdidac_context_t * context);
 #define CY_CSDIDAC_SW_REFGEN_SEL_IBCB_ON            (0x00000010uL)
 #define CY_CSDIDAC_SW_REFGEN_SEL_IAIB_ON            (0x00000001uL)
 
-#define CY_CSDIDAC_CSD_CONFIG_DEFAULT  {\
+/*
+* The CSD HW block configuration captured by Cy_CSDIDAC_Restore(). Only the
+* SW_REFGEN_SEL register differs between the separated and joined IDACs, so
+* both configurations are kept in flash and selected by pointer.
+*/
+#define CY_CSDIDAC_CSD_CONFIG(swRefgen)  {\
     .config         = 0x80001000uL,\
     .spare          = 0x00000000uL,\
     .status         = 0x00000000uL,\
@@ -145,7 +161,7 @@ static void Cy_CSDIDAC_DisconnectChannelB(cy_stc_csdidac_context_t * context);
     .swBypSel       = 0x00000000uL,\
     .swCmpPosSel    = 0x00000000uL,\
     .swCmpNegSel    = 0x00000000uL,\
-    .swRefgenSel    = CY_CSDIDAC_SW_REFGEN_SEL_IBCB_ON,\
+    .swRefgenSel    = (swRefgen),\
     .swFwModSel     = 0x00000000uL,\
     .swFwTankSel    = 0x00000000uL,\
     .swDsiSel       = 0x00000000uL,\
@@ -160,6 +176,57 @@ static void Cy_CSDIDAC_DisconnectChannelB(cy_stc_csdidac_context_t * context);
     }
 
 
+/*******************************************************************************
+* Constant Tables
+*******************************************************************************/
+const uint32_t cy_csdidac_lsbPa[CY_CSDIDAC_LSB_NUM] =
+{
+    CY_CSDIDAC_LSB_37,
+    CY_CSDIDAC_LSB_75,
+    CY_CSDIDAC_LSB_300,
+    CY_CSDIDAC_LSB_600,
+    CY_CSDIDAC_LSB_2400,
+    CY_CSDIDAC_LSB_4800,
+};
+
+static const cy_stc_csd_config_t cy_csdidac_csdConfig =
+    CY_CSDIDAC_CSD_CONFIG(CY_CSDIDAC_SW_REFGEN_SEL_IBCB_ON);
+
+static const cy_stc_csd_config_t cy_csdidac_csdConfigJoin =
+    CY_CSDIDAC_CSD_CONFIG(CY_CSDIDAC_SW_REFGEN_SEL_IBCB_ON | CY_CSDIDAC_SW_REFGEN_SEL_IAIB_ON);
+
+const uint32_t cy_csdidac_lsbMaxCurrentPa[CY_CSDIDAC_LSB_NUM] =
+{
+    CY_CSDIDAC_LSB_37_MAX_CURRENT,
+    CY_CSDIDAC_LSB_75_MAX_CURRENT,
+    CY_CSDIDAC_LSB_300_MAX_CURRENT,
+    CY_CSDIDAC_LSB_600_MAX_CURRENT,
+    CY_CSDIDAC_LSB_2400_MAX_CURRENT,
+    CY_CSDIDAC_LSB_4800_MAX_CURRENT,
+};
+
+#if (0u != CY_CSDIDAC_BACKEND_EN)
+const cy_stc_csdidac_backend_t cy_csdidac_backendPdl =
+{
+    .csdInit                = &Cy_CSDIDAC_PdlCsdInit,
+    .csdDeInit              = &Cy_CSDIDAC_PdlCsdDeInit,
+    .csdGetLockStatus       = &Cy_CSDIDAC_PdlCsdGetLockStatus,
+    .csdGetConversionStatus = &Cy_CSDIDAC_PdlCsdGetConversionStatus,
+    .csdReadReg             = &Cy_CSDIDAC_PdlCsdReadReg,
+    .csdWriteReg            = &Cy_CSDIDAC_PdlCsdWriteReg,
+    .csdSetBits             = &Cy_CSDIDAC_PdlCsdSetBits,
+    .csdClrBits             = &Cy_CSDIDAC_PdlCsdClrBits,
+    .gpioSetDrivemode       = &Cy_CSDIDAC_PdlGpioSetDrivemode,
+    .gpioGetDrivemode       = &Cy_CSDIDAC_PdlGpioGetDrivemode,
+    .gpioSetHsiom           = &Cy_CSDIDAC_PdlGpioSetHsiom,
+    .gpioGetHsiom           = &Cy_CSDIDAC_PdlGpioGetHsiom,
+    .delayUs                = &Cy_CSDIDAC_PdlDelayUs,
+    .enterCriticalSection   = &Cy_CSDIDAC_PdlEnterCriticalSection,
+    .exitCriticalSection    = &Cy_CSDIDAC_PdlExitCriticalSection,
+};
+#endif
+
+
 /*******************************************************************************
 * Function Name: Cy_CSDIDAC_Init
 ****************************************************************************//**
@@ -213,6 +280,42 @@ static void Cy_CSDIDAC_DisconnectChannelB(cy_stc_csdidac_context_t * context);
 cy_en_csdidac_status_t Cy_CSDIDAC_Init(
                 const cy_stc_csdidac_config_t * config,
                 cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t result = Cy_CSDIDAC_Capture(config, context);
+
+    if (CY_CSDIDAC_SUCCESS == result)
+    {
+        /* Wakes up the CSD HW block. */
+        (void)Cy_CSDIDAC_Wakeup(context);
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_Capture
+****************************************************************************//**
+*
+* Performs the Cy_CSDIDAC_Init() function tasks except the CSD HW block
+* settling delay.
+*
+* The function allows capturing several CSD HW blocks back-to-back and
+* waiting for all of them to settle at once by Cy_CSDIDAC_Wakeup().
+*
+* \param config
+* The pointer to the configuration structure \ref cy_stc_csdidac_config_t.
+*
+* \param context
+* The pointer to the CSDIDAC context structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation, as Cy_CSDIDAC_Init().
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_Capture(
+                const cy_stc_csdidac_config_t * config,
+                cy_stc_csdidac_context_t * context)
 {
     cy_en_csdidac_status_t result = CY_CSDIDAC_BAD_PARAM;
 
@@ -222,6 +325,42 @@ cy_en_csdidac_status_t Cy_CSDIDAC_Init(
         {
             /* Copies the configuration structure to the context. */
             context->cfgCopy = *config;
+            #if (0u != CY_CSDIDAC_BACKEND_EN)
+                if (NULL == context->cfgCopy.ptrBackend)
+                {
+                    context->cfgCopy.ptrBackend = &cy_csdidac_backendPdl;
+                }
+            #endif
+            #if (0u != CY_CSDIDAC_MASKED_CYCLES_EN)
+                context->maxMaskedCycles = 0u;
+            #endif
+            #if (0u != CY_CSDIDAC_VERIFY_EN)
+                context->ptrVerifyCallback = NULL;
+                context->verifyParam = NULL;
+                context->verifyRatio = 0u;
+                context->verifyCount = 0u;
+                context->verifyStatus = CY_CSDIDAC_SUCCESS;
+                context->verifyNotifyStatus = CY_CSDIDAC_SUCCESS;
+                context->verifyNotifyCh = CY_CSDIDAC_A;
+            #endif
+            #if (0u != CY_CSDIDAC_CHARGE_EN)
+                context->chargeA.current = 0;
+                context->chargeA.isOn = false;
+                context->chargeB.current = 0;
+                context->chargeB.isOn = false;
+                (void)Cy_CSDIDAC_ResetCharge(CY_CSDIDAC_AB, context);
+            #endif
+            #if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+                context->autoRouteEn = false;
+                context->autoRouteIdleTicks = 0u;
+                context->autoRouteActive = 0u;
+                context->autoRouteZero = 0u;
+                context->autoRouteRouted = 0u;
+                context->idleCountA = 0u;
+                context->idleCountB = 0u;
+                context->routeWriteCount = 0u;
+                context->routeSavedCount = 0u;
+            #endif
             /* Captures the CSD HW block for the IDAC functionality. */
             result = Cy_CSDIDAC_Restore(context);
             if (CY_CSDIDAC_SUCCESS == result)
@@ -229,8 +368,6 @@ cy_en_csdidac_status_t Cy_CSDIDAC_Init(
                 /* Disconnects all CSDIDAC channels. */
                 Cy_CSDIDAC_DisconnectChannelA(context);
                 Cy_CSDIDAC_DisconnectChannelB(context);
-                /* Wakes up the CSD HW block. */
-                (void)Cy_CSDIDAC_Wakeup(context);
             }
         }
         else
@@ -327,22 +464,28 @@ cy_en_csdidac_status_t Cy_CSDIDAC_WriteConfig(
     {
         if(true == Cy_CSDIDAC_IsIdacConfigValid(config))
         {
-            if (CY_CSD_IDAC_KEY == Cy_CSD_GetLockStatus(context->cfgCopy.base, context->cfgCopy.csdCxtPtr))
+            if (CY_CSD_IDAC_KEY == CY_CSDIDAC_CSD_GET_LOCK_STATUS(context))
             {
                 if ((CY_CSDIDAC_DISABLE == context->channelStateA) && (CY_CSDIDAC_DISABLE == context->channelStateB))
                 {
                     /* Copies the configuration structure to the context. */
                     context->cfgCopy = *config;
+                    #if (0u != CY_CSDIDAC_BACKEND_EN)
+                        if (NULL == context->cfgCopy.ptrBackend)
+                        {
+                            context->cfgCopy.ptrBackend = &cy_csdidac_backendPdl;
+                        }
+                    #endif
 
                     /* Disconnects the IDACs from AMUX buses. */
-                    Cy_CSD_WriteReg(context->cfgCopy.base, CY_CSD_REG_OFFSET_SW_BYP_SEL, 0u);
+                    CY_CSDIDAC_CSD_WRITE_REG(context, CY_CSD_REG_OFFSET_SW_BYP_SEL, 0u);
 
                     /* Closes the IAIB switch if IDACs joined. */
                     if ((CY_CSDIDAC_JOIN == context->cfgCopy.configA) || (CY_CSDIDAC_JOIN == context->cfgCopy.configB))
                     {
                         tmpRegValue |= CY_CSDIDAC_SW_REFGEN_SEL_IAIB_ON;
                     }
-                    Cy_CSD_WriteReg(context->cfgCopy.base, CY_CSD_REG_OFFSET_SW_REFGEN_SEL, tmpRegValue);
+                    CY_CSDIDAC_CSD_WRITE_REG(context, CY_CSD_REG_OFFSET_SW_REFGEN_SEL, tmpRegValue);
                     result = CY_CSDIDAC_SUCCESS;
                 }
                 else
@@ -391,7 +534,7 @@ cy_en_csdidac_status_t Cy_CSDIDAC_Wakeup(const cy_stc_csdidac_context_t * contex
 
     if (NULL != context)
     {
-        Cy_SysLib_DelayUs((uint16_t)context->cfgCopy.csdInitTime);
+        CY_CSDIDAC_DELAY_US(context, (uint16_t)context->cfgCopy.csdInitTime);
         result = CY_CSDIDAC_SUCCESS;
     }
 
@@ -452,7 +595,7 @@ cy_en_syspm_status_t Cy_CSDIDAC_DeepSleepCallback(
 
     if (CY_SYSPM_CHECK_READY == mode)
     { /* Actions before entering CPU / System Deep Sleep */
-        if ((CY_CSD_IDAC_KEY == Cy_CSD_GetLockStatus(csdIdacCxt->cfgCopy.base, csdIdacCxt->cfgCopy.csdCxtPtr)) &&
+        if ((CY_CSD_IDAC_KEY == CY_CSDIDAC_CSD_GET_LOCK_STATUS(csdIdacCxt)) &&
            ((CY_CSDIDAC_ENABLE == csdIdacCxt->channelStateA) || (CY_CSDIDAC_ENABLE == csdIdacCxt->channelStateB)))
         {
             retVal = CY_SYSPM_FAIL;
@@ -503,14 +646,14 @@ cy_en_csdidac_status_t Cy_CSDIDAC_Save(cy_stc_csdidac_context_t * context)
 
     if (NULL != context)
     {
-        if (CY_CSD_IDAC_KEY == Cy_CSD_GetLockStatus(context->cfgCopy.base, context->cfgCopy.csdCxtPtr))
+        if (CY_CSD_IDAC_KEY == CY_CSDIDAC_CSD_GET_LOCK_STATUS(context))
         {
             /* Disconnects the output channels pins from analog buses. */
             Cy_CSDIDAC_DisconnectChannelA(context);
             Cy_CSDIDAC_DisconnectChannelB(context);
 
             /* Releases the HW CSD block. */
-            initStatus = Cy_CSD_DeInit(context->cfgCopy.base, CY_CSD_IDAC_KEY, context->cfgCopy.csdCxtPtr);
+            initStatus = CY_CSDIDAC_CSD_DEINIT(context, CY_CSD_IDAC_KEY);
 
             if (CY_CSD_SUCCESS == initStatus)
             {
@@ -570,9 +713,7 @@ cy_en_csdidac_status_t Cy_CSDIDAC_Restore(cy_stc_csdidac_context_t * context)
     cy_en_csdidac_status_t result = CY_CSDIDAC_HW_FAILURE;
     cy_en_csd_key_t mvKey;
     cy_en_csd_status_t initStatus = CY_CSD_LOCKED;
-    CSD_Type * ptrCsdBaseAdd = context->cfgCopy.base;
-    cy_stc_csd_context_t * ptrCsdCxt = context->cfgCopy.csdCxtPtr;
-    cy_stc_csd_config_t csdCfg = CY_CSDIDAC_CSD_CONFIG_DEFAULT;
+    const cy_stc_csd_config_t * ptrCsdCfg = &cy_csdidac_csdConfig;
 
     /* The number of cycles of one for() loop. */
     const uint32_t cyclesPerLoop = 5u;
@@ -584,21 +725,21 @@ cy_en_csdidac_status_t Cy_CSDIDAC_Restore(cy_stc_csdidac_context_t * context)
         /* Closes the IAIB switch if IDACs joined */
         if ((CY_CSDIDAC_JOIN == context->cfgCopy.configA) || (CY_CSDIDAC_JOIN == context->cfgCopy.configB))
         {
-            csdCfg.swRefgenSel |= CY_CSDIDAC_SW_REFGEN_SEL_IAIB_ON;
+            ptrCsdCfg = &cy_csdidac_csdConfigJoin;
         }
 
         /* Gets the CSD HW block status. */
-        mvKey = Cy_CSD_GetLockStatus(ptrCsdBaseAdd, ptrCsdCxt);
+        mvKey = CY_CSDIDAC_CSD_GET_LOCK_STATUS(context);
         if(CY_CSD_NONE_KEY == mvKey)
         {
-            Cy_CSD_WriteReg(ptrCsdBaseAdd, CY_CSD_REG_OFFSET_INTR_MASK, CY_CSDIDAC_CSD_INTR_MASK_CLEAR_MSK);
-            Cy_CSD_WriteReg(ptrCsdBaseAdd, CY_CSD_REG_OFFSET_SEQ_START, CY_CSDIDAC_FSM_ABORT);
+            CY_CSDIDAC_CSD_WRITE_REG(context, CY_CSD_REG_OFFSET_INTR_MASK, CY_CSDIDAC_CSD_INTR_MASK_CLEAR_MSK);
+            CY_CSDIDAC_CSD_WRITE_REG(context, CY_CSD_REG_OFFSET_SEQ_START, CY_CSDIDAC_FSM_ABORT);
 
             /* Initializes the Watchdog Counter to prevent a hang. */
             watchdogCounter = (watchdogTimeoutUs * (context->cfgCopy.cpuClk / CY_CSDIDAC_CONST_1000000)) / cyclesPerLoop;
             do
             {
-                initStatus = Cy_CSD_GetConversionStatus(ptrCsdBaseAdd, ptrCsdCxt);
+                initStatus = CY_CSDIDAC_CSD_GET_CONVERSION_STATUS(context);
                 watchdogCounter--;
             }
             while((CY_CSD_BUSY == initStatus) && (0u != watchdogCounter));
@@ -606,7 +747,7 @@ cy_en_csdidac_status_t Cy_CSDIDAC_Restore(cy_stc_csdidac_context_t * context)
             if (CY_CSD_SUCCESS == initStatus)
             {
                 /* Captures the CSD HW block for the IDAC functionality. */
-                initStatus = Cy_CSD_Init(ptrCsdBaseAdd, &csdCfg, CY_CSD_IDAC_KEY, ptrCsdCxt);
+                initStatus = CY_CSDIDAC_CSD_INIT(context, ptrCsdCfg, CY_CSD_IDAC_KEY);
 
                 if(CY_CSD_SUCCESS == initStatus)
                 {
@@ -675,7 +816,7 @@ cy_en_csdidac_status_t Cy_CSDIDAC_OutputEnable(
                 cy_stc_csdidac_context_t * context)
 {
     cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
-    cy_en_csdidac_polarity_t polarity= CY_CSDIDAC_SOURCE;
+    cy_en_csdidac_polarity_t polarity;
     cy_en_csdidac_lsb_t lsbIndex;
     uint32_t absCurrent = (0 > current) ? (uint32_t)(-current) : (uint32_t)current;
     uint32_t code;
@@ -684,48 +825,8 @@ cy_en_csdidac_status_t Cy_CSDIDAC_OutputEnable(
     {
         if(true == Cy_CSDIDAC_IsIdacChoiceValid(ch, context->cfgCopy.configA, context->cfgCopy.configB))
         {
-            /* Chooses the desired current polarity */
-            if (0 > current)
-            {
-                polarity = CY_CSDIDAC_SINK;
-            }
-            /* Converts absCurrent to pA */
-            absCurrent *= CY_CSDIDAC_CONST_1000;
-            /* Chooses IDAC LSB and calculates the IDAC code */
-            if (absCurrent < CY_CSDIDAC_LSB_37_MAX_CURRENT)
-            {
-                lsbIndex = CY_CSDIDAC_LSB_37_IDX;
-                code = absCurrent / CY_CSDIDAC_LSB_37;
-            }
-            else if (absCurrent < CY_CSDIDAC_LSB_75_MAX_CURRENT)
-            {
-                lsbIndex = CY_CSDIDAC_LSB_75_IDX;
-                code = absCurrent / CY_CSDIDAC_LSB_75;
-            }
-            else if (absCurrent < CY_CSDIDAC_LSB_300_MAX_CURRENT)
-            {
-                lsbIndex = CY_CSDIDAC_LSB_300_IDX;
-                code = absCurrent / CY_CSDIDAC_LSB_300;
-            }
-            else if (absCurrent < CY_CSDIDAC_LSB_600_MAX_CURRENT)
-            {
-                lsbIndex = CY_CSDIDAC_LSB_600_IDX;
-                code = absCurrent / CY_CSDIDAC_LSB_600;
-            }
-            else if(absCurrent < CY_CSDIDAC_LSB_2400_MAX_CURRENT)
-            {
-                lsbIndex = CY_CSDIDAC_LSB_2400_IDX;
-                code = absCurrent / CY_CSDIDAC_LSB_2400;
-            }
-            else
-            {
-                lsbIndex = CY_CSDIDAC_LSB_4800_IDX;
-                code = absCurrent / CY_CSDIDAC_LSB_4800;
-            }
-            if (code > CY_CSDIDAC_MAX_CODE)
-            {
-                code = CY_CSDIDAC_MAX_CODE;
-            }
+            /* Chooses the polarity, LSB and code of the desired current */
+            Cy_CSDIDAC_ConvertCurrent(current, &polarity, &lsbIndex, &code);
 
             /* Sets the desired IDAC(s) polarity, LSB and code in the CSD block and connects output(s). */
             retVal = Cy_CSDIDAC_OutputEnableExt(ch, polarity, lsbIndex, code, context);
@@ -736,6 +837,218 @@ cy_en_csdidac_status_t Cy_CSDIDAC_OutputEnable(
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ConvertCurrent
+****************************************************************************//**
+*
+* Identifies the polarity, LSB, and IDAC code required to generate
+* the specified output current.
+*
+* The minimum possible LSB is chosen to minimize the quantization error and
+* the code is rounded down as described for Cy_CSDIDAC_OutputEnable().
+* The function does not verify the input parameters.
+*
+* \param current
+* The current value in nA with a sign. The absolute value is in the range
+* from 0 to \ref CY_CSDIDAC_MAX_CURRENT_NA.
+*
+* \param polarity
+* The pointer to the resulting polarity.
+*
+* \param lsbIndex
+* The pointer to the resulting LSB.
+*
+* \param idacCode
+* The pointer to the resulting code.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_ConvertCurrent(
+                int32_t current,
+                cy_en_csdidac_polarity_t * polarity,
+                cy_en_csdidac_lsb_t * lsbIndex,
+                uint32_t * idacCode)
+{
+    uint32_t absCurrent = (0 > current) ? (uint32_t)(-current) : (uint32_t)current;
+    uint32_t code;
+
+    /* Chooses the desired current polarity */
+    *polarity = (0 > current) ? CY_CSDIDAC_SINK : CY_CSDIDAC_SOURCE;
+
+    /* Converts absCurrent to pA */
+    absCurrent *= CY_CSDIDAC_CONST_1000;
+    /* Chooses IDAC LSB and calculates the IDAC code */
+    if (absCurrent < CY_CSDIDAC_LSB_37_MAX_CURRENT)
+    {
+        *lsbIndex = CY_CSDIDAC_LSB_37_IDX;
+        code = absCurrent / CY_CSDIDAC_LSB_37;
+    }
+    else if (absCurrent < CY_CSDIDAC_LSB_75_MAX_CURRENT)
+    {
+        *lsbIndex = CY_CSDIDAC_LSB_75_IDX;
+        code = absCurrent / CY_CSDIDAC_LSB_75;
+    }
+    else if (absCurrent < CY_CSDIDAC_LSB_300_MAX_CURRENT)
+    {
+        *lsbIndex = CY_CSDIDAC_LSB_300_IDX;
+        code = absCurrent / CY_CSDIDAC_LSB_300;
+    }
+    else if (absCurrent < CY_CSDIDAC_LSB_600_MAX_CURRENT)
+    {
+        *lsbIndex = CY_CSDIDAC_LSB_600_IDX;
+        code = absCurrent / CY_CSDIDAC_LSB_600;
+    }
+    else if(absCurrent < CY_CSDIDAC_LSB_2400_MAX_CURRENT)
+    {
+        *lsbIndex = CY_CSDIDAC_LSB_2400_IDX;
+        code = absCurrent / CY_CSDIDAC_LSB_2400;
+    }
+    else
+    {
+        *lsbIndex = CY_CSDIDAC_LSB_4800_IDX;
+        code = absCurrent / CY_CSDIDAC_LSB_4800;
+    }
+    if (code > CY_CSDIDAC_MAX_CODE)
+    {
+        code = CY_CSDIDAC_MAX_CODE;
+    }
+    *idacCode = code;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_OutputEnablePa
+****************************************************************************//**
+*
+* Enables an IDAC output with the specified current in pA.
+*
+* The function operates as Cy_CSDIDAC_OutputEnable(), but the current is
+* specified in pA and the IDAC code is rounded to the nearest value as
+* described for Cy_CSDIDAC_ConvertCurrentPa(). The function allows all the
+* codes of the 37.5 nA LSB to be addressed precisely.
+*
+* \param ch
+* The CSDIDAC supports two outputs (A and B), this parameter
+* specifies the output to be enabled.
+*
+* \param current
+* A current value for an IDAC output in pA with a sign. If the parameter is
+* positive, a sourcing current is generated. If the parameter is
+* negative, the sinking current is generated. The absolute value of this
+* parameter is in the range from 0 to \ref CY_CSDIDAC_MAX_CURRENT_PA.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_OutputEnablePa(
+                cy_en_csdidac_choice_t ch,
+                int64_t current,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t code;
+
+    if(NULL != context)
+    {
+        if(true == Cy_CSDIDAC_IsIdacChoiceValid(ch, context->cfgCopy.configA, context->cfgCopy.configB))
+        {
+            /* Chooses the polarity, LSB and code of the desired current */
+            retVal = Cy_CSDIDAC_ConvertCurrentPa(current, &polarity, &lsbIndex, &code);
+            if (CY_CSDIDAC_SUCCESS == retVal)
+            {
+                /* Sets the desired IDAC(s) polarity, LSB and code in the CSD block and connects output(s). */
+                retVal = Cy_CSDIDAC_OutputEnableExt(ch, polarity, lsbIndex, code, context);
+            }
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ConvertCurrentPa
+****************************************************************************//**
+*
+* Identifies the polarity, LSB, and IDAC code required to generate
+* the specified output current in pA.
+*
+* The function chooses the minimum LSB, for which the rounded code does
+* not exceed \ref CY_CSDIDAC_MAX_CODE, and rounds the absolute value of
+* the current to the nearest multiple of this LSB. The halfway values are
+* rounded away from zero, so the sourcing and sinking currents of the same
+* absolute value get the same LSB and code. The conversion uses only
+* the integer multiplication and shift operations, so it is exact and
+* does not call the software division on the devices without the hardware
+* divider.
+*
+* \param current
+* The current value in pA with a sign. The absolute value is in the range
+* from 0 to \ref CY_CSDIDAC_MAX_CURRENT_PA.
+*
+* \param polarity
+* The pointer to the resulting polarity.
+*
+* \param lsbIndex
+* The pointer to the resulting LSB.
+*
+* \param idacCode
+* The pointer to the resulting code.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ConvertCurrentPa(
+                int64_t current,
+                cy_en_csdidac_polarity_t * polarity,
+                cy_en_csdidac_lsb_t * lsbIndex,
+                uint32_t * idacCode)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint64_t absCurrent = (0 > current) ? (0u - (uint64_t)current) : (uint64_t)current;
+    uint32_t lsb = (uint32_t)CY_CSDIDAC_LSB_37_IDX;
+    uint32_t value;
+
+    if((NULL != polarity) && (NULL != lsbIndex) && (NULL != idacCode) &&
+       (CY_CSDIDAC_MAX_CURRENT_PA >= absCurrent))
+    {
+        value = (uint32_t)absCurrent;
+
+        /* Chooses the minimum LSB, for which the rounded code does not exceed the maximum */
+        while ((lsb < (CY_CSDIDAC_LSB_NUM - 1u)) &&
+               (value >= (cy_csdidac_lsbMaxCurrentPa[lsb] + (cy_csdidac_lsbPa[lsb] >> 1u))))
+        {
+            lsb++;
+        }
+
+        /*
+        * Calculates code = (2 * value + LSB) / (2 * LSB). The LSB range shift
+        * is (lsb + lsb / 2): 0, 1, 3, 4, 6, 7 for 37.5 nA to 4.8 uA LSB.
+        */
+        value = ((value << 1u) + cy_csdidac_lsbPa[lsb]) >> (lsb + (lsb >> 1u) + CY_CSDIDAC_PA_UNIT_SHIFT);
+        *idacCode = (uint32_t)(((uint64_t)value * CY_CSDIDAC_PA_RECIPROCAL) >> CY_CSDIDAC_PA_RECIPROCAL_SHIFT);
+        *lsbIndex = (cy_en_csdidac_lsb_t)lsb;
+        *polarity = (0 > current) ? CY_CSDIDAC_SINK : CY_CSDIDAC_SOURCE;
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_CSDIDAC_OutputEnableExt
 ****************************************************************************//**
@@ -779,9 +1092,6 @@ cy_en_csdidac_status_t Cy_CSDIDAC_OutputEnableExt(
                 uint32_t idacCode,
                 cy_stc_csdidac_context_t * context)
 {
-    CSD_Type * ptrCsdBaseAdd = context->cfgCopy.base;
-    uint32_t idacRegValue;
-    uint32_t  interruptState;
     cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
 
     if((NULL != context) && (CY_CSDIDAC_MAX_CODE >= idacCode))
@@ -790,122 +1100,257 @@ cy_en_csdidac_status_t Cy_CSDIDAC_OutputEnableExt(
            (true == Cy_CSDIDAC_IsIdacPolarityValid(polarity)) &&
            (true == Cy_CSDIDAC_IsIdacLsbValid(lsbIndex)))
          {
-            idacRegValue = idacCode | (((uint32_t)polarity) << CY_CSDIDAC_POLARITY_POS);
-            /* Sets IDAC LSB. The LSB value equals lsbIndex divided by 2 */
-            idacRegValue |= ((((uint32_t)lsbIndex) >> 1uL) << CY_CSDIDAC_LSB_POS);
-            /* Sets the IDAC leg1 enabling bit */
-            idacRegValue |= ((uint32_t)CY_CSDIDAC_LEG1_EN_MASK);
-            /* Sets the IDAC leg2 enabling bit if the lsbIndex is even. */
-            if (0u != (lsbIndex % CY_CSDIDAC_CONST_2))
-            {
-                idacRegValue |= ((uint32_t)CY_CSDIDAC_LEG2_EN_MASK);
-            }
+            retVal = Cy_CSDIDAC_OutputEnableReg(outputCh, Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, idacCode),
+                                                true, context);
+        }
+    }
 
-            interruptState = Cy_SysLib_EnterCriticalSection();
-            if (((CY_CSDIDAC_A == outputCh) || (CY_CSDIDAC_AB == outputCh)) &&
-                (CY_CSDIDAC_DISABLED != context->cfgCopy.configA))
-            {
-                /* Sets the IDAC A polarity, LSB and code in the context structure. */
-                context->polarityA = polarity;
-                context->lsbA = lsbIndex;
-                context->codeA = (uint8_t)idacCode;
-                context->channelStateA = CY_CSDIDAC_ENABLE;
-                /* Connects the IDAC A output. */
-                Cy_CSDIDAC_ConnectChannelA(context);
-                /* A connected IDAC B output must be available if the IDAC A output is joined to it. */
-                if (CY_CSDIDAC_JOIN == context->cfgCopy.configA)
-                {
-                    Cy_CSDIDAC_ConnectChannelB(context);
-                }
-                Cy_CSD_WriteReg(ptrCsdBaseAdd, CY_CSD_REG_OFFSET_IDACA, idacRegValue);
+    return (retVal);
+}
 
-                retVal = CY_CSDIDAC_SUCCESS;
-            }
 
-            if (((CY_CSDIDAC_B == outputCh) || (CY_CSDIDAC_AB == outputCh)) &&
-                (CY_CSDIDAC_DISABLED != context->cfgCopy.configB))
-            {
-                /* Sets the IDAC B polarity, LSB and code in the context structure. */
-                context->polarityB = polarity;
-                context->lsbB = lsbIndex;
-                context->codeB = (uint8_t)idacCode;
-                context->channelStateB = CY_CSDIDAC_ENABLE;
-                /* Connects the IDAC B output. */
-                Cy_CSDIDAC_ConnectChannelB(context);
-                /* A connected IDAC A output must be available if the IDAC B output is joined to it */
-                if (CY_CSDIDAC_JOIN == context->cfgCopy.configB)
-                {
-                    Cy_CSDIDAC_ConnectChannelA(context);
-                }
-                Cy_CSD_WriteReg(ptrCsdBaseAdd, CY_CSD_REG_OFFSET_IDACB, idacRegValue);
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_OutputEnableReg
+****************************************************************************//**
+*
+* Enables an IDAC output with the precomputed IDAC register value.
+*
+* The function does not verify the input parameters. It closes the bypass
+* switches of the enabled channels, configures the output pins if
+* connectPins is true, and writes the IDAC register through
+* Cy_CSDIDAC_StoreIdacReg(), so the context structure stays coherent with
+* the output. The middleware modules, that route the channel to their own
+* pins, e.g. the pin scan, pass connectPins equal to false.
+*
+* The channel selection is done before interrupts are disabled. The pin
+* drive mode and HSIOM read-modify-writes, the bypass switches, and the IDAC
+* register writes are performed with interrupts disabled, so an interrupt
+* handler, that configures another pin of the same port, cannot lose
+* its update. The charge accounting, the automatic routing counters, and
+* the write verification are updated after interrupts are enabled again.
+*
+* \param outputCh
+* The output to be enabled: CY_CSDIDAC_A, CY_CSDIDAC_B, or CY_CSDIDAC_AB.
+*
+* \param idacRegValue
+* The IDAC register value composed by Cy_CSDIDAC_GetIdacRegValue().
+*
+* \param connectPins
+* Configures the channel pins of the CSDIDAC configuration if true.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - No enabled channel is specified.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_OutputEnableReg(
+                cy_en_csdidac_choice_t outputCh,
+                uint32_t idacRegValue,
+                bool connectPins,
+                cy_stc_csdidac_context_t * context)
+{
+    uint32_t bypassMask = 0u;
+    uint32_t  interruptState;
+    bool enableA;
+    bool enableB;
+    bool connectA;
+    bool connectB;
+    #if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+        bool autoRouteEn = context->autoRouteEn;
+        uint32_t routeMask = 0u;
+        uint32_t defaultWrites = 0u;
+        uint32_t routeWrites = 0u;
+    #endif
+    CY_CSDIDAC_MASKED_CYCLES_DECL
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
 
-                retVal = CY_CSDIDAC_SUCCESS;
-            }
-            Cy_SysLib_ExitCriticalSection(interruptState);
+    /* Chooses the channels to enable and to connect: a joined channel needs its partner output */
+    enableA = (((CY_CSDIDAC_A == outputCh) || (CY_CSDIDAC_AB == outputCh)) &&
+               (CY_CSDIDAC_DISABLED != context->cfgCopy.configA));
+    enableB = (((CY_CSDIDAC_B == outputCh) || (CY_CSDIDAC_AB == outputCh)) &&
+               (CY_CSDIDAC_DISABLED != context->cfgCopy.configB));
+    connectA = (enableA || (enableB && (CY_CSDIDAC_JOIN == context->cfgCopy.configB)));
+    connectB = (enableB || (enableA && (CY_CSDIDAC_JOIN == context->cfgCopy.configA)));
+    if (enableA || enableB)
+    {
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    #if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+        if (true == autoRouteEn)
+        {
+            /* The outputs are connected by the routing update of a nonzero code */
+            routeMask = ((true == enableA) ? CY_CSDIDAC_ROUTE_A_MSK : 0u) |
+                        ((true == enableB) ? CY_CSDIDAC_ROUTE_B_MSK : 0u);
+            defaultWrites = Cy_CSDIDAC_GetRouteWrites(((true == connectA) ? CY_CSDIDAC_ROUTE_A_MSK : 0u) |
+                                                      ((true == connectB) ? CY_CSDIDAC_ROUTE_B_MSK : 0u),
+                                                      true, context);
+            connectA = false;
+            connectB = false;
+        }
+    #endif
+
+    /*
+    * The port configuration registers are shared with the other pins of the port,
+    * so their read-modify-writes are performed with interrupts disabled as well.
+    * Only the pin, bypass switch, and IDAC register updates are performed in
+    * the critical section: the charge accounting, the routing counters, and
+    * the write verification follow it.
+    */
+    interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(context);
+    CY_CSDIDAC_MASKED_CYCLES_START
+    if (true == connectA)
+    {
+        bypassMask |= Cy_CSDIDAC_ConnectPinA(connectPins, context);
+    }
+    if (true == connectB)
+    {
+        bypassMask |= Cy_CSDIDAC_ConnectPinB(connectPins, context);
+    }
+    if (0u != bypassMask)
+    {
+        /* Closes the bypass switches to feed output current to AMuxBusA/AMuxBusB. */
+        CY_CSDIDAC_CSD_SET_BITS(context, CY_CSD_REG_OFFSET_SW_BYP_SEL, bypassMask);
+    }
+    #if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+        if (true == autoRouteEn)
+        {
+            routeWrites = context->routeWriteCount;
+            Cy_CSDIDAC_AutoRouteEnable(routeMask, (0u == (idacRegValue & CY_CSDIDAC_MAX_CODE)), context);
+            routeWrites = context->routeWriteCount - routeWrites;
         }
+    #endif
+    if (true == enableA)
+    {
+        context->channelStateA = CY_CSDIDAC_ENABLE;
+        Cy_CSDIDAC_StoreIdacReg(CY_CSDIDAC_A, idacRegValue, context);
+    }
+    if (true == enableB)
+    {
+        context->channelStateB = CY_CSDIDAC_ENABLE;
+        Cy_CSDIDAC_StoreIdacReg(CY_CSDIDAC_B, idacRegValue, context);
     }
+    CY_CSDIDAC_MASKED_CYCLES_STOP(context)
+    CY_CSDIDAC_EXIT_CRITICAL_SECTION(context, interruptState);
+
+    #if (0u != CY_CSDIDAC_CHARGE_EN)
+        if (true == enableA)
+        {
+            Cy_CSDIDAC_UpdateCharge(CY_CSDIDAC_A, idacRegValue, context);
+        }
+        if (true == enableB)
+        {
+            Cy_CSDIDAC_UpdateCharge(CY_CSDIDAC_B, idacRegValue, context);
+        }
+    #endif
+    #if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+        if ((true == autoRouteEn) && (defaultWrites > routeWrites))
+        {
+            context->routeSavedCount += defaultWrites - routeWrites;
+        }
+    #endif
+    #if (0u != CY_CSDIDAC_VERIFY_EN)
+        if (true == enableA)
+        {
+            Cy_CSDIDAC_VerifyIdacReg(CY_CSDIDAC_A, idacRegValue, context);
+        }
+        if (true == enableB)
+        {
+            Cy_CSDIDAC_VerifyIdacReg(CY_CSDIDAC_B, idacRegValue, context);
+        }
+        Cy_CSDIDAC_VerifyNotify(context);
+    #endif
 
     return (retVal);
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDIDAC_ConnectChannelA
+* Function Name: Cy_CSDIDAC_ConnectPinA
 ****************************************************************************//**
 *
-* Connects an IDAC A output as specified by the configuration.
+* Configures an IDAC A output pin as specified by the configuration and
+* returns the bypass switch to be closed to connect the IDAC A output.
+*
+* \param configurePin
+* Configures the output pin if true, otherwise only returns the bypass switch.
 *
 * \param context
 * The pointer to the CSDIDAC middleware context
 * structure \ref cy_stc_csdidac_context_t.
 *
+* \return
+* The SW_BYP_SEL register mask of the IDAC A bypass switch or zero.
+*
 *******************************************************************************/
-static void Cy_CSDIDAC_ConnectChannelA(
-                cy_stc_csdidac_context_t * context)
+static uint32_t Cy_CSDIDAC_ConnectPinA(
+                bool configurePin,
+                const cy_stc_csdidac_context_t * context)
 {
-    /* Closes the bypass A switch to feed output current to AMuxBusA. */
+    uint32_t bypassMask = 0u;
+
+    /* The bypass A switch feeds output current to AMuxBusA. */
     if ((CY_CSDIDAC_GPIO == context->cfgCopy.configA) ||  (CY_CSDIDAC_AMUX == context->cfgCopy.configA))
     {
-        Cy_CSD_SetBits(context->cfgCopy.base, CY_CSD_REG_OFFSET_SW_BYP_SEL, CY_CSDIDAC_SW_BYPA_ENABLE);
+        bypassMask = CY_CSDIDAC_SW_BYPA_ENABLE;
     }
     /* Configures port pin, if it is enabled. */
-    if ((CY_CSDIDAC_GPIO == context->cfgCopy.configA) && (NULL != context->cfgCopy.ptrPinA))
+    if ((true == configurePin) && (CY_CSDIDAC_GPIO == context->cfgCopy.configA) && (NULL != context->cfgCopy.ptrPinA))
     {
         /* Update port configuration register (drive mode) to High-Z Analog */
-        Cy_GPIO_SetDrivemode(context->cfgCopy.ptrPinA->ioPcPtr, (uint32_t)context->cfgCopy.ptrPinA->pin, CY_GPIO_DM_ANALOG);
+        CY_CSDIDAC_GPIO_SET_DRIVEMODE(context, context->cfgCopy.ptrPinA->ioPcPtr, (uint32_t)context->cfgCopy.ptrPinA->pin, CY_GPIO_DM_ANALOG);
         /* Connect the selected port to AMuxBusA */
-        Cy_GPIO_SetHSIOM(context->cfgCopy.ptrPinA->ioPcPtr, (uint32_t)context->cfgCopy.ptrPinA->pin, HSIOM_SEL_AMUXA);
+        CY_CSDIDAC_GPIO_SET_HSIOM(context, context->cfgCopy.ptrPinA->ioPcPtr, (uint32_t)context->cfgCopy.ptrPinA->pin, HSIOM_SEL_AMUXA);
     }
+
+    return (bypassMask);
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDIDAC_ConnectChannelB
+* Function Name: Cy_CSDIDAC_ConnectPinB
 ****************************************************************************//**
 *
-* Connects an IDAC B output as specified by the configuration.
+* Configures an IDAC B output pin as specified by the configuration and
+* returns the bypass switch to be closed to connect the IDAC B output.
+*
+* \param configurePin
+* Configures the output pin if true, otherwise only returns the bypass switch.
 *
 * \param context
 * The pointer to the CSDIDAC middleware context
 * structure \ref cy_stc_csdidac_context_t.
 *
+* \return
+* The SW_BYP_SEL register mask of the IDAC B bypass switch or zero.
+*
 *******************************************************************************/
-static void Cy_CSDIDAC_ConnectChannelB(
-                cy_stc_csdidac_context_t * context)
+static uint32_t Cy_CSDIDAC_ConnectPinB(
+                bool configurePin,
+                const cy_stc_csdidac_context_t * context)
 {
-    /* Closes the bypass B switch to feed an output current to AMuxBusB. */
+    uint32_t bypassMask = 0u;
+
+    /* The bypass B switch feeds an output current to AMuxBusB. */
     if ((CY_CSDIDAC_GPIO == context->cfgCopy.configB) ||  (CY_CSDIDAC_AMUX == context->cfgCopy.configB))
     {
-        Cy_CSD_SetBits(context->cfgCopy.base, CY_CSD_REG_OFFSET_SW_BYP_SEL, CY_CSDIDAC_SW_BYPB_ENABLE);
+        bypassMask = CY_CSDIDAC_SW_BYPB_ENABLE;
     }
     /* Configures port pin, if it is enabled. */
-    if (CY_CSDIDAC_GPIO == context->cfgCopy.configB)
+    if ((true == configurePin) && (CY_CSDIDAC_GPIO == context->cfgCopy.configB) && (NULL != context->cfgCopy.ptrPinB))
     {
         /* Update port configuration register (drive mode) to High-Z Analog */
-        Cy_GPIO_SetDrivemode(context->cfgCopy.ptrPinB->ioPcPtr, (uint32_t)context->cfgCopy.ptrPinB->pin, CY_GPIO_DM_ANALOG);
+        CY_CSDIDAC_GPIO_SET_DRIVEMODE(context, context->cfgCopy.ptrPinB->ioPcPtr, (uint32_t)context->cfgCopy.ptrPinB->pin, CY_GPIO_DM_ANALOG);
         /* Connect the selected port to AMuxBusB */
-        Cy_GPIO_SetHSIOM(context->cfgCopy.ptrPinB->ioPcPtr, (uint32_t)context->cfgCopy.ptrPinB->pin, HSIOM_SEL_AMUXB);
+        CY_CSDIDAC_GPIO_SET_HSIOM(context, context->cfgCopy.ptrPinB->ioPcPtr, (uint32_t)context->cfgCopy.ptrPinB->pin, HSIOM_SEL_AMUXB);
     }
+
+    return (bypassMask);
 }
 
 
@@ -924,16 +1369,45 @@ static void Cy_CSDIDAC_DisconnectChannelA(cy_stc_csdidac_context_t * context)
 {
     /* Disables the desired IDAC. */
     context->channelStateA = CY_CSDIDAC_DISABLE;
-    Cy_CSD_WriteReg(context->cfgCopy.base, CY_CSD_REG_OFFSET_IDACA, 0uL);
-    /* Opens the bypass A switch to disconnect an output current from AMuxBusA. */
+    Cy_CSDIDAC_WriteIdacReg(CY_CSDIDAC_A, 0u, context);
+    #if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+        if (true == context->autoRouteEn)
+        {
+            Cy_CSDIDAC_AutoRouteRelease(CY_CSDIDAC_ROUTE_A_MSK, context);
+        }
+        else
+        {
+            Cy_CSDIDAC_DisconnectPinA(context);
+        }
+    #else
+        Cy_CSDIDAC_DisconnectPinA(context);
+    #endif
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DisconnectPinA
+****************************************************************************//**
+*
+* Opens the bypass A switch and disconnects the output channel A pin,
+* if they are configured.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_DisconnectPinA(const cy_stc_csdidac_context_t * context)
+{
+    /* Opens the bypass A switch to disconnect an output current from AMuxBusA. */
     if ((CY_CSDIDAC_GPIO == context->cfgCopy.configA) ||  (CY_CSDIDAC_AMUX == context->cfgCopy.configA))
     {
-        Cy_CSD_ClrBits(context->cfgCopy.base, CY_CSD_REG_OFFSET_SW_BYP_SEL, CY_CSDIDAC_SW_BYPA_ENABLE);
+        CY_CSDIDAC_CSD_CLR_BITS(context, CY_CSD_REG_OFFSET_SW_BYP_SEL, CY_CSDIDAC_SW_BYPA_ENABLE);
     }
     /* Disconnects AMuxBusA from the selected pin, if it is configured. */
     if ((CY_CSDIDAC_GPIO == context->cfgCopy.configA) && (NULL != context->cfgCopy.ptrPinA))
     {
-        Cy_GPIO_SetHSIOM(context->cfgCopy.ptrPinA->ioPcPtr, (uint32_t)context->cfgCopy.ptrPinA->pin, HSIOM_SEL_GPIO);
+        CY_CSDIDAC_GPIO_SET_HSIOM(context, context->cfgCopy.ptrPinA->ioPcPtr, (uint32_t)context->cfgCopy.ptrPinA->pin, HSIOM_SEL_GPIO);
     }
 }
 
@@ -953,16 +1427,45 @@ static void Cy_CSDIDAC_DisconnectChannelB(cy_stc_csdidac_context_t * context)
 {
     /* Disables the desired IDAC. */
     context->channelStateB = CY_CSDIDAC_DISABLE;
-    Cy_CSD_WriteReg(context->cfgCopy.base, CY_CSD_REG_OFFSET_IDACB, 0uL);
+    Cy_CSDIDAC_WriteIdacReg(CY_CSDIDAC_B, 0u, context);
+    #if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+        if (true == context->autoRouteEn)
+        {
+            Cy_CSDIDAC_AutoRouteRelease(CY_CSDIDAC_ROUTE_B_MSK, context);
+        }
+        else
+        {
+            Cy_CSDIDAC_DisconnectPinB(context);
+        }
+    #else
+        Cy_CSDIDAC_DisconnectPinB(context);
+    #endif
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DisconnectPinB
+****************************************************************************//**
+*
+* Opens the bypass B switch and disconnects the output channel B pin,
+* if they are configured.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_DisconnectPinB(const cy_stc_csdidac_context_t * context)
+{
     /* Opens the bypass B switch to disconnect an output current from AMuxBusB. */
     if ((CY_CSDIDAC_GPIO == context->cfgCopy.configB) ||  (CY_CSDIDAC_AMUX == context->cfgCopy.configB))
     {
-        Cy_CSD_ClrBits(context->cfgCopy.base, CY_CSD_REG_OFFSET_SW_BYP_SEL, CY_CSDIDAC_SW_BYPB_ENABLE);
+        CY_CSDIDAC_CSD_CLR_BITS(context, CY_CSD_REG_OFFSET_SW_BYP_SEL, CY_CSDIDAC_SW_BYPB_ENABLE);
     }
     /* Disconnects AMuxBusB from the selected pin, if it is configured. */
     if ((CY_CSDIDAC_GPIO == context->cfgCopy.configB) && (NULL != context->cfgCopy.ptrPinB))
     {
-        Cy_GPIO_SetHSIOM(context->cfgCopy.ptrPinB->ioPcPtr, (uint32_t)context->cfgCopy.ptrPinB->pin, HSIOM_SEL_GPIO);
+        CY_CSDIDAC_GPIO_SET_HSIOM(context, context->cfgCopy.ptrPinB->ioPcPtr, (uint32_t)context->cfgCopy.ptrPinB->pin, HSIOM_SEL_GPIO);
     }
 }
 
@@ -1014,6 +1517,1055 @@ cy_en_csdidac_status_t Cy_CSDIDAC_OutputDisable(
     return (retVal);
 }
 
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_GetOutputSettings
+****************************************************************************//**
+*
+* Returns the polarity, LSB, and code of the last value written to the IDAC
+* register of the specified channel.
+*
+* The context structure keeps the written register value only, so the IDAC
+* register writes of the time critical paths take one store. The function
+* decodes that value on demand.
+*
+* \param ch
+* The channel to read: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param polarity
+* The pointer to the polarity of the IDAC output.
+*
+* \param lsbIndex
+* The pointer to the LSB index of the IDAC output.
+*
+* \param idacCode
+* The pointer to the code of the IDAC output.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_GetOutputSettings(
+                cy_en_csdidac_choice_t ch,
+                cy_en_csdidac_polarity_t * polarity,
+                cy_en_csdidac_lsb_t * lsbIndex,
+                uint32_t * idacCode,
+                const cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t idacRegValue;
+
+    if ((NULL != polarity) && (NULL != lsbIndex) && (NULL != idacCode) && (NULL != context) &&
+        ((CY_CSDIDAC_A == ch) || (CY_CSDIDAC_B == ch)))
+    {
+        idacRegValue = (CY_CSDIDAC_A == ch) ? context->idacRegValueA : context->idacRegValueB;
+        *polarity = Cy_CSDIDAC_GetIdacRegPolarity(idacRegValue);
+        *lsbIndex = (cy_en_csdidac_lsb_t)Cy_CSDIDAC_GetIdacRegLsb(idacRegValue);
+        *idacCode = idacRegValue & CY_CSDIDAC_MAX_CODE;
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+#if (0u != CY_CSDIDAC_MASKED_CYCLES_EN)
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_GetMaxMaskedCycles
+****************************************************************************//**
+*
+* Returns the maximum number of cycles with interrupts disabled by the output
+* enable path since the initialization or the last reset.
+*
+* The function is available when \ref CY_CSDIDAC_MASKED_CYCLES_EN is enabled.
+* The value is measured by the user-defined CY_CSDIDAC_GET_CYCLE_COUNT() macro
+* and can be compared against the interrupt latency budget of the application.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The maximum number of cycles.
+*
+*******************************************************************************/
+uint32_t Cy_CSDIDAC_GetMaxMaskedCycles(
+                const cy_stc_csdidac_context_t * context)
+{
+    return (context->maxMaskedCycles);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ResetMaxMaskedCycles
+****************************************************************************//**
+*
+* Resets the maximum number of cycles with interrupts disabled.
+*
+* The function is available when \ref CY_CSDIDAC_MASKED_CYCLES_EN is enabled.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_ResetMaxMaskedCycles(
+                cy_stc_csdidac_context_t * context)
+{
+    context->maxMaskedCycles = 0u;
+}
+#endif
+
+#if (0u != CY_CSDIDAC_VERIFY_EN)
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SetVerify
+****************************************************************************//**
+*
+* Configures the write-verify mode.
+*
+* The function is available when \ref CY_CSDIDAC_VERIFY_EN is enabled.
+* Each ratio-th IDAC register write of the middleware is followed by
+* the verification of the CSD HW block lock, the read back of the written
+* IDAC register, and, for a non-zero register value of a channel routed to
+* a pin or an analog bus, the read back of its bypass switch. The first
+* mismatch is kept until read by Cy_CSDIDAC_GetVerifyStatus() and
+* the mismatches are reported to the callback outside of the critical
+* sections of the middleware as described for
+* \ref cy_csdidac_verify_callback_t. The verification of the sampled
+* write takes a few register reads, the other writes take one counter
+* update.
+*
+* \param ratio
+* The number of the IDAC register writes per verification: 1u verifies each
+* write, 0u disables the verification.
+*
+* \param callback
+* The pointer to the mismatch callback function or NULL.
+*
+* \param param
+* The parameter passed to the callback function.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_SetVerify(
+                uint32_t ratio,
+                cy_csdidac_verify_callback_t callback,
+                void * param,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t interruptState;
+
+    if (NULL != context)
+    {
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(context);
+        context->ptrVerifyCallback = callback;
+        context->verifyParam = param;
+        context->verifyRatio = ratio;
+        context->verifyCount = 0u;
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(context, interruptState);
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_GetVerifyStatus
+****************************************************************************//**
+*
+* Returns and clears the status of the first write-verify mismatch.
+*
+* The function is available when \ref CY_CSDIDAC_VERIFY_EN is enabled.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of the write-verify mode.
+* * CY_CSDIDAC_SUCCESS    - No mismatch is detected.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+* * CY_CSDIDAC_HW_LOCKED  - The CSD HW block was not locked by the CSDIDAC
+*                           middleware.
+* * CY_CSDIDAC_HW_FAILURE - The read back registers did not match the written
+*                           values.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_GetVerifyStatus(
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t interruptState;
+
+    if (NULL != context)
+    {
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(context);
+        retVal = context->verifyStatus;
+        context->verifyStatus = CY_CSDIDAC_SUCCESS;
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(context, interruptState);
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_VerifyWrite
+****************************************************************************//**
+*
+* Verifies the IDAC register write as described for Cy_CSDIDAC_SetVerify().
+*
+* \param ch
+* The written channel: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param idacRegValue
+* The written IDAC register value.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_VerifyWrite(
+                cy_en_csdidac_choice_t ch,
+                uint32_t idacRegValue,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t status = CY_CSDIDAC_SUCCESS;
+    cy_en_csdidac_channel_config_t config = (CY_CSDIDAC_A == ch) ? context->cfgCopy.configA : context->cfgCopy.configB;
+    uint32_t bypassMask = (CY_CSDIDAC_A == ch) ? CY_CSDIDAC_SW_BYPA_ENABLE : CY_CSDIDAC_SW_BYPB_ENABLE;
+
+    if (CY_CSD_IDAC_KEY != CY_CSDIDAC_CSD_GET_LOCK_STATUS(context))
+    {
+        status = CY_CSDIDAC_HW_LOCKED;
+    }
+    else if (idacRegValue != CY_CSDIDAC_CSD_READ_REG(context,
+                                                     (CY_CSDIDAC_A == ch) ? CY_CSD_REG_OFFSET_IDACA : CY_CSD_REG_OFFSET_IDACB))
+    {
+        status = CY_CSDIDAC_HW_FAILURE;
+    }
+    else if ((0u != idacRegValue) && ((CY_CSDIDAC_GPIO == config) || (CY_CSDIDAC_AMUX == config)) &&
+             (0u == (CY_CSDIDAC_CSD_READ_REG(context, CY_CSD_REG_OFFSET_SW_BYP_SEL) & bypassMask)))
+    {
+        status = CY_CSDIDAC_HW_FAILURE;
+    }
+    else
+    {
+        /* The write is verified */
+    }
+
+    if (CY_CSDIDAC_SUCCESS != status)
+    {
+        if (CY_CSDIDAC_SUCCESS == context->verifyStatus)
+        {
+            context->verifyStatus = status;
+        }
+        /* The callback is called by Cy_CSDIDAC_VerifyNotify() outside of the critical sections */
+        if (CY_CSDIDAC_SUCCESS == context->verifyNotifyStatus)
+        {
+            context->verifyNotifyStatus = status;
+            context->verifyNotifyCh = ch;
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_VerifyNotify
+****************************************************************************//**
+*
+* Reports the write-verify mismatch latched by Cy_CSDIDAC_VerifyWrite() to
+* the callback and clears it.
+*
+* The function is called through CY_CSDIDAC_VERIFY_NOTIFY() after each IDAC
+* register write performed with interrupts enabled, and after the critical
+* sections with IDAC register writes. Without a latched mismatch, it takes
+* one comparison.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_VerifyNotify(
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t status;
+    cy_en_csdidac_choice_t ch;
+    uint32_t interruptState;
+
+    if (CY_CSDIDAC_SUCCESS != context->verifyNotifyStatus)
+    {
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(context);
+        status = context->verifyNotifyStatus;
+        ch = context->verifyNotifyCh;
+        context->verifyNotifyStatus = CY_CSDIDAC_SUCCESS;
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(context, interruptState);
+
+        if ((CY_CSDIDAC_SUCCESS != status) && (NULL != context->ptrVerifyCallback))
+        {
+            context->ptrVerifyCallback(status, ch, context->verifyParam);
+        }
+    }
+}
+#endif
+
+#if (0u != CY_CSDIDAC_CHARGE_EN)
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_GetChargeReport
+****************************************************************************//**
+*
+* Returns the charge, on-time, and average current of the channel since
+* the initialization or the last reset.
+*
+* The function is available when \ref CY_CSDIDAC_CHARGE_EN is enabled.
+* The accounting is updated by each IDAC register write of the middleware,
+* so the report covers all the middleware modules. The function integrates
+* the channel current up to the current timestamp in a short critical
+* section, so it can be called at any time.
+*
+* The charge is converted to pC as (charge * \ref CY_CSDIDAC_CHARGE_UNIT_PA /
+* timestamp frequency in Hz) and does not overflow for more than 10^14
+* timestamp ticks.
+*
+* \param ch
+* The channel: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param report
+* The pointer to the charge report structure
+* \ref cy_stc_csdidac_charge_report_t.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_GetChargeReport(
+                cy_en_csdidac_choice_t ch,
+                cy_stc_csdidac_charge_report_t * report,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    cy_stc_csdidac_charge_t * ptrCharge;
+    uint32_t interruptState;
+    int64_t quotient;
+    int64_t remainder;
+
+    if ((NULL != report) && (NULL != context) && ((CY_CSDIDAC_A == ch) || (CY_CSDIDAC_B == ch)))
+    {
+        ptrCharge = (CY_CSDIDAC_A == ch) ? &context->chargeA : &context->chargeB;
+
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(context);
+        Cy_CSDIDAC_AccumulateCharge(ptrCharge, (uint32_t)CY_CSDIDAC_GET_TIMESTAMP());
+        report->charge = ptrCharge->charge;
+        report->onTime = ptrCharge->onTime;
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(context, interruptState);
+
+        /* Divides in two steps to keep the product in the 64-bit range */
+        report->averageCurrent = 0;
+        if (0u != report->onTime)
+        {
+            quotient = report->charge / (int64_t)report->onTime;
+            remainder = report->charge % (int64_t)report->onTime;
+            report->averageCurrent = (int32_t)((quotient * (int64_t)CY_CSDIDAC_CHARGE_UNIT_PA) +
+                                               ((remainder * (int64_t)CY_CSDIDAC_CHARGE_UNIT_PA) / (int64_t)report->onTime));
+        }
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ResetCharge
+****************************************************************************//**
+*
+* Resets the charge and on-time of the channel(s). The current of the channel
+* is kept.
+*
+* The function is available when \ref CY_CSDIDAC_CHARGE_EN is enabled.
+*
+* \param ch
+* The channel(s) to reset.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ResetCharge(
+                cy_en_csdidac_choice_t ch,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t interruptState;
+    uint32_t timestamp;
+
+    if ((NULL != context) && ((CY_CSDIDAC_A == ch) || (CY_CSDIDAC_B == ch) || (CY_CSDIDAC_AB == ch)))
+    {
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(context);
+        timestamp = (uint32_t)CY_CSDIDAC_GET_TIMESTAMP();
+        if (CY_CSDIDAC_B != ch)
+        {
+            context->chargeA.charge = 0;
+            context->chargeA.onTime = 0u;
+            context->chargeA.timestamp = timestamp;
+        }
+        if (CY_CSDIDAC_A != ch)
+        {
+            context->chargeB.charge = 0;
+            context->chargeB.onTime = 0u;
+            context->chargeB.timestamp = timestamp;
+        }
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(context, interruptState);
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+#endif
+
+#if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SetAutoRoute
+****************************************************************************//**
+*
+* Enables or disables the automatic output routing.
+*
+* By default, Cy_CSDIDAC_OutputEnable() and the other output enable
+* functions connect the output pins and the bypass switches on each call,
+* even for the zero code, and the outputs stay connected until
+* Cy_CSDIDAC_OutputDisable() is called. The automatic routing connects
+* the output of an enabled channel on the first IDAC register write of
+* a nonzero code, including the writes of the tick functions of
+* the middleware modules, and disconnects it when the output is zero:
+* * If idleTicks is zero, the output is disconnected by the IDAC register
+*   write of the zero code.
+* * Otherwise, the output is disconnected by Cy_CSDIDAC_AutoRouteTick() after
+*   the specified number of its calls without a nonzero code written.
+*
+* The IDAC register value of a disconnected channel is kept, so the channel
+* remains enabled. A joined channel keeps the output of its partner
+* connected. When the automatic routing is disabled, the outputs of all
+* the enabled channels are connected again.
+*
+* \param enable
+* Enables the automatic routing if true, disables it otherwise.
+*
+* \param idleTicks
+* The number of Cy_CSDIDAC_AutoRouteTick() calls with the zero output before
+* the output is disconnected, zero to disconnect immediately.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_SetAutoRoute(
+                bool enable,
+                uint32_t idleTicks,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t interruptState;
+    uint32_t enabled = 0u;
+
+    if (NULL != context)
+    {
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(context);
+        if (CY_CSDIDAC_ENABLE == context->channelStateA)
+        {
+            enabled |= CY_CSDIDAC_ROUTE_A_MSK;
+        }
+        if (CY_CSDIDAC_ENABLE == context->channelStateB)
+        {
+            enabled |= CY_CSDIDAC_ROUTE_B_MSK;
+        }
+
+        if (true == enable)
+        {
+            if (false == context->autoRouteEn)
+            {
+                /* The outputs of the enabled channels are connected by the default routing */
+                context->autoRouteActive = enabled;
+                context->autoRouteRouted = Cy_CSDIDAC_GetRequiredRoutes(enabled, context);
+                context->autoRouteZero = 0u;
+                if (0u == (CY_CSDIDAC_CSD_READ_REG(context, CY_CSD_REG_OFFSET_IDACA) & CY_CSDIDAC_MAX_CODE))
+                {
+                    context->autoRouteZero |= CY_CSDIDAC_ROUTE_A_MSK;
+                }
+                if (0u == (CY_CSDIDAC_CSD_READ_REG(context, CY_CSD_REG_OFFSET_IDACB) & CY_CSDIDAC_MAX_CODE))
+                {
+                    context->autoRouteZero |= CY_CSDIDAC_ROUTE_B_MSK;
+                }
+                context->idleCountA = 0u;
+                context->idleCountB = 0u;
+            }
+            context->autoRouteIdleTicks = idleTicks;
+            context->autoRouteEn = true;
+            if (0u == idleTicks)
+            {
+                context->autoRouteActive &= ~context->autoRouteZero;
+                Cy_CSDIDAC_AutoRouteUpdate(context);
+            }
+        }
+        else if (true == context->autoRouteEn)
+        {
+            context->autoRouteActive = enabled;
+            Cy_CSDIDAC_AutoRouteUpdate(context);
+            context->autoRouteEn = false;
+        }
+        else
+        {
+            /* The automatic routing is already disabled */
+        }
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(context, interruptState);
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_AutoRouteTick
+****************************************************************************//**
+*
+* Counts the idle ticks of the automatic routing and disconnects the outputs,
+* that have been zero for the number of ticks set by Cy_CSDIDAC_SetAutoRoute().
+*
+* The function is intended to be called periodically, e.g. from a timer
+* interrupt or the main loop. It performs no parameter checks and does
+* nothing if the automatic routing is disabled or the idle tick number is
+* zero.
+* The function must not preempt the IDAC register writes of the middleware,
+* e.g. it can be called from the interrupt of the tick functions of
+* the middleware modules.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_AutoRouteTick(
+                cy_stc_csdidac_context_t * context)
+{
+    uint32_t interruptState;
+    uint32_t idle;
+    uint32_t expired = 0u;
+
+    if ((true == context->autoRouteEn) && (0u != context->autoRouteIdleTicks))
+    {
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(context);
+        idle = context->autoRouteActive & context->autoRouteZero;
+        if (0u != (idle & CY_CSDIDAC_ROUTE_A_MSK))
+        {
+            context->idleCountA++;
+            if (context->idleCountA >= context->autoRouteIdleTicks)
+            {
+                expired |= CY_CSDIDAC_ROUTE_A_MSK;
+            }
+        }
+        if (0u != (idle & CY_CSDIDAC_ROUTE_B_MSK))
+        {
+            context->idleCountB++;
+            if (context->idleCountB >= context->autoRouteIdleTicks)
+            {
+                expired |= CY_CSDIDAC_ROUTE_B_MSK;
+            }
+        }
+        if (0u != expired)
+        {
+            context->autoRouteActive &= ~expired;
+            Cy_CSDIDAC_AutoRouteUpdate(context);
+        }
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(context, interruptState);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_GetAutoRouteCounters
+****************************************************************************//**
+*
+* Returns the routing register write counters of the automatic routing since
+* the middleware initialization.
+*
+* The writes of the bypass switch and the writes of the pin drive mode and
+* HSIOM registers are counted per output. The saved writes are the writes
+* the default routing would perform on the output enable and disable calls
+* and the automatic routing skips, because the output is already in the
+* required state or its code is zero.
+*
+* \param routeWrites
+* The pointer to the number of the routing register writes performed by
+* the automatic routing.
+*
+* \param savedWrites
+* The pointer to the number of the saved routing register writes.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_GetAutoRouteCounters(
+                uint32_t * routeWrites,
+                uint32_t * savedWrites,
+                const cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((NULL != routeWrites) && (NULL != savedWrites) && (NULL != context))
+    {
+        *routeWrites = context->routeWriteCount;
+        *savedWrites = context->routeSavedCount;
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_AutoRouteWrite
+****************************************************************************//**
+*
+* Updates the automatic routing before the IDAC register write of an enabled
+* channel: a nonzero code connects the output and restarts the idle ticks,
+* the zero code disconnects the output if the idle tick number is zero.
+*
+* \param ch
+* The channel to update: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param idacRegValue
+* The IDAC register value to be written.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_AutoRouteWrite(
+                cy_en_csdidac_choice_t ch,
+                uint32_t idacRegValue,
+                cy_stc_csdidac_context_t * context)
+{
+    bool isChA = (CY_CSDIDAC_A == ch);
+    uint32_t mask = (true == isChA) ? CY_CSDIDAC_ROUTE_A_MSK : CY_CSDIDAC_ROUTE_B_MSK;
+
+    if (CY_CSDIDAC_ENABLE == ((true == isChA) ? context->channelStateA : context->channelStateB))
+    {
+        if (0u != (idacRegValue & CY_CSDIDAC_MAX_CODE))
+        {
+            context->autoRouteZero &= ~mask;
+            if (true == isChA)
+            {
+                context->idleCountA = 0u;
+            }
+            else
+            {
+                context->idleCountB = 0u;
+            }
+            if (0u == (context->autoRouteActive & mask))
+            {
+                context->autoRouteActive |= mask;
+                Cy_CSDIDAC_AutoRouteUpdate(context);
+            }
+        }
+        else
+        {
+            context->autoRouteZero |= mask;
+            if ((0u == context->autoRouteIdleTicks) && (0u != (context->autoRouteActive & mask)))
+            {
+                context->autoRouteActive &= ~mask;
+                Cy_CSDIDAC_AutoRouteUpdate(context);
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_GetRequiredRoutes
+****************************************************************************//**
+*
+* Returns the outputs to be connected for the specified active channels:
+* a joined channel needs the output of its partner.
+*
+* \param active
+* The active channels mask.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The mask of the outputs to be connected.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDIDAC_GetRequiredRoutes(
+                uint32_t active,
+                const cy_stc_csdidac_context_t * context)
+{
+    uint32_t routes = active;
+
+    if ((0u != (active & CY_CSDIDAC_ROUTE_A_MSK)) && (CY_CSDIDAC_JOIN == context->cfgCopy.configA))
+    {
+        routes |= CY_CSDIDAC_ROUTE_B_MSK;
+    }
+    if ((0u != (active & CY_CSDIDAC_ROUTE_B_MSK)) && (CY_CSDIDAC_JOIN == context->cfgCopy.configB))
+    {
+        routes |= CY_CSDIDAC_ROUTE_A_MSK;
+    }
+
+    return (routes);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_GetRouteWrites
+****************************************************************************//**
+*
+* Returns the number of the register writes to connect or to disconnect
+* the specified outputs: one bypass switch write for a GPIO or AMUX output,
+* and the drive mode and HSIOM writes to connect, or the HSIOM write to
+* disconnect a GPIO output pin.
+*
+* \param routes
+* The mask of the outputs.
+*
+* \param connect
+* Counts the connection writes if true, the disconnection writes otherwise.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The number of the register writes.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDIDAC_GetRouteWrites(
+                uint32_t routes,
+                bool connect,
+                const cy_stc_csdidac_context_t * context)
+{
+    uint32_t writes = 0u;
+    uint32_t pinWrites = (true == connect) ? 2u : 1u;
+
+    if (0u != (routes & CY_CSDIDAC_ROUTE_A_MSK))
+    {
+        if ((CY_CSDIDAC_GPIO == context->cfgCopy.configA) || (CY_CSDIDAC_AMUX == context->cfgCopy.configA))
+        {
+            writes++;
+        }
+        if ((CY_CSDIDAC_GPIO == context->cfgCopy.configA) && (NULL != context->cfgCopy.ptrPinA))
+        {
+            writes += pinWrites;
+        }
+    }
+    if (0u != (routes & CY_CSDIDAC_ROUTE_B_MSK))
+    {
+        if ((CY_CSDIDAC_GPIO == context->cfgCopy.configB) || (CY_CSDIDAC_AMUX == context->cfgCopy.configB))
+        {
+            writes++;
+        }
+        if ((CY_CSDIDAC_GPIO == context->cfgCopy.configB) && (NULL != context->cfgCopy.ptrPinB))
+        {
+            writes += pinWrites;
+        }
+    }
+
+    return (writes);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_AutoRouteUpdate
+****************************************************************************//**
+*
+* Connects the outputs required by the active channels and disconnects
+* the outputs, that are not required anymore. The function must be called
+* with interrupts disabled.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_AutoRouteUpdate(cy_stc_csdidac_context_t * context)
+{
+    uint32_t required = Cy_CSDIDAC_GetRequiredRoutes(context->autoRouteActive, context);
+    uint32_t connect = required & ~context->autoRouteRouted;
+    uint32_t disconnect = context->autoRouteRouted & ~required;
+    uint32_t bypassMask = 0u;
+
+    if (0u != (connect & CY_CSDIDAC_ROUTE_A_MSK))
+    {
+        bypassMask |= Cy_CSDIDAC_ConnectPinA(true, context);
+    }
+    if (0u != (connect & CY_CSDIDAC_ROUTE_B_MSK))
+    {
+        bypassMask |= Cy_CSDIDAC_ConnectPinB(true, context);
+    }
+    if (0u != bypassMask)
+    {
+        CY_CSDIDAC_CSD_SET_BITS(context, CY_CSD_REG_OFFSET_SW_BYP_SEL, bypassMask);
+    }
+    if (0u != (disconnect & CY_CSDIDAC_ROUTE_A_MSK))
+    {
+        Cy_CSDIDAC_DisconnectPinA(context);
+    }
+    if (0u != (disconnect & CY_CSDIDAC_ROUTE_B_MSK))
+    {
+        Cy_CSDIDAC_DisconnectPinB(context);
+    }
+
+    context->routeWriteCount += Cy_CSDIDAC_GetRouteWrites(connect, true, context) +
+                                Cy_CSDIDAC_GetRouteWrites(disconnect, false, context);
+    context->autoRouteRouted = required;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_AutoRouteEnable
+****************************************************************************//**
+*
+* Updates the automatic routing of the channels enabled by
+* Cy_CSDIDAC_OutputEnableReg() before their IDAC register writes:
+* a nonzero code connects the outputs and restarts the idle ticks,
+* the zero code disconnects the outputs if the idle tick number is zero.
+* The function must be called with interrupts disabled.
+*
+* \param mask
+* The enabled channels mask.
+*
+* \param isZero
+* The written IDAC code is zero if true.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_AutoRouteEnable(
+                uint32_t mask,
+                bool isZero,
+                cy_stc_csdidac_context_t * context)
+{
+    uint32_t active = context->autoRouteActive;
+
+    if (false == isZero)
+    {
+        context->autoRouteZero &= ~mask;
+        if (0u != (mask & CY_CSDIDAC_ROUTE_A_MSK))
+        {
+            context->idleCountA = 0u;
+        }
+        if (0u != (mask & CY_CSDIDAC_ROUTE_B_MSK))
+        {
+            context->idleCountB = 0u;
+        }
+        active |= mask;
+    }
+    else
+    {
+        context->autoRouteZero |= mask;
+        if (0u == context->autoRouteIdleTicks)
+        {
+            active &= ~mask;
+        }
+    }
+    if (active != context->autoRouteActive)
+    {
+        context->autoRouteActive = active;
+        Cy_CSDIDAC_AutoRouteUpdate(context);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_AutoRouteRelease
+****************************************************************************//**
+*
+* Releases the outputs of the disabled channels and counts the writes saved
+* against the default disconnection.
+*
+* \param mask
+* The disabled channels mask.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_AutoRouteRelease(
+                uint32_t mask,
+                cy_stc_csdidac_context_t * context)
+{
+    uint32_t interruptState;
+    uint32_t defaultWrites = Cy_CSDIDAC_GetRouteWrites(mask, false, context);
+    uint32_t routeWrites;
+
+    interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(context);
+    routeWrites = context->routeWriteCount;
+    context->autoRouteActive &= ~mask;
+    context->autoRouteZero &= ~mask;
+    Cy_CSDIDAC_AutoRouteUpdate(context);
+    routeWrites = context->routeWriteCount - routeWrites;
+    if (defaultWrites > routeWrites)
+    {
+        context->routeSavedCount += defaultWrites - routeWrites;
+    }
+    CY_CSDIDAC_EXIT_CRITICAL_SECTION(context, interruptState);
+}
+#endif
+
+#if (0u != CY_CSDIDAC_BACKEND_EN)
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_PdlCsdInit ... Cy_CSDIDAC_PdlExitCriticalSection
+****************************************************************************//**
+*
+* The functions of the \ref cy_csdidac_backendPdl backend. Each function
+* ignores the backend parameter and calls the corresponding PDL function.
+*
+*******************************************************************************/
+static cy_en_csd_status_t Cy_CSDIDAC_PdlCsdInit(void * param, CSD_Type * base, cy_stc_csd_config_t const * config,
+                                                cy_en_csd_key_t key, cy_stc_csd_context_t * context)
+{
+    (void)param;
+    return (Cy_CSD_Init(base, config, key, context));
+}
+
+static cy_en_csd_status_t Cy_CSDIDAC_PdlCsdDeInit(void * param, const CSD_Type * base, cy_en_csd_key_t key,
+                                                  cy_stc_csd_context_t * context)
+{
+    (void)param;
+    return (Cy_CSD_DeInit(base, key, context));
+}
+
+static cy_en_csd_key_t Cy_CSDIDAC_PdlCsdGetLockStatus(void * param, const CSD_Type * base,
+                                                      const cy_stc_csd_context_t * context)
+{
+    (void)param;
+    return (Cy_CSD_GetLockStatus(base, context));
+}
+
+static cy_en_csd_status_t Cy_CSDIDAC_PdlCsdGetConversionStatus(void * param, const CSD_Type * base,
+                                                               const cy_stc_csd_context_t * context)
+{
+    (void)param;
+    return (Cy_CSD_GetConversionStatus(base, context));
+}
+
+static uint32_t Cy_CSDIDAC_PdlCsdReadReg(void * param, const CSD_Type * base, uint32_t offset)
+{
+    (void)param;
+    return (Cy_CSD_ReadReg(base, offset));
+}
+
+static void Cy_CSDIDAC_PdlCsdWriteReg(void * param, CSD_Type * base, uint32_t offset, uint32_t value)
+{
+    (void)param;
+    Cy_CSD_WriteReg(base, offset, value);
+}
+
+static void Cy_CSDIDAC_PdlCsdSetBits(void * param, CSD_Type * base, uint32_t offset, uint32_t mask)
+{
+    (void)param;
+    Cy_CSD_SetBits(base, offset, mask);
+}
+
+static void Cy_CSDIDAC_PdlCsdClrBits(void * param, CSD_Type * base, uint32_t offset, uint32_t mask)
+{
+    (void)param;
+    Cy_CSD_ClrBits(base, offset, mask);
+}
+
+static void Cy_CSDIDAC_PdlGpioSetDrivemode(void * param, GPIO_PRT_Type * base, uint32_t pinNum, uint32_t value)
+{
+    (void)param;
+    Cy_GPIO_SetDrivemode(base, pinNum, value);
+}
+
+static uint32_t Cy_CSDIDAC_PdlGpioGetDrivemode(void * param, GPIO_PRT_Type * base, uint32_t pinNum)
+{
+    (void)param;
+    return (Cy_GPIO_GetDrivemode(base, pinNum));
+}
+
+static void Cy_CSDIDAC_PdlGpioSetHsiom(void * param, GPIO_PRT_Type * base, uint32_t pinNum, en_hsiom_sel_t value)
+{
+    (void)param;
+    Cy_GPIO_SetHSIOM(base, pinNum, value);
+}
+
+static en_hsiom_sel_t Cy_CSDIDAC_PdlGpioGetHsiom(void * param, GPIO_PRT_Type * base, uint32_t pinNum)
+{
+    (void)param;
+    return (Cy_GPIO_GetHSIOM(base, pinNum));
+}
+
+static void Cy_CSDIDAC_PdlDelayUs(void * param, uint16_t microseconds)
+{
+    (void)param;
+    Cy_SysLib_DelayUs(microseconds);
+}
+
+static uint32_t Cy_CSDIDAC_PdlEnterCriticalSection(void * param)
+{
+    (void)param;
+    return (Cy_SysLib_EnterCriticalSection());
+}
+
+static void Cy_CSDIDAC_PdlExitCriticalSection(void * param, uint32_t savedIntrStatus)
+{
+    (void)param;
+    Cy_SysLib_ExitCriticalSection(savedIntrStatus);
+}
+#endif
+
 #endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
 
 
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_csdidac.h
-* \version 2.10
+* \version 2.20
 *
 * \brief
 * This file provides the function prototypes and constants specific
@@ -74,6 +74,47 @@
 *     <td>0 to 609.6 uA</td>
 *   </tr>
 * </table>
+* * The closed-loop regulation of an IDAC output current against a measured
+*   feedback value.
+* * The direct digital synthesis (DDS) of sine and triangle waveforms with a
+*   constant memory size regardless of the frequency.
+* * Time-multiplexed output of one channel to a list of pins with per-pin
+*   current setpoints.
+* * Prepared setpoints that are verified once and applied without checks.
+* * Code-space sweep with per-range gain, offset, INL, and DNL calculation for
+*   the end-of-line calibration.
+* * Asynchronous request queue with completion callbacks and an OS abstraction
+*   layer for RTOS environments.
+* * Minimal interrupt-masked region in the output enable path with optional
+*   masked-cycle instrumentation.
+* * Glitch-free LSB range transitions with monotonic steps or bridging through
+*   the joined IDAC.
+* * Unified monotonic linear code space across all LSB ranges.
+* * Picoampere-resolution current API with division-free rounding.
+* * Double-buffered setpoints latched on an external trigger with overrun
+*   detection.
+* * Current profile sequencer executing compact flash-resident instruction
+*   sequences.
+* * Delta-compressed waveform format with a bounded-cost streaming player.
+* * Optional per-channel charge, on-time, and average current accounting.
+* * Optional sampled write-verify and lock-loss detection of the IDAC register
+*   writes.
+* * Flash-resident CSD HW block configurations of the Cy_CSDIDAC_Restore()
+*   function.
+* * Optional pluggable hardware-access backend with an in-memory backend for
+*   host builds.
+* * Multi-instance manager of several CSD HW blocks with virtual channels and
+*   group updates.
+* * Piecewise-linear current profile interpolator with fixed-point per-tick
+*   interpolation.
+* * Polarity chopping mode with configurable dead time and sync callback.
+* * Optional automatic output routing with lazy connection and idle
+*   disconnection.
+* * Differential source/sink pair mode with optional per-channel calibration.
+* * Joined-channel current split up to 1219.2 uA with 37.5 nA steps up to
+*   614.4 uA.
+* * Multi-client setpoint arbitration with the priority, maximum, and clamped
+*   sum policies.
 *
 ********************************************************************************
 * \section section_csdidac_general General Description
@@ -490,6 +531,133 @@
 * <table class="doxtable">
 *   <tr><th>Version</th><th>Changes</th><th>Reason for Change</th></tr>
 *   <tr>
+*     <td rowspan="25">2.20</td>
+*     <td>The closed-loop current regulator is added. Refer to
+*         Cy_CSDIDAC_RegulatorInit()</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>The direct digital synthesis (DDS) sine and triangle waveform
+*         generator is added. Refer to Cy_CSDIDAC_DdsInit()</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the time-multiplexed pin scanning mode:
+*         Cy_CSDIDAC_ScanInit(), Cy_CSDIDAC_ScanSetCurrent(),
+*         Cy_CSDIDAC_ScanStart(), Cy_CSDIDAC_ScanSelect(),
+*         Cy_CSDIDAC_ScanNext(), Cy_CSDIDAC_ScanStop()</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the prepared setpoint API:
+*         Cy_CSDIDAC_SetpointPrepare(), Cy_CSDIDAC_SetpointPrepareExt(),
+*         Cy_CSDIDAC_SetpointCommit()</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the code-space sweep and characterization mode:
+*         Cy_CSDIDAC_SweepInit(), Cy_CSDIDAC_SweepStart(),
+*         Cy_CSDIDAC_SweepProcess(), Cy_CSDIDAC_SweepIsBusy(),
+*         Cy_CSDIDAC_SweepStop(), Cy_CSDIDAC_SweepGetCalibration(),
+*         Cy_CSDIDAC_CalculateRangeCalibration()</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the asynchronous request API:
+*         Cy_CSDIDAC_AsyncInit(), Cy_CSDIDAC_AsyncSubmit(),
+*         Cy_CSDIDAC_AsyncProcess(), Cy_CSDIDAC_AsyncRun(),
+*         Cy_CSDIDAC_AsyncStop()</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Reduced the interrupt-masked region of Cy_CSDIDAC_OutputEnable()
+*         and Cy_CSDIDAC_OutputEnableExt(). Added the CY_CSDIDAC_MASKED_CYCLES_EN
+*         option with Cy_CSDIDAC_GetMaxMaskedCycles(),
+*         Cy_CSDIDAC_ResetMaxMaskedCycles()</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the glitch-free LSB range transition:
+*         Cy_CSDIDAC_OutputTransition()</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the unified linear code space that maps all LSB ranges to a single monotonic index</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the Cy_CSDIDAC_OutputEnablePa() and Cy_CSDIDAC_ConvertCurrentPa() functions that accept the current in pA</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the double-buffered setpoints latched on an external trigger</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the current profile sequencer with the compact instruction format and the tick-driven interpreter</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the compressed waveform format with the streaming player and the device-independent encoder and decoder</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the CY_CSDIDAC_CHARGE_EN option, the Cy_CSDIDAC_GetChargeReport() and Cy_CSDIDAC_ResetCharge() functions for the charge accounting</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the optional write-verify mode enabled by CY_CSDIDAC_VERIFY_EN
+*         and the Cy_CSDIDAC_SetVerify() and Cy_CSDIDAC_GetVerifyStatus() functions</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Changed the Cy_CSDIDAC_Restore() function to select one of two
+*         flash-resident CSD HW block configurations instead of building it on the stack</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the optional hardware-access backend enabled by CY_CSDIDAC_BACKEND_EN,
+*         the cy_csdidac_backendPdl backend, and the in-memory backend
+*         in the cy_csdidac_backend_mem.h/.c files</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the multi-instance manager in the cy_csdidac_multi.h/.c files
+*         and the internal Cy_CSDIDAC_Capture() function</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the piecewise-linear current profile interpolator in the
+*         cy_csdidac_pwl.h/.c files</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the polarity chopping mode in the
+*         cy_csdidac_chop.h/.c files</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the optional automatic output routing enabled by CY_CSDIDAC_AUTOROUTE_EN,
+*         the Cy_CSDIDAC_SetAutoRoute(), Cy_CSDIDAC_AutoRouteTick(), and
+*         Cy_CSDIDAC_GetAutoRouteCounters() functions</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the differential source/sink pair mode in the
+*         cy_csdidac_diff.h/.c files</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the joined-channel current split in the
+*         cy_csdidac_join.h/.c files</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
+*     <td>Added the multi-client setpoint arbitration layer in the
+*         cy_csdidac_arb.h/.c files</td>
+*     <td>Feature enhancement</td>
+*   </tr>
+*   <tr>
 *     <td rowspan="2">2.10</td>
 *     <td>Added the support of PSoC 4 CapSense Forth Generation devices</td>
 *     <td>Devices support</td>
@@ -644,7 +812,7 @@
 * and current CSDIDAC middleware state data. The context
 * structure should be allocated by the user and be passed to all
 * CSDIDAC middleware functions. CSDIDAC middleware structure sizes
-* are shown in the table below:
+* with all optional features disabled are shown in the table below:
 *
 * <table class="doxtable">
 *   <tr><th>Structure</th><th>Size in bytes (w/o padding)</th></tr>
@@ -658,10 +826,45 @@
 *   </tr>
 *   <tr>
 *     <td>cy_stc_csdidac_context_t</td>
-*     <td>31</td>
+*     <td>33</td>
+*   </tr>
+* </table>
+*
+* Each enabled optional feature adds the following number of bytes
+* (w/o padding) to the structures:
+*
+* <table class="doxtable">
+*   <tr><th>Feature</th><th>cy_stc_csdidac_config_t</th><th>cy_stc_csdidac_context_t</th></tr>
+*   <tr>
+*     <td>CY_CSDIDAC_BACKEND_EN</td>
+*     <td>8</td>
+*     <td>8</td>
+*   </tr>
+*   <tr>
+*     <td>CY_CSDIDAC_MASKED_CYCLES_EN</td>
+*     <td>0</td>
+*     <td>4</td>
+*   </tr>
+*   <tr>
+*     <td>CY_CSDIDAC_CHARGE_EN</td>
+*     <td>0</td>
+*     <td>50</td>
+*   </tr>
+*   <tr>
+*     <td>CY_CSDIDAC_VERIFY_EN</td>
+*     <td>0</td>
+*     <td>19</td>
+*   </tr>
+*   <tr>
+*     <td>CY_CSDIDAC_AUTOROUTE_EN</td>
+*     <td>0</td>
+*     <td>33</td>
 *   </tr>
 * </table>
 *
+* With all optional features enabled, cy_stc_csdidac_config_t takes 31 bytes
+* and cy_stc_csdidac_context_t takes 147 bytes.
+*
 * \defgroup group_csdidac_functions Functions
 * \brief
 * This section describes the CSDIDAC Function Prototypes.
@@ -692,10 +895,10 @@ extern "C" {
 #define CY_CSDIDAC_MW_VERSION_MAJOR             (2)
 
 /** Middleware minor version */
-#define CY_CSDIDAC_MW_VERSION_MINOR             (10)
+#define CY_CSDIDAC_MW_VERSION_MINOR             (20)
 
 /** Middleware version */
-#define CY_CSDIDAC_MW_VERSION                   (210)
+#define CY_CSDIDAC_MW_VERSION                   (220)
 
 /** CSDIDAC ID. The user can identify the CSDIDAC middleware error codes by this macro. */
 #define CY_CSDIDAC_ID                           (CY_PDL_DRV_ID(0x44u))
@@ -714,6 +917,92 @@ extern "C" {
 */
 #define CY_CSDIDAC_MAX_CURRENT_NA               (609600uL)
 
+/**
+* The CSDIDAC max output current value in pA. The user provides
+* the value of the current parameter for the Cy_CSDIDAC_OutputEnablePa()
+* function in range from 0 to +/-(CY_CSDIDAC_MAX_CURRENT_PA).
+*/
+#define CY_CSDIDAC_MAX_CURRENT_PA               (609600000uL)
+
+#if !defined(CY_CSDIDAC_MASKED_CYCLES_EN)
+/**
+* Enables the measurement of the interrupt-masked region of the output
+* enable path. When the macro is redefined by the user to 1u, the maximum
+* number of cycles with interrupts disabled is kept in the context structure
+* and reported by Cy_CSDIDAC_GetMaxMaskedCycles(). The user must also define
+* the CY_CSDIDAC_GET_CYCLE_COUNT() macro that returns a free-running 32-bit
+* cycle counter, e.g. the DWT CYCCNT register on Cortex-M3/M4 devices.
+*/
+#define CY_CSDIDAC_MASKED_CYCLES_EN             (0u)
+#endif
+
+#if ((0u != CY_CSDIDAC_MASKED_CYCLES_EN) && !defined(CY_CSDIDAC_GET_CYCLE_COUNT))
+    #error "CY_CSDIDAC_GET_CYCLE_COUNT() must be defined if CY_CSDIDAC_MASKED_CYCLES_EN is enabled"
+#endif
+
+#if !defined(CY_CSDIDAC_CHARGE_EN)
+/**
+* Enables the charge accounting of the IDAC channels. When the macro is
+* redefined by the user to 1u, each IDAC register update integrates the
+* previous channel current over the time elapsed since the previous update.
+* The accumulated charge, on-time, and average current are reported by
+* Cy_CSDIDAC_GetChargeReport(). The user must also define
+* the CY_CSDIDAC_GET_TIMESTAMP() macro that returns a free-running 32-bit
+* timestamp, e.g. a counter of a timer or a system tick.
+*/
+#define CY_CSDIDAC_CHARGE_EN                    (0u)
+#endif
+
+#if ((0u != CY_CSDIDAC_CHARGE_EN) && !defined(CY_CSDIDAC_GET_TIMESTAMP))
+    #error "CY_CSDIDAC_GET_TIMESTAMP() must be defined if CY_CSDIDAC_CHARGE_EN is enabled"
+#endif
+
+#if !defined(CY_CSDIDAC_VERIFY_EN)
+/**
+* Enables the write-verify mode. When the macro is redefined by the user
+* to 1u, the IDAC register writes of the middleware are verified on
+* the sampling ratio set by Cy_CSDIDAC_SetVerify(): the CSD HW block lock
+* and the IDAC and bypass switch registers are read back, and a mismatch
+* is reported by Cy_CSDIDAC_GetVerifyStatus() and the user callback.
+* A mismatch of a write performed with interrupts disabled is latched in
+* the context structure and reported to the callback after the middleware
+* function enables interrupts again, so the callback never runs in
+* a critical section of the middleware.
+*/
+#define CY_CSDIDAC_VERIFY_EN                    (0u)
+#endif
+
+#if !defined(CY_CSDIDAC_BACKEND_EN)
+/**
+* Enables the pluggable hardware-access backend. When the macro is redefined
+* by the user to 1u, the CSD driver, GPIO driver, and SysLib calls of
+* the middleware are performed through the \ref cy_stc_csdidac_backend_t
+* function table pointed by the configuration structure, so the middleware
+* can be retargeted to a simulator, a bench fixture, or a recording backend.
+* Otherwise, the PDL functions are called directly.
+*/
+#define CY_CSDIDAC_BACKEND_EN                   (0u)
+#endif
+
+#if !defined(CY_CSDIDAC_AUTOROUTE_EN)
+/**
+* Enables the automatic output routing. When the macro is redefined by
+* the user to 1u, Cy_CSDIDAC_SetAutoRoute() can switch the middleware from
+* connecting the output pins on each output enable to connecting them on
+* the first IDAC register write of a nonzero code and disconnecting them when
+* the output is zero, immediately or after the idle ticks counted by
+* Cy_CSDIDAC_AutoRouteTick().
+*/
+#define CY_CSDIDAC_AUTOROUTE_EN                 (0u)
+#endif
+
+/**
+* The current unit of the charge accounting in pA, i.e. the 37.5 nA LSB. All
+* the IDAC currents are integer multiples of this unit, so the charge is
+* accumulated exactly.
+*/
+#define CY_CSDIDAC_CHARGE_UNIT_PA               (37500u)
+
 /** \} group_csdidac_macros */
 
 /***************************************
@@ -859,6 +1148,51 @@ typedef struct {
     uint8_t pin;                            /**< The channel IO pin. */
 } cy_stc_csdidac_pin_t;
 
+#if (0u != CY_CSDIDAC_BACKEND_EN)
+/**
+* The CSDIDAC hardware-access backend structure. Each function has
+* the signature of the corresponding PDL function with the additional first
+* parameter, that is the backendParam field of the configuration structure.
+*/
+typedef struct
+{
+    cy_en_csd_status_t (*csdInit)(void * param, CSD_Type * base, cy_stc_csd_config_t const * config,
+                                  cy_en_csd_key_t key, cy_stc_csd_context_t * context);
+                                            /**< Replaces Cy_CSD_Init(). */
+    cy_en_csd_status_t (*csdDeInit)(void * param, const CSD_Type * base, cy_en_csd_key_t key,
+                                    cy_stc_csd_context_t * context);
+                                            /**< Replaces Cy_CSD_DeInit(). */
+    cy_en_csd_key_t (*csdGetLockStatus)(void * param, const CSD_Type * base,
+                                        const cy_stc_csd_context_t * context);
+                                            /**< Replaces Cy_CSD_GetLockStatus(). */
+    cy_en_csd_status_t (*csdGetConversionStatus)(void * param, const CSD_Type * base,
+                                                 const cy_stc_csd_context_t * context);
+                                            /**< Replaces Cy_CSD_GetConversionStatus(). */
+    uint32_t (*csdReadReg)(void * param, const CSD_Type * base, uint32_t offset);
+                                            /**< Replaces Cy_CSD_ReadReg(). */
+    void (*csdWriteReg)(void * param, CSD_Type * base, uint32_t offset, uint32_t value);
+                                            /**< Replaces Cy_CSD_WriteReg(). */
+    void (*csdSetBits)(void * param, CSD_Type * base, uint32_t offset, uint32_t mask);
+                                            /**< Replaces Cy_CSD_SetBits(). */
+    void (*csdClrBits)(void * param, CSD_Type * base, uint32_t offset, uint32_t mask);
+                                            /**< Replaces Cy_CSD_ClrBits(). */
+    void (*gpioSetDrivemode)(void * param, GPIO_PRT_Type * base, uint32_t pinNum, uint32_t value);
+                                            /**< Replaces Cy_GPIO_SetDrivemode(). */
+    uint32_t (*gpioGetDrivemode)(void * param, GPIO_PRT_Type * base, uint32_t pinNum);
+                                            /**< Replaces Cy_GPIO_GetDrivemode(). */
+    void (*gpioSetHsiom)(void * param, GPIO_PRT_Type * base, uint32_t pinNum, en_hsiom_sel_t value);
+                                            /**< Replaces Cy_GPIO_SetHSIOM(). */
+    en_hsiom_sel_t (*gpioGetHsiom)(void * param, GPIO_PRT_Type * base, uint32_t pinNum);
+                                            /**< Replaces Cy_GPIO_GetHSIOM(). */
+    void (*delayUs)(void * param, uint16_t microseconds);
+                                            /**< Replaces Cy_SysLib_DelayUs(). */
+    uint32_t (*enterCriticalSection)(void * param);
+                                            /**< Replaces Cy_SysLib_EnterCriticalSection(). */
+    void (*exitCriticalSection)(void * param, uint32_t savedIntrStatus);
+                                            /**< Replaces Cy_SysLib_ExitCriticalSection(). */
+} cy_stc_csdidac_backend_t;
+#endif
+
 /** The CSDIDAC configuration structure */
 typedef struct
 {
@@ -870,19 +1204,82 @@ typedef struct
     const cy_stc_csdidac_pin_t * ptrPinB;   /**< The pointer to the IDAC B pin structure. */
     uint32_t cpuClk;                        /**< CPU Clock in Hz. */
     uint8_t csdInitTime;                    /**< The CSD HW Block initialization time. */
+    #if (0u != CY_CSDIDAC_BACKEND_EN)
+        const cy_stc_csdidac_backend_t * ptrBackend; /**< The pointer to the hardware-access backend, NULL selects \ref cy_csdidac_backendPdl. */
+        void * backendParam;                /**< The parameter passed to the backend functions. */
+    #endif
 } cy_stc_csdidac_config_t;
 
+#if (0u != CY_CSDIDAC_CHARGE_EN)
+/** The CSDIDAC charge accounting structure of one channel. */
+typedef struct
+{
+    int64_t charge;                         /**< The charge in \ref CY_CSDIDAC_CHARGE_UNIT_PA by timestamp ticks, positive for sourcing. */
+    uint64_t onTime;                        /**< The time with the IDAC enabled in timestamp ticks. */
+    uint32_t timestamp;                     /**< The timestamp of the last update. */
+    int32_t current;                        /**< The IDAC current in \ref CY_CSDIDAC_CHARGE_UNIT_PA units with a sign. */
+    bool isOn;                              /**< The IDAC is enabled. */
+} cy_stc_csdidac_charge_t;
+
+/** The CSDIDAC charge report structure, that is filled by Cy_CSDIDAC_GetChargeReport(). */
+typedef struct
+{
+    int64_t charge;                         /**< The charge in \ref CY_CSDIDAC_CHARGE_UNIT_PA by timestamp ticks, positive for sourcing. */
+    uint64_t onTime;                        /**< The time with the IDAC enabled in timestamp ticks. */
+    int32_t averageCurrent;                 /**< The average current over the on-time in pA with a sign. */
+} cy_stc_csdidac_charge_report_t;
+#endif
+
+#if (0u != CY_CSDIDAC_VERIFY_EN)
+/**
+* Reports a write-verify mismatch.
+*
+* The function is called with the status CY_CSDIDAC_HW_LOCKED if the CSD HW
+* block is not locked by the CSDIDAC middleware, or CY_CSDIDAC_HW_FAILURE if
+* the read back registers do not match the written values. It is called by
+* the middleware function, that performed the failed IDAC register write,
+* after the write and after the function exits its critical section, so it
+* runs with the interrupt state of the caller, that can be an interrupt.
+* The mismatches detected before the callback is called are reported once,
+* with the status and the channel of the first of them.
+*/
+typedef void (*cy_csdidac_verify_callback_t)(cy_en_csdidac_status_t status, cy_en_csdidac_choice_t ch, void * param);
+#endif
+
 /** The CSDIDAC context structure, that contains the internal middleware data. */
 typedef struct{
     cy_stc_csdidac_config_t cfgCopy;        /**< A configuration structure copy. */
-    cy_en_csdidac_polarity_t polarityA;     /**< The current IdacA polarity. */
-    cy_en_csdidac_lsb_t lsbA;               /**< The current IdacA LSB. */
-    uint8_t codeA;                          /**< The current IdacA code. */
+    uint32_t idacRegValueA;                 /**< The last written IdacA register value, see Cy_CSDIDAC_GetOutputSettings(). */
     cy_en_csdidac_state_t channelStateA;    /**< The IDAC channel A is enabled. */
-    cy_en_csdidac_polarity_t polarityB;     /**< The current IdacB polarity. */
-    cy_en_csdidac_lsb_t lsbB;               /**< The current IdacB LSB. */
-    uint8_t codeB;                          /**< The current IdacB code. */
+    uint32_t idacRegValueB;                 /**< The last written IdacB register value, see Cy_CSDIDAC_GetOutputSettings(). */
     cy_en_csdidac_state_t channelStateB;    /**< The IDAC channel B is enabled. */
+    #if (0u != CY_CSDIDAC_MASKED_CYCLES_EN)
+        uint32_t maxMaskedCycles;           /**< The maximum number of cycles with interrupts disabled. */
+    #endif
+    #if (0u != CY_CSDIDAC_CHARGE_EN)
+        cy_stc_csdidac_charge_t chargeA;    /**< The charge accounting of the IDAC A. */
+        cy_stc_csdidac_charge_t chargeB;    /**< The charge accounting of the IDAC B. */
+    #endif
+    #if (0u != CY_CSDIDAC_VERIFY_EN)
+        cy_csdidac_verify_callback_t ptrVerifyCallback; /**< The write-verify mismatch callback. */
+        void * verifyParam;                 /**< The parameter of the write-verify mismatch callback. */
+        uint32_t verifyRatio;               /**< The number of the IDAC register writes per verification, zero if disabled. */
+        uint32_t verifyCount;               /**< The number of the IDAC register writes since the last verification. */
+        cy_en_csdidac_status_t verifyStatus; /**< The status of the first mismatch since the last status read. */
+        cy_en_csdidac_status_t verifyNotifyStatus; /**< The status of the mismatch latched for the callback, CY_CSDIDAC_SUCCESS if none. */
+        cy_en_csdidac_choice_t verifyNotifyCh; /**< The channel of the mismatch latched for the callback. */
+    #endif
+    #if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+        bool autoRouteEn;                   /**< The automatic output routing is enabled. */
+        uint32_t autoRouteIdleTicks;        /**< The number of the zero-output ticks before the disconnection, zero to disconnect immediately. */
+        uint32_t autoRouteActive;           /**< The channels that need the output routing, bit 0 for A and bit 1 for B. */
+        uint32_t autoRouteZero;             /**< The channels with the zero code written last, bit 0 for A and bit 1 for B. */
+        uint32_t autoRouteRouted;           /**< The connected outputs, bit 0 for A and bit 1 for B. */
+        uint32_t idleCountA;                /**< The number of the zero-output ticks of the channel A. */
+        uint32_t idleCountB;                /**< The number of the zero-output ticks of the channel B. */
+        uint32_t routeWriteCount;           /**< The number of the routing register writes performed by the automatic routing. */
+        uint32_t routeSavedCount;           /**< The number of the routing register writes saved by the automatic routing. */
+    #endif
 }cy_stc_csdidac_context_t;
 
 /** \} group_csdidac_data_structures */
@@ -917,6 +1314,15 @@ cy_en_csdidac_status_t Cy_CSDIDAC_OutputEnable(
                 cy_en_csdidac_choice_t ch,
                 int32_t current,
                 cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_OutputEnablePa(
+                cy_en_csdidac_choice_t ch,
+                int64_t current,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_ConvertCurrentPa(
+                int64_t current,
+                cy_en_csdidac_polarity_t * polarity,
+                cy_en_csdidac_lsb_t * lsbIndex,
+                uint32_t * idacCode);
 cy_en_csdidac_status_t Cy_CSDIDAC_OutputEnableExt(
                 cy_en_csdidac_choice_t outputCh,
                 cy_en_csdidac_polarity_t polarity,
@@ -926,10 +1332,579 @@ cy_en_csdidac_status_t Cy_CSDIDAC_OutputEnableExt(
 cy_en_csdidac_status_t Cy_CSDIDAC_OutputDisable(
                 cy_en_csdidac_choice_t ch,
                 cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_GetOutputSettings(
+                cy_en_csdidac_choice_t ch,
+                cy_en_csdidac_polarity_t * polarity,
+                cy_en_csdidac_lsb_t * lsbIndex,
+                uint32_t * idacCode,
+                const cy_stc_csdidac_context_t * context);
+#if (0u != CY_CSDIDAC_MASKED_CYCLES_EN)
+    uint32_t Cy_CSDIDAC_GetMaxMaskedCycles(
+                    const cy_stc_csdidac_context_t * context);
+    void Cy_CSDIDAC_ResetMaxMaskedCycles(
+                    cy_stc_csdidac_context_t * context);
+#endif
+#if (0u != CY_CSDIDAC_BACKEND_EN)
+    /**
+    * The hardware-access backend, that calls the PDL functions. It is used
+    * if the ptrBackend field of the configuration structure is NULL, and can
+    * be called by a user backend, e.g. a recording one, to access the hardware.
+    */
+    extern const cy_stc_csdidac_backend_t cy_csdidac_backendPdl;
+#endif
+#if (0u != CY_CSDIDAC_VERIFY_EN)
+    cy_en_csdidac_status_t Cy_CSDIDAC_SetVerify(
+                    uint32_t ratio,
+                    cy_csdidac_verify_callback_t callback,
+                    void * param,
+                    cy_stc_csdidac_context_t * context);
+    cy_en_csdidac_status_t Cy_CSDIDAC_GetVerifyStatus(
+                    cy_stc_csdidac_context_t * context);
+#endif
+#if (0u != CY_CSDIDAC_CHARGE_EN)
+    cy_en_csdidac_status_t Cy_CSDIDAC_GetChargeReport(
+                    cy_en_csdidac_choice_t ch,
+                    cy_stc_csdidac_charge_report_t * report,
+                    cy_stc_csdidac_context_t * context);
+    cy_en_csdidac_status_t Cy_CSDIDAC_ResetCharge(
+                    cy_en_csdidac_choice_t ch,
+                    cy_stc_csdidac_context_t * context);
+#endif
+#if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+    cy_en_csdidac_status_t Cy_CSDIDAC_SetAutoRoute(
+                    bool enable,
+                    uint32_t idleTicks,
+                    cy_stc_csdidac_context_t * context);
+    void Cy_CSDIDAC_AutoRouteTick(
+                    cy_stc_csdidac_context_t * context);
+    cy_en_csdidac_status_t Cy_CSDIDAC_GetAutoRouteCounters(
+                    uint32_t * routeWrites,
+                    uint32_t * savedWrites,
+                    const cy_stc_csdidac_context_t * context);
+#endif
 
 /** \} group_csdidac_functions */
 
 
+/*******************************************************************************
+* Internal Definitions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+
+/* IDAC configuration register */
+/* +--------+---------------+-------------------------------------------------------------------+
+ * |  BITS  |   FIELD       |             DEFAULT MODE                                          |
+ * |--------|---------------|-------------------------------------------------------------------|
+ * | 6:0    | VAL           | 0x00(Sets the IDAC value to "0")                                  |
+ * | 7      | POL_STATIC    | 0x00(Sets the static IDAC polarity)                               |
+ * | 9:8    | POLARITY      | 0x00(IDAC polarity SOURCE)                                        |
+ * | 11:10  | BAL_MODE      | 0x00(IDAC is enabled in PHI2 and disabled at the end of balancing)|
+ * | 17:16  | LEG1_MODE     | 0x00(Configures LEG1 to GP_static mode)                           |
+ * | 19:18  | LEG2_MODE     | 0x00(Configures LEG1 to GP_static mode)                           |
+ * | 21     | DSI_CTRL_EN   | 0x00(The IDAC DSI control is disabled)                            |
+ * | 23:22  | RANGE         | 0x00(Sets the range parameter value to low: 1LSB = 37.5 nA)       |
+ * | 24     | LEG1_EN       | 0x00(The output for LEG1 is disabled)                             |
+ * | 25     | LEG2_EN       | 0x00(The output for LEG2 is disabled)                             |
+ * +--------+---------------+-------------------------------------------------------------------+*/
+#define CY_CSDIDAC_DEFAULT_CFG                      (0x01800000uL)
+#define CY_CSDIDAC_POLARITY_POS                     (8uL)
+#define CY_CSDIDAC_POLARITY_MASK                    (3uL << CY_CSDIDAC_POLARITY_POS)
+#define CY_CSDIDAC_LSB_POS                          (22uL)
+#define CY_CSDIDAC_LSB_MASK                         (3uL << CY_CSDIDAC_LSB_POS)
+#define CY_CSDIDAC_LEG1_EN_POS                      (24uL)
+#define CY_CSDIDAC_LEG1_EN_MASK                     (1uL << CY_CSDIDAC_LEG1_EN_POS)
+#define CY_CSDIDAC_LEG2_EN_POS                      (25uL)
+#define CY_CSDIDAC_LEG2_EN_MASK                     (1uL << CY_CSDIDAC_LEG2_EN_POS)
+#define CY_CSDIDAC_RANGE_MASK                       (CY_CSDIDAC_LSB_MASK | CY_CSDIDAC_LEG1_EN_MASK | CY_CSDIDAC_LEG2_EN_MASK)
+
+/*
+* All the defines below correspond to IDAC LSB in pA
+*/
+#define CY_CSDIDAC_LSB_37                           (  37500u)
+#define CY_CSDIDAC_LSB_75                           (  75000u)
+#define CY_CSDIDAC_LSB_300                          ( 300000u)
+#define CY_CSDIDAC_LSB_600                          ( 600000u)
+#define CY_CSDIDAC_LSB_2400                         (2400000u)
+#define CY_CSDIDAC_LSB_4800                         (4800000u)
+
+#define CY_CSDIDAC_LSB_37_MAX_CURRENT             (  4762500u)
+#define CY_CSDIDAC_LSB_75_MAX_CURRENT             (  9525000u)
+#define CY_CSDIDAC_LSB_300_MAX_CURRENT            ( 38100000u)
+#define CY_CSDIDAC_LSB_600_MAX_CURRENT            ( 76200000u)
+#define CY_CSDIDAC_LSB_2400_MAX_CURRENT           (304800000u)
+#define CY_CSDIDAC_LSB_4800_MAX_CURRENT           (609600000u)
+
+/* The number of the IDAC LSB ranges */
+#define CY_CSDIDAC_LSB_NUM                          (6u)
+
+/* The IDAC LSB values in pA indexed by cy_en_csdidac_lsb_t */
+extern const uint32_t cy_csdidac_lsbPa[CY_CSDIDAC_LSB_NUM];
+/* The IDAC maximum currents in pA indexed by cy_en_csdidac_lsb_t */
+extern const uint32_t cy_csdidac_lsbMaxCurrentPa[CY_CSDIDAC_LSB_NUM];
+
+/* The measurement of the interrupt-masked regions */
+#if (0u != CY_CSDIDAC_MASKED_CYCLES_EN)
+    #define CY_CSDIDAC_MASKED_CYCLES_DECL           uint32_t maskedCyclesStart;
+    #define CY_CSDIDAC_MASKED_CYCLES_START          maskedCyclesStart = CY_CSDIDAC_GET_CYCLE_COUNT();
+    #define CY_CSDIDAC_MASKED_CYCLES_STOP(cxt)      Cy_CSDIDAC_UpdateMaskedCycles(maskedCyclesStart, (cxt));
+#else
+    #define CY_CSDIDAC_MASKED_CYCLES_DECL
+    #define CY_CSDIDAC_MASKED_CYCLES_START
+    #define CY_CSDIDAC_MASKED_CYCLES_STOP(cxt)
+#endif
+
+/* The report of the write-verify mismatches latched with interrupts disabled */
+#if (0u != CY_CSDIDAC_VERIFY_EN)
+    #define CY_CSDIDAC_VERIFY_NOTIFY(cxt)           Cy_CSDIDAC_VerifyNotify(cxt);
+#else
+    #define CY_CSDIDAC_VERIFY_NOTIFY(cxt)
+#endif
+
+/* The hardware access of the middleware and its modules */
+#if (0u != CY_CSDIDAC_BACKEND_EN)
+    #define CY_CSDIDAC_BACKEND(cxt)                 ((cxt)->cfgCopy.ptrBackend)
+    #define CY_CSDIDAC_BACKEND_PARAM(cxt)           ((cxt)->cfgCopy.backendParam)
+    #define CY_CSDIDAC_CSD_INIT(cxt, config, key) \
+        (CY_CSDIDAC_BACKEND(cxt)->csdInit(CY_CSDIDAC_BACKEND_PARAM(cxt), (cxt)->cfgCopy.base, (config), (key), (cxt)->cfgCopy.csdCxtPtr))
+    #define CY_CSDIDAC_CSD_DEINIT(cxt, key) \
+        (CY_CSDIDAC_BACKEND(cxt)->csdDeInit(CY_CSDIDAC_BACKEND_PARAM(cxt), (cxt)->cfgCopy.base, (key), (cxt)->cfgCopy.csdCxtPtr))
+    #define CY_CSDIDAC_CSD_GET_LOCK_STATUS(cxt) \
+        (CY_CSDIDAC_BACKEND(cxt)->csdGetLockStatus(CY_CSDIDAC_BACKEND_PARAM(cxt), (cxt)->cfgCopy.base, (cxt)->cfgCopy.csdCxtPtr))
+    #define CY_CSDIDAC_CSD_GET_CONVERSION_STATUS(cxt) \
+        (CY_CSDIDAC_BACKEND(cxt)->csdGetConversionStatus(CY_CSDIDAC_BACKEND_PARAM(cxt), (cxt)->cfgCopy.base, (cxt)->cfgCopy.csdCxtPtr))
+    #define CY_CSDIDAC_CSD_READ_REG(cxt, offset) \
+        (CY_CSDIDAC_BACKEND(cxt)->csdReadReg(CY_CSDIDAC_BACKEND_PARAM(cxt), (cxt)->cfgCopy.base, (offset)))
+    #define CY_CSDIDAC_CSD_WRITE_REG(cxt, offset, value) \
+        (CY_CSDIDAC_BACKEND(cxt)->csdWriteReg(CY_CSDIDAC_BACKEND_PARAM(cxt), (cxt)->cfgCopy.base, (offset), (value)))
+    #define CY_CSDIDAC_CSD_SET_BITS(cxt, offset, mask) \
+        (CY_CSDIDAC_BACKEND(cxt)->csdSetBits(CY_CSDIDAC_BACKEND_PARAM(cxt), (cxt)->cfgCopy.base, (offset), (mask)))
+    #define CY_CSDIDAC_CSD_CLR_BITS(cxt, offset, mask) \
+        (CY_CSDIDAC_BACKEND(cxt)->csdClrBits(CY_CSDIDAC_BACKEND_PARAM(cxt), (cxt)->cfgCopy.base, (offset), (mask)))
+    #define CY_CSDIDAC_GPIO_SET_DRIVEMODE(cxt, port, pinNum, value) \
+        (CY_CSDIDAC_BACKEND(cxt)->gpioSetDrivemode(CY_CSDIDAC_BACKEND_PARAM(cxt), (port), (pinNum), (value)))
+    #define CY_CSDIDAC_GPIO_GET_DRIVEMODE(cxt, port, pinNum) \
+        (CY_CSDIDAC_BACKEND(cxt)->gpioGetDrivemode(CY_CSDIDAC_BACKEND_PARAM(cxt), (port), (pinNum)))
+    #define CY_CSDIDAC_GPIO_SET_HSIOM(cxt, port, pinNum, value) \
+        (CY_CSDIDAC_BACKEND(cxt)->gpioSetHsiom(CY_CSDIDAC_BACKEND_PARAM(cxt), (port), (pinNum), (value)))
+    #define CY_CSDIDAC_GPIO_GET_HSIOM(cxt, port, pinNum) \
+        (CY_CSDIDAC_BACKEND(cxt)->gpioGetHsiom(CY_CSDIDAC_BACKEND_PARAM(cxt), (port), (pinNum)))
+    #define CY_CSDIDAC_DELAY_US(cxt, microseconds) \
+        (CY_CSDIDAC_BACKEND(cxt)->delayUs(CY_CSDIDAC_BACKEND_PARAM(cxt), (microseconds)))
+    #define CY_CSDIDAC_ENTER_CRITICAL_SECTION(cxt) \
+        (CY_CSDIDAC_BACKEND(cxt)->enterCriticalSection(CY_CSDIDAC_BACKEND_PARAM(cxt)))
+    #define CY_CSDIDAC_EXIT_CRITICAL_SECTION(cxt, savedIntrStatus) \
+        (CY_CSDIDAC_BACKEND(cxt)->exitCriticalSection(CY_CSDIDAC_BACKEND_PARAM(cxt), (savedIntrStatus)))
+#else
+    #define CY_CSDIDAC_CSD_INIT(cxt, config, key) \
+        (Cy_CSD_Init((cxt)->cfgCopy.base, (config), (key), (cxt)->cfgCopy.csdCxtPtr))
+    #define CY_CSDIDAC_CSD_DEINIT(cxt, key) \
+        (Cy_CSD_DeInit((cxt)->cfgCopy.base, (key), (cxt)->cfgCopy.csdCxtPtr))
+    #define CY_CSDIDAC_CSD_GET_LOCK_STATUS(cxt) \
+        (Cy_CSD_GetLockStatus((cxt)->cfgCopy.base, (cxt)->cfgCopy.csdCxtPtr))
+    #define CY_CSDIDAC_CSD_GET_CONVERSION_STATUS(cxt) \
+        (Cy_CSD_GetConversionStatus((cxt)->cfgCopy.base, (cxt)->cfgCopy.csdCxtPtr))
+    #define CY_CSDIDAC_CSD_READ_REG(cxt, offset) \
+        (Cy_CSD_ReadReg((cxt)->cfgCopy.base, (offset)))
+    #define CY_CSDIDAC_CSD_WRITE_REG(cxt, offset, value) \
+        (Cy_CSD_WriteReg((cxt)->cfgCopy.base, (offset), (value)))
+    #define CY_CSDIDAC_CSD_SET_BITS(cxt, offset, mask) \
+        (Cy_CSD_SetBits((cxt)->cfgCopy.base, (offset), (mask)))
+    #define CY_CSDIDAC_CSD_CLR_BITS(cxt, offset, mask) \
+        (Cy_CSD_ClrBits((cxt)->cfgCopy.base, (offset), (mask)))
+    #define CY_CSDIDAC_GPIO_SET_DRIVEMODE(cxt, port, pinNum, value) \
+        (Cy_GPIO_SetDrivemode((port), (pinNum), (value)))
+    #define CY_CSDIDAC_GPIO_GET_DRIVEMODE(cxt, port, pinNum) \
+        (Cy_GPIO_GetDrivemode((port), (pinNum)))
+    #define CY_CSDIDAC_GPIO_SET_HSIOM(cxt, port, pinNum, value) \
+        (Cy_GPIO_SetHSIOM((port), (pinNum), (value)))
+    #define CY_CSDIDAC_GPIO_GET_HSIOM(cxt, port, pinNum) \
+        (Cy_GPIO_GetHSIOM((port), (pinNum)))
+    #define CY_CSDIDAC_DELAY_US(cxt, microseconds) \
+        (Cy_SysLib_DelayUs(microseconds))
+    #define CY_CSDIDAC_ENTER_CRITICAL_SECTION(cxt) \
+        (Cy_SysLib_EnterCriticalSection())
+    #define CY_CSDIDAC_EXIT_CRITICAL_SECTION(cxt, savedIntrStatus) \
+        (Cy_SysLib_ExitCriticalSection(savedIntrStatus))
+#endif
+
+cy_en_csdidac_status_t Cy_CSDIDAC_Capture(
+                const cy_stc_csdidac_config_t * config,
+                cy_stc_csdidac_context_t * context);
+void Cy_CSDIDAC_ConvertCurrent(
+                int32_t current,
+                cy_en_csdidac_polarity_t * polarity,
+                cy_en_csdidac_lsb_t * lsbIndex,
+                uint32_t * idacCode);
+cy_en_csdidac_status_t Cy_CSDIDAC_OutputEnableReg(
+                cy_en_csdidac_choice_t outputCh,
+                uint32_t idacRegValue,
+                bool connectPins,
+                cy_stc_csdidac_context_t * context);
+#if (0u != CY_CSDIDAC_VERIFY_EN)
+void Cy_CSDIDAC_VerifyWrite(
+                cy_en_csdidac_choice_t ch,
+                uint32_t idacRegValue,
+                cy_stc_csdidac_context_t * context);
+void Cy_CSDIDAC_VerifyNotify(
+                cy_stc_csdidac_context_t * context);
+#endif
+#if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+void Cy_CSDIDAC_AutoRouteWrite(
+                cy_en_csdidac_choice_t ch,
+                uint32_t idacRegValue,
+                cy_stc_csdidac_context_t * context);
+#endif
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_GetIdacRegValue
+****************************************************************************//**
+*
+* Composes the IDAC register value for the specified polarity, LSB, and code.
+*
+* The function does not verify the input parameters. It is used by the
+* middleware modules to precompute the register values out of the time
+* critical paths.
+*
+* \param polarity
+* The polarity of the IDAC output.
+*
+* \param lsbIndex
+* The LSB of the IDAC output.
+*
+* \param idacCode
+* The code value in the range from 0u to \ref CY_CSDIDAC_MAX_CODE.
+*
+* \return
+* The IDACA / IDACB register value.
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t Cy_CSDIDAC_GetIdacRegValue(
+                cy_en_csdidac_polarity_t polarity,
+                cy_en_csdidac_lsb_t lsbIndex,
+                uint32_t idacCode)
+{
+    uint32_t idacRegValue = idacCode | (((uint32_t)polarity) << CY_CSDIDAC_POLARITY_POS);
+
+    /* Sets IDAC LSB. The LSB value equals lsbIndex divided by 2 */
+    idacRegValue |= ((((uint32_t)lsbIndex) >> 1uL) << CY_CSDIDAC_LSB_POS);
+    /* Sets the IDAC leg1 enabling bit */
+    idacRegValue |= ((uint32_t)CY_CSDIDAC_LEG1_EN_MASK);
+    /* Sets the IDAC leg2 enabling bit if the lsbIndex is odd. */
+    if (0u != (((uint32_t)lsbIndex) & 1uL))
+    {
+        idacRegValue |= ((uint32_t)CY_CSDIDAC_LEG2_EN_MASK);
+    }
+
+    return (idacRegValue);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_GetIdacRegLsb
+****************************************************************************//**
+*
+* Returns the LSB index of the IDAC register value composed by
+* Cy_CSDIDAC_GetIdacRegValue().
+*
+* \param idacRegValue
+* The IDACA / IDACB register value.
+*
+* \return
+* The LSB index of \ref cy_en_csdidac_lsb_t.
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t Cy_CSDIDAC_GetIdacRegLsb(uint32_t idacRegValue)
+{
+    /* The LSB field is the index divided by 2 and the leg2 enabling bit is the index parity */
+    return (((idacRegValue & CY_CSDIDAC_LSB_MASK) >> (CY_CSDIDAC_LSB_POS - 1u)) |
+            ((idacRegValue & CY_CSDIDAC_LEG2_EN_MASK) >> CY_CSDIDAC_LEG2_EN_POS));
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_GetIdacRegPolarity
+****************************************************************************//**
+*
+* Returns the polarity of the IDAC register value composed by
+* Cy_CSDIDAC_GetIdacRegValue().
+*
+* \param idacRegValue
+* The IDACA / IDACB register value.
+*
+* \return
+* The polarity of \ref cy_en_csdidac_polarity_t.
+*
+*******************************************************************************/
+__STATIC_INLINE cy_en_csdidac_polarity_t Cy_CSDIDAC_GetIdacRegPolarity(uint32_t idacRegValue)
+{
+    return ((cy_en_csdidac_polarity_t)((idacRegValue & CY_CSDIDAC_POLARITY_MASK) >> CY_CSDIDAC_POLARITY_POS));
+}
+
+
+#if (0u != CY_CSDIDAC_CHARGE_EN)
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_AccumulateCharge
+****************************************************************************//**
+*
+* Integrates the channel current over the time elapsed since the last update.
+* The timestamp difference is calculated modulo 2^32, so the update or
+* the query of the channel must be performed at least once per timestamp
+* counter period.
+*
+* \param ptrCharge
+* The pointer to the charge accounting structure of the channel.
+*
+* \param timestamp
+* The current timestamp.
+*
+*******************************************************************************/
+__STATIC_INLINE void Cy_CSDIDAC_AccumulateCharge(
+                cy_stc_csdidac_charge_t * ptrCharge,
+                uint32_t timestamp)
+{
+    uint32_t elapsed = timestamp - ptrCharge->timestamp;
+
+    ptrCharge->charge += (int64_t)ptrCharge->current * (int64_t)elapsed;
+    if (true == ptrCharge->isOn)
+    {
+        ptrCharge->onTime += elapsed;
+    }
+    ptrCharge->timestamp = timestamp;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_UpdateCharge
+****************************************************************************//**
+*
+* Closes the charge accounting interval of the previous IDAC register value
+* and starts the interval of the new one. The current of the register value
+* is (code << (lsb + lsb / 2)) in \ref CY_CSDIDAC_CHARGE_UNIT_PA units.
+*
+* \param ch
+* The channel to update: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param idacRegValue
+* The new IDAC register value.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+__STATIC_INLINE void Cy_CSDIDAC_UpdateCharge(
+                cy_en_csdidac_choice_t ch,
+                uint32_t idacRegValue,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_stc_csdidac_charge_t * ptrCharge = (CY_CSDIDAC_A == ch) ? &context->chargeA : &context->chargeB;
+    uint32_t lsbIndex = Cy_CSDIDAC_GetIdacRegLsb(idacRegValue);
+    int32_t current = (int32_t)((idacRegValue & CY_CSDIDAC_MAX_CODE) << (lsbIndex + (lsbIndex >> 1u)));
+
+    Cy_CSDIDAC_AccumulateCharge(ptrCharge, (uint32_t)CY_CSDIDAC_GET_TIMESTAMP());
+    ptrCharge->current = (0u != (idacRegValue & CY_CSDIDAC_POLARITY_MASK)) ? -current : current;
+    ptrCharge->isOn = (0u != (idacRegValue & CY_CSDIDAC_LEG1_EN_MASK));
+}
+#endif
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_StoreIdacReg
+****************************************************************************//**
+*
+* Caches the precomputed value in the context structure with one store, that
+* is decoded on demand by Cy_CSDIDAC_GetOutputSettings(), and writes it to
+* the IDAC register of the specified channel.
+*
+* The function performs only the register store, so it is called
+* with interrupts disabled by Cy_CSDIDAC_OutputEnableReg(), that updates
+* the charge accounting, the automatic routing, and the write verification
+* outside of its critical section.
+*
+* \param ch
+* The channel to update: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param idacRegValue
+* The IDAC register value composed by Cy_CSDIDAC_GetIdacRegValue().
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+__STATIC_INLINE void Cy_CSDIDAC_StoreIdacReg(
+                cy_en_csdidac_choice_t ch,
+                uint32_t idacRegValue,
+                cy_stc_csdidac_context_t * context)
+{
+    if (CY_CSDIDAC_A == ch)
+    {
+        context->idacRegValueA = idacRegValue;
+    }
+    else
+    {
+        context->idacRegValueB = idacRegValue;
+    }
+    CY_CSDIDAC_CSD_WRITE_REG(context,
+                             (CY_CSDIDAC_A == ch) ? CY_CSD_REG_OFFSET_IDACA : CY_CSD_REG_OFFSET_IDACB,
+                             idacRegValue);
+}
+
+
+#if (0u != CY_CSDIDAC_VERIFY_EN)
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_VerifyIdacReg
+****************************************************************************//**
+*
+* Counts the IDAC register write and verifies it by Cy_CSDIDAC_VerifyWrite()
+* at the sampling ratio set by Cy_CSDIDAC_SetVerify().
+*
+* \param ch
+* The written channel: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param idacRegValue
+* The written IDAC register value.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+__STATIC_INLINE void Cy_CSDIDAC_VerifyIdacReg(
+                cy_en_csdidac_choice_t ch,
+                uint32_t idacRegValue,
+                cy_stc_csdidac_context_t * context)
+{
+    if (0u != context->verifyRatio)
+    {
+        context->verifyCount++;
+        if (context->verifyCount >= context->verifyRatio)
+        {
+            context->verifyCount = 0u;
+            Cy_CSDIDAC_VerifyWrite(ch, idacRegValue, context);
+        }
+    }
+}
+#endif
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_WriteIdacRegMasked
+****************************************************************************//**
+*
+* Writes the precomputed value to the IDAC register of the specified channel
+* with interrupts disabled by the caller.
+*
+* The function does not verify the input parameters and does not connect
+* the channel output. It is the single point of the IDAC register update
+* used by the time critical paths of the middleware modules, so it also
+* caches the written value by Cy_CSDIDAC_StoreIdacReg(), updates the charge
+* accounting if \ref CY_CSDIDAC_CHARGE_EN is enabled,
+* connects or disconnects the channel output if the automatic routing of
+* \ref CY_CSDIDAC_AUTOROUTE_EN is enabled, and verifies the write if
+* \ref CY_CSDIDAC_VERIFY_EN is enabled. A verification mismatch is only
+* latched in the context structure: the caller reports it by
+* CY_CSDIDAC_VERIFY_NOTIFY() after interrupts are enabled again.
+*
+* \param ch
+* The channel to update: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param idacRegValue
+* The IDAC register value composed by Cy_CSDIDAC_GetIdacRegValue().
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+__STATIC_INLINE void Cy_CSDIDAC_WriteIdacRegMasked(
+                cy_en_csdidac_choice_t ch,
+                uint32_t idacRegValue,
+                cy_stc_csdidac_context_t * context)
+{
+    #if (0u != CY_CSDIDAC_CHARGE_EN)
+        Cy_CSDIDAC_UpdateCharge(ch, idacRegValue, context);
+    #endif
+    #if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+        if (true == context->autoRouteEn)
+        {
+            Cy_CSDIDAC_AutoRouteWrite(ch, idacRegValue, context);
+        }
+    #endif
+    Cy_CSDIDAC_StoreIdacReg(ch, idacRegValue, context);
+    #if (0u != CY_CSDIDAC_VERIFY_EN)
+        Cy_CSDIDAC_VerifyIdacReg(ch, idacRegValue, context);
+    #endif
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_WriteIdacReg
+****************************************************************************//**
+*
+* Writes the precomputed value to the IDAC register of the specified channel.
+*
+* The function performs the write by Cy_CSDIDAC_WriteIdacRegMasked() and
+* reports a verification mismatch to the callback right after it, so it is
+* used outside of the critical sections of the middleware.
+*
+* \param ch
+* The channel to update: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param idacRegValue
+* The IDAC register value composed by Cy_CSDIDAC_GetIdacRegValue().
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+__STATIC_INLINE void Cy_CSDIDAC_WriteIdacReg(
+                cy_en_csdidac_choice_t ch,
+                uint32_t idacRegValue,
+                cy_stc_csdidac_context_t * context)
+{
+    Cy_CSDIDAC_WriteIdacRegMasked(ch, idacRegValue, context);
+    CY_CSDIDAC_VERIFY_NOTIFY(context)
+}
+
+#if (0u != CY_CSDIDAC_MASKED_CYCLES_EN)
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_UpdateMaskedCycles
+****************************************************************************//**
+*
+* Updates the maximum number of cycles with interrupts disabled.
+*
+* \param startCycles
+* The cycle counter value captured after interrupts are disabled.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+__STATIC_INLINE void Cy_CSDIDAC_UpdateMaskedCycles(
+                uint32_t startCycles,
+                cy_stc_csdidac_context_t * context)
+{
+    uint32_t cycles = (uint32_t)CY_CSDIDAC_GET_CYCLE_COUNT() - startCycles;
+
+    if (cycles > context->maxMaskedCycles)
+    {
+        context->maxMaskedCycles = cycles;
+    }
+}
+#endif
+
+/** \}
+* \endcond */
+
+
 /*******************************************************************************
 * Function Name: Cy_CSDIDAC_IsIdacLsbValid
 ****************************************************************************//**
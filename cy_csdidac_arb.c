@@ -0,0 +1,675 @@
+/***************************************************************************//**
+* \file cy_csdidac_arb.c
+* \version 2.20
+*
+* \brief
+* This file provides the implementation of the multi-client setpoint
+* arbitration of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_arb.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static uint32_t Cy_CSDIDAC_ArbGetHighestClient(uint32_t mask);
+static bool Cy_CSDIDAC_ArbIsAbove(
+                uint32_t client,
+                uint32_t absCurrent,
+                const cy_stc_csdidac_arb_t * arb);
+static void Cy_CSDIDAC_ArbFindMax(cy_stc_csdidac_arb_t * arb);
+static void Cy_CSDIDAC_ArbSetClient(
+                uint32_t client,
+                int32_t current,
+                bool active,
+                cy_stc_csdidac_arb_t * arb);
+static void Cy_CSDIDAC_ArbUpdate(cy_stc_csdidac_arb_t * arb);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+#define CY_CSDIDAC_ARB_CLIENT_MSK(client)       ((uint32_t)1u << (client))
+#define CY_CSDIDAC_ARB_MAX_SUM                  ((int32_t)CY_CSDIDAC_MAX_CURRENT_NA)
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ArbInit
+****************************************************************************//**
+*
+* Initializes the arbiter of the setpoints of several clients that drive
+* the same channel.
+*
+* Each client is identified by its unique priority in the range from 0 to
+* \ref CY_CSDIDAC_ARB_MAX_CLIENTS - 1, the larger value is the higher
+* priority. The effective setpoint is calculated by the policy:
+* * CY_CSDIDAC_ARB_PRIORITY - The setpoint of the active client of the highest
+*                             priority.
+* * CY_CSDIDAC_ARB_MAX      - The setpoint of the largest magnitude. On equal
+*                             magnitudes the higher priority wins.
+* * CY_CSDIDAC_ARB_SUM      - The sum of the active setpoints clamped at
+*                             \ref CY_CSDIDAC_MAX_CURRENT_NA in both polarities.
+*
+* The effective setpoint is zero when no client requests a current.
+*
+* The CSDIDAC middleware must be initialized by Cy_CSDIDAC_Init() prior
+* to calling this function.
+*
+* \param ch
+* The arbitrated channel: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param policy
+* The arbitration policy \ref cy_en_csdidac_arb_policy_t.
+*
+* \param arb
+* The pointer to the arbiter structure \ref cy_stc_csdidac_arb_t allocated
+* by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbInit(
+                cy_en_csdidac_choice_t ch,
+                cy_en_csdidac_arb_policy_t policy,
+                cy_stc_csdidac_arb_t * arb,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t client;
+
+    if ((NULL != arb) && (NULL != context) && (CY_CSDIDAC_AB != ch) && (CY_CSDIDAC_ARB_SUM >= policy))
+    {
+        if (true == Cy_CSDIDAC_IsIdacChoiceValid(ch, context->cfgCopy.configA, context->cfgCopy.configB))
+        {
+            arb->ptrCsdidacCxt = context;
+            arb->ch = ch;
+            arb->policy = policy;
+            for (client = 0u; client < CY_CSDIDAC_ARB_MAX_CLIENTS; client++)
+            {
+                arb->current[client] = 0;
+            }
+            arb->registered = 0u;
+            arb->active = 0u;
+            arb->sum = 0;
+            arb->maxClient = 0u;
+            arb->effective = 0;
+            arb->idacRegValue = 0u;
+            arb->writeCount = 0u;
+            arb->busy = false;
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ArbStart
+****************************************************************************//**
+*
+* Enables the output and sets the effective setpoint of the clients.
+*
+* The clients can register and request the setpoints before and after
+* the start. The IDAC register is written only while the arbiter is started.
+*
+* \param arb
+* The pointer to the arbiter structure \ref cy_stc_csdidac_arb_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or the channel is
+*                           disabled.
+* * CY_CSDIDAC_HW_LOCKED  - The CSD HW block is not captured by the CSDIDAC.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbStart(
+                cy_stc_csdidac_arb_t * arb)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t idacCode;
+    uint32_t interruptState;
+
+    if (NULL != arb)
+    {
+        arb->busy = false;
+        retVal = Cy_CSDIDAC_OutputEnableExt(arb->ch, CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u, arb->ptrCsdidacCxt);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(arb->ptrCsdidacCxt);
+            Cy_CSDIDAC_ConvertCurrent(arb->effective, &polarity, &lsbIndex, &idacCode);
+            arb->idacRegValue = Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, idacCode);
+            Cy_CSDIDAC_WriteIdacRegMasked(arb->ch, arb->idacRegValue, arb->ptrCsdidacCxt);
+            arb->writeCount++;
+            arb->busy = true;
+            CY_CSDIDAC_EXIT_CRITICAL_SECTION(arb->ptrCsdidacCxt, interruptState);
+            CY_CSDIDAC_VERIFY_NOTIFY(arb->ptrCsdidacCxt)
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ArbRegister
+****************************************************************************//**
+*
+* Registers a client of the specified priority.
+*
+* The priority is the handle of the client in the other arbiter functions.
+* The registered client does not affect the effective setpoint until it
+* requests a current by Cy_CSDIDAC_ArbRequest().
+*
+* \param priority
+* The client priority in the range from 0 to
+* \ref CY_CSDIDAC_ARB_MAX_CLIENTS - 1.
+*
+* \param arb
+* The pointer to the arbiter structure \ref cy_stc_csdidac_arb_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL, the priority is out of
+*                           range or it is already registered.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbRegister(
+                uint32_t priority,
+                cy_stc_csdidac_arb_t * arb)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t interruptState;
+
+    if ((NULL != arb) && (CY_CSDIDAC_ARB_MAX_CLIENTS > priority))
+    {
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(arb->ptrCsdidacCxt);
+        if (0u == (arb->registered & CY_CSDIDAC_ARB_CLIENT_MSK(priority)))
+        {
+            arb->registered |= CY_CSDIDAC_ARB_CLIENT_MSK(priority);
+            arb->current[priority] = 0;
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(arb->ptrCsdidacCxt, interruptState);
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ArbUnregister
+****************************************************************************//**
+*
+* Releases the setpoint of the client and unregisters it.
+*
+* \param priority
+* The priority of the registered client.
+*
+* \param arb
+* The pointer to the arbiter structure \ref cy_stc_csdidac_arb_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or the client is not
+*                           registered.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbUnregister(
+                uint32_t priority,
+                cy_stc_csdidac_arb_t * arb)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t interruptState;
+
+    if ((NULL != arb) && (CY_CSDIDAC_ARB_MAX_CLIENTS > priority))
+    {
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(arb->ptrCsdidacCxt);
+        if (0u != (arb->registered & CY_CSDIDAC_ARB_CLIENT_MSK(priority)))
+        {
+            Cy_CSDIDAC_ArbSetClient(priority, 0, false, arb);
+            arb->registered &= ~CY_CSDIDAC_ARB_CLIENT_MSK(priority);
+            Cy_CSDIDAC_ArbUpdate(arb);
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(arb->ptrCsdidacCxt, interruptState);
+        CY_CSDIDAC_VERIFY_NOTIFY(arb->ptrCsdidacCxt)
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ArbRequest
+****************************************************************************//**
+*
+* Sets the setpoint of the client and updates the effective setpoint.
+*
+* The effective setpoint is updated incrementally in a critical section, so
+* the function can be called from the different interrupt service routines
+* or RTOS tasks. The cost of the update does not depend on the number of
+* the clients, except for the CY_CSDIDAC_ARB_MAX policy when the client of
+* the largest magnitude decreases its setpoint. Then the other active clients
+* are scanned once. The IDAC register is written only when the effective
+* setpoint changes the register value.
+*
+* \param priority
+* The priority of the registered client.
+*
+* \param current
+* The client setpoint in nA with a sign: the positive value is the source and
+* the negative value is the sink. The magnitude must not exceed
+* \ref CY_CSDIDAC_MAX_CURRENT_NA.
+*
+* \param arb
+* The pointer to the arbiter structure \ref cy_stc_csdidac_arb_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL, the client is not
+*                           registered or the current is out of range.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbRequest(
+                uint32_t priority,
+                int32_t current,
+                cy_stc_csdidac_arb_t * arb)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t absCurrent = (0 > current) ? (0u - (uint32_t)current) : (uint32_t)current;
+    uint32_t interruptState;
+
+    if ((NULL != arb) && (CY_CSDIDAC_ARB_MAX_CLIENTS > priority) && (CY_CSDIDAC_MAX_CURRENT_NA >= absCurrent))
+    {
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(arb->ptrCsdidacCxt);
+        if (0u != (arb->registered & CY_CSDIDAC_ARB_CLIENT_MSK(priority)))
+        {
+            Cy_CSDIDAC_ArbSetClient(priority, current, true, arb);
+            Cy_CSDIDAC_ArbUpdate(arb);
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(arb->ptrCsdidacCxt, interruptState);
+        CY_CSDIDAC_VERIFY_NOTIFY(arb->ptrCsdidacCxt)
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ArbRelease
+****************************************************************************//**
+*
+* Withdraws the setpoint of the client and updates the effective setpoint.
+*
+* The client stays registered. Unlike the request of the zero current,
+* the released client does not take part in the arbitration, so the
+* CY_CSDIDAC_ARB_PRIORITY policy selects the next active client.
+*
+* \param priority
+* The priority of the registered client.
+*
+* \param arb
+* The pointer to the arbiter structure \ref cy_stc_csdidac_arb_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or the client is not
+*                           registered.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbRelease(
+                uint32_t priority,
+                cy_stc_csdidac_arb_t * arb)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t interruptState;
+
+    if ((NULL != arb) && (CY_CSDIDAC_ARB_MAX_CLIENTS > priority))
+    {
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(arb->ptrCsdidacCxt);
+        if (0u != (arb->registered & CY_CSDIDAC_ARB_CLIENT_MSK(priority)))
+        {
+            Cy_CSDIDAC_ArbSetClient(priority, 0, false, arb);
+            Cy_CSDIDAC_ArbUpdate(arb);
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(arb->ptrCsdidacCxt, interruptState);
+        CY_CSDIDAC_VERIFY_NOTIFY(arb->ptrCsdidacCxt)
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ArbGetEffective
+****************************************************************************//**
+*
+* Returns the effective setpoint of the arbiter.
+*
+* \param arb
+* The pointer to the arbiter structure \ref cy_stc_csdidac_arb_t.
+*
+* \return
+* The effective setpoint in nA with a sign or zero if the input pointer
+* is NULL.
+*
+*******************************************************************************/
+int32_t Cy_CSDIDAC_ArbGetEffective(
+                const cy_stc_csdidac_arb_t * arb)
+{
+    int32_t retVal = 0;
+
+    if (NULL != arb)
+    {
+        retVal = arb->effective;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ArbStop
+****************************************************************************//**
+*
+* Disables the output. The client setpoints are kept and applied by
+* the next Cy_CSDIDAC_ArbStart() call.
+*
+* \param arb
+* The pointer to the arbiter structure \ref cy_stc_csdidac_arb_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbStop(
+                cy_stc_csdidac_arb_t * arb)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != arb)
+    {
+        arb->busy = false;
+        retVal = Cy_CSDIDAC_OutputDisable(arb->ch, arb->ptrCsdidacCxt);
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ArbGetHighestClient
+****************************************************************************//**
+*
+* Returns the index of the most significant set bit of the non-zero mask in
+* a constant number of steps.
+*
+* \param mask
+* The non-zero bit mask of the clients.
+*
+* \return
+* The highest client of the mask.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDIDAC_ArbGetHighestClient(uint32_t mask)
+{
+    uint32_t client = 0u;
+    uint32_t shift;
+
+    for (shift = 16u; 0u != shift; shift >>= 1u)
+    {
+        if (0u != (mask >> shift))
+        {
+            mask >>= shift;
+            client += shift;
+        }
+    }
+
+    return (client);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ArbIsAbove
+****************************************************************************//**
+*
+* Checks whether the client with the specified magnitude wins over
+* the current maximum client of the CY_CSDIDAC_ARB_MAX policy.
+*
+* \param client
+* The client priority.
+*
+* \param absCurrent
+* The magnitude of the client setpoint in nA.
+*
+* \param arb
+* The pointer to the arbiter structure.
+*
+* \return
+* True if the client wins.
+*
+*******************************************************************************/
+static bool Cy_CSDIDAC_ArbIsAbove(
+                uint32_t client,
+                uint32_t absCurrent,
+                const cy_stc_csdidac_arb_t * arb)
+{
+    int32_t maxCurrent = arb->current[arb->maxClient];
+    uint32_t absMax = (0 > maxCurrent) ? (uint32_t)(-maxCurrent) : (uint32_t)maxCurrent;
+
+    return ((absCurrent > absMax) || ((absCurrent == absMax) && (client > arb->maxClient)));
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ArbFindMax
+****************************************************************************//**
+*
+* Scans the active clients for the largest setpoint magnitude.
+*
+* \param arb
+* The pointer to the arbiter structure.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_ArbFindMax(cy_stc_csdidac_arb_t * arb)
+{
+    uint32_t mask = arb->active;
+    uint32_t client;
+    int32_t current;
+
+    if (0u != mask)
+    {
+        arb->maxClient = Cy_CSDIDAC_ArbGetHighestClient(mask);
+        mask &= ~CY_CSDIDAC_ARB_CLIENT_MSK(arb->maxClient);
+        while (0u != mask)
+        {
+            client = Cy_CSDIDAC_ArbGetHighestClient(mask);
+            mask &= ~CY_CSDIDAC_ARB_CLIENT_MSK(client);
+            current = arb->current[client];
+            if (true == Cy_CSDIDAC_ArbIsAbove(client, (0 > current) ? (uint32_t)(-current) : (uint32_t)current, arb))
+            {
+                arb->maxClient = client;
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ArbSetClient
+****************************************************************************//**
+*
+* Updates the setpoint of the client and the incremental state of
+* the arbitration: the sum of the setpoints and the maximum client.
+*
+* \param client
+* The client priority.
+*
+* \param current
+* The new client setpoint in nA. Ignored if the client is released.
+*
+* \param active
+* The client requests the current, otherwise it is released.
+*
+* \param arb
+* The pointer to the arbiter structure.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_ArbSetClient(
+                uint32_t client,
+                int32_t current,
+                bool active,
+                cy_stc_csdidac_arb_t * arb)
+{
+    uint32_t clientMsk = CY_CSDIDAC_ARB_CLIENT_MSK(client);
+    uint32_t absCurrent;
+    int32_t oldCurrent = arb->current[client];
+    uint32_t absOld = (0 > oldCurrent) ? (uint32_t)(-oldCurrent) : (uint32_t)oldCurrent;
+    bool wasActive = (0u != (arb->active & clientMsk));
+
+    if (false == active)
+    {
+        current = 0;
+    }
+    absCurrent = (0 > current) ? (uint32_t)(-current) : (uint32_t)current;
+
+    /* The released client has the zero setpoint, so the sum is updated the same way */
+    arb->sum += current - oldCurrent;
+    arb->current[client] = current;
+
+    if (true == active)
+    {
+        arb->active |= clientMsk;
+    }
+    else
+    {
+        arb->active &= ~clientMsk;
+    }
+
+    if (CY_CSDIDAC_ARB_MAX == arb->policy)
+    {
+        if ((true == wasActive) && (client == arb->maxClient) && ((false == active) || (absCurrent < absOld)))
+        {
+            Cy_CSDIDAC_ArbFindMax(arb);
+        }
+        else if ((true == active) && ((clientMsk == arb->active) || (true == Cy_CSDIDAC_ArbIsAbove(client, absCurrent, arb))))
+        {
+            arb->maxClient = client;
+        }
+        else
+        {
+            /* The maximum client is not changed */
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ArbUpdate
+****************************************************************************//**
+*
+* Calculates the effective setpoint by the arbitration policy and writes
+* the IDAC register if its value changes. The function must be called in
+* a critical section.
+*
+* \param arb
+* The pointer to the arbiter structure.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_ArbUpdate(cy_stc_csdidac_arb_t * arb)
+{
+    int32_t effective = 0;
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t idacCode;
+    uint32_t idacRegValue;
+
+    if (0u != arb->active)
+    {
+        switch (arb->policy)
+        {
+            case CY_CSDIDAC_ARB_PRIORITY:
+                effective = arb->current[Cy_CSDIDAC_ArbGetHighestClient(arb->active)];
+                break;
+            case CY_CSDIDAC_ARB_MAX:
+                effective = arb->current[arb->maxClient];
+                break;
+            default:
+                effective = arb->sum;
+                if (CY_CSDIDAC_ARB_MAX_SUM < effective)
+                {
+                    effective = CY_CSDIDAC_ARB_MAX_SUM;
+                }
+                else if (-CY_CSDIDAC_ARB_MAX_SUM > effective)
+                {
+                    effective = -CY_CSDIDAC_ARB_MAX_SUM;
+                }
+                else
+                {
+                    /* The sum is in range */
+                }
+                break;
+        }
+    }
+
+    if (effective != arb->effective)
+    {
+        arb->effective = effective;
+        if (true == arb->busy)
+        {
+            Cy_CSDIDAC_ConvertCurrent(effective, &polarity, &lsbIndex, &idacCode);
+            idacRegValue = Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, idacCode);
+            if (idacRegValue != arb->idacRegValue)
+            {
+                arb->idacRegValue = idacRegValue;
+                Cy_CSDIDAC_WriteIdacRegMasked(arb->ch, idacRegValue, arb->ptrCsdidacCxt);
+                arb->writeCount++;
+            }
+        }
+    }
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
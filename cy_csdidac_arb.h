@@ -0,0 +1,142 @@
+/***************************************************************************//**
+* \file cy_csdidac_arb.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the multi-client setpoint arbitration of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_ARB_H)
+#define CY_CSDIDAC_ARB_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+#if !defined(CY_CSDIDAC_ARB_MAX_CLIENTS)
+/**
+* The maximum number of the clients of an arbiter. The client priorities are
+* in the range from 0 to CY_CSDIDAC_ARB_MAX_CLIENTS - 1. The macro can be
+* redefined by the user.
+*/
+#define CY_CSDIDAC_ARB_MAX_CLIENTS              (8u)
+#endif
+
+#if ((CY_CSDIDAC_ARB_MAX_CLIENTS < 1u) || (CY_CSDIDAC_ARB_MAX_CLIENTS > 32u))
+    #error "CY_CSDIDAC_ARB_MAX_CLIENTS is out of the 1..32 range"
+#endif
+
+/** \} group_csdidac_macros */
+
+
+/***************************************
+* Enumerated Types and Parameters
+***************************************/
+/**
+* \addtogroup group_csdidac_enums
+* \{
+*/
+
+/** The arbitration policy of the client setpoints */
+typedef enum
+{
+    CY_CSDIDAC_ARB_PRIORITY = 0u,           /**< The setpoint of the active client of the highest priority wins. */
+    CY_CSDIDAC_ARB_MAX      = 1u,           /**< The setpoint of the largest magnitude wins. */
+    CY_CSDIDAC_ARB_SUM      = 2u,           /**< The sum of the setpoints clamped at \ref CY_CSDIDAC_MAX_CURRENT_NA. */
+} cy_en_csdidac_arb_policy_t;
+
+/** \} group_csdidac_enums */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/** The CSDIDAC arbiter structure, that contains the client setpoints of one channel. */
+typedef struct
+{
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    cy_en_csdidac_choice_t ch;              /**< The arbitrated channel: CY_CSDIDAC_A or CY_CSDIDAC_B. */
+    cy_en_csdidac_arb_policy_t policy;      /**< The arbitration policy. */
+    int32_t current[CY_CSDIDAC_ARB_MAX_CLIENTS]; /**< The client setpoints in nA indexed by the client priority. */
+    uint32_t registered;                    /**< The registered clients, bit N for the priority N. */
+    uint32_t active;                        /**< The clients with a requested setpoint, bit N for the priority N. */
+    int32_t sum;                            /**< The sum of the active client setpoints in nA. */
+    uint32_t maxClient;                     /**< The active client of the largest setpoint magnitude. */
+    int32_t effective;                      /**< The effective setpoint in nA. */
+    uint32_t idacRegValue;                  /**< The IDAC register value of the effective setpoint. */
+    uint32_t writeCount;                    /**< The number of the IDAC register writes. */
+    bool busy;                              /**< The arbiter controls the channel. */
+} cy_stc_csdidac_arb_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbInit(
+                cy_en_csdidac_choice_t ch,
+                cy_en_csdidac_arb_policy_t policy,
+                cy_stc_csdidac_arb_t * arb,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbStart(
+                cy_stc_csdidac_arb_t * arb);
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbRegister(
+                uint32_t priority,
+                cy_stc_csdidac_arb_t * arb);
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbUnregister(
+                uint32_t priority,
+                cy_stc_csdidac_arb_t * arb);
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbRequest(
+                uint32_t priority,
+                int32_t current,
+                cy_stc_csdidac_arb_t * arb);
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbRelease(
+                uint32_t priority,
+                cy_stc_csdidac_arb_t * arb);
+int32_t Cy_CSDIDAC_ArbGetEffective(
+                const cy_stc_csdidac_arb_t * arb);
+cy_en_csdidac_status_t Cy_CSDIDAC_ArbStop(
+                cy_stc_csdidac_arb_t * arb);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_ARB_H */
+
+
+/* [] END OF FILE */
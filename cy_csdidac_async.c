@@ -0,0 +1,345 @@
+/***************************************************************************//**
+* \file cy_csdidac_async.c
+* \version 2.20
+*
+* \brief
+* This file provides the asynchronous request API implementation of
+* the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_async.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static cy_en_csdidac_status_t Cy_CSDIDAC_AsyncExecute(
+                const cy_stc_csdidac_async_request_t * request,
+                cy_stc_csdidac_context_t * context);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+#define CY_CSDIDAC_ASYNC_QUEUE_MSK              (CY_CSDIDAC_ASYNC_QUEUE_SIZE - 1u)
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_AsyncInit
+****************************************************************************//**
+*
+* Initializes the asynchronous request API.
+*
+* The asynchronous API decouples the requesting tasks from the blocking
+* CSDIDAC operations, e.g. the CSD HW block initialization delay of
+* Cy_CSDIDAC_Restore(). The requests are queued by Cy_CSDIDAC_AsyncSubmit(),
+* which returns immediately, and executed in the order of submission by
+* a single worker that calls Cy_CSDIDAC_AsyncRun() or
+* Cy_CSDIDAC_AsyncProcess(). The completion of each request is reported
+* by its callback.
+*
+* The CSDIDAC middleware can be initialized by Cy_CSDIDAC_Init() prior
+* to calling this function or by the CY_CSDIDAC_ASYNC_INIT request, so
+* the CSD HW block initialization delay does not block the requesting task
+* either. After this function is called, the CSDIDAC middleware functions
+* must be called only by the worker.
+*
+* \param os
+* The pointer to the OS abstraction layer structure
+* \ref cy_stc_csdidac_async_os_t.
+*
+* \param async
+* The pointer to the asynchronous API structure \ref cy_stc_csdidac_async_t
+* allocated by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_AsyncInit(
+                const cy_stc_csdidac_async_os_t * os,
+                cy_stc_csdidac_async_t * async,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((NULL != os) && (NULL != async) && (NULL != context))
+    {
+        if ((NULL != os->ptrLockFunc) && (NULL != os->ptrUnlockFunc))
+        {
+            async->os = *os;
+            async->ptrCsdidacCxt = context;
+            async->head = 0u;
+            async->tail = 0u;
+            async->stopRequest = false;
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_AsyncSubmit
+****************************************************************************//**
+*
+* Queues the request for the worker and returns without waiting for its
+* execution.
+*
+* The function can be called by several tasks concurrently. The request is
+* copied, so the request structure can be reused after the function returns.
+*
+* \param request
+* The pointer to the request structure \ref cy_stc_csdidac_async_request_t.
+*
+* \param async
+* The pointer to the asynchronous API structure \ref cy_stc_csdidac_async_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The request is queued.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+* * CY_CSDIDAC_HW_BUSY    - The request queue is full.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_AsyncSubmit(
+                const cy_stc_csdidac_async_request_t * request,
+                cy_stc_csdidac_async_t * async)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((NULL != request) && (NULL != async))
+    {
+        /* The current is range-checked as a signed value, so INT32_MIN is never negated */
+        if ((CY_CSDIDAC_ASYNC_INIT >= request->op) &&
+            ((CY_CSDIDAC_ASYNC_SET != request->op) ||
+             (((int32_t)CY_CSDIDAC_MAX_CURRENT_NA >= request->current) &&
+              (-(int32_t)CY_CSDIDAC_MAX_CURRENT_NA <= request->current))) &&
+            ((CY_CSDIDAC_ASYNC_INIT != request->op) || (NULL != request->ptrConfig)))
+        {
+            async->os.ptrLockFunc(async->os.osParam);
+            if ((async->tail - async->head) < CY_CSDIDAC_ASYNC_QUEUE_SIZE)
+            {
+                async->queue[async->tail & CY_CSDIDAC_ASYNC_QUEUE_MSK] = *request;
+                async->tail++;
+                retVal = CY_CSDIDAC_SUCCESS;
+            }
+            else
+            {
+                retVal = CY_CSDIDAC_HW_BUSY;
+            }
+            async->os.ptrUnlockFunc(async->os.osParam);
+
+            if ((CY_CSDIDAC_SUCCESS == retVal) && (NULL != async->os.ptrSignalFunc))
+            {
+                async->os.ptrSignalFunc(async->os.osParam);
+            }
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_AsyncProcess
+****************************************************************************//**
+*
+* Executes all the queued requests.
+*
+* The queue is locked only to take a request, so the blocking CSDIDAC
+* operations do not hold off the submitting tasks. The completion callback
+* of each request is called after its execution. The function must be called
+* by the worker only.
+*
+* \param async
+* The pointer to the asynchronous API structure \ref cy_stc_csdidac_async_t.
+*
+* \return
+* The number of the executed requests.
+*
+*******************************************************************************/
+uint32_t Cy_CSDIDAC_AsyncProcess(
+                cy_stc_csdidac_async_t * async)
+{
+    cy_stc_csdidac_async_request_t request;
+    cy_en_csdidac_status_t status;
+    uint32_t count = 0u;
+    bool pending = true;
+
+    while (true == pending)
+    {
+        async->os.ptrLockFunc(async->os.osParam);
+        pending = (async->head != async->tail);
+        if (true == pending)
+        {
+            request = async->queue[async->head & CY_CSDIDAC_ASYNC_QUEUE_MSK];
+            async->head++;
+        }
+        async->os.ptrUnlockFunc(async->os.osParam);
+
+        if (true == pending)
+        {
+            status = Cy_CSDIDAC_AsyncExecute(&request, async->ptrCsdidacCxt);
+            if (NULL != request.ptrCallback)
+            {
+                request.ptrCallback(status, request.callbackParam);
+            }
+            count++;
+        }
+    }
+
+    return (count);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_AsyncRun
+****************************************************************************//**
+*
+* Runs the worker loop until Cy_CSDIDAC_AsyncStop() is called.
+*
+* The function is intended to be the body of the worker task. It executes
+* the queued requests and then blocks by the wait function of the OS
+* abstraction layer while the queue is empty and the stop is not requested.
+* Both conditions are checked with the queue locked, so a request submitted
+* during the execution is not missed. If the wait function is NULL,
+* the function polls the queue continuously. The function returns when
+* the stop is requested and the queue is empty.
+*
+* \param async
+* The pointer to the asynchronous API structure \ref cy_stc_csdidac_async_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_AsyncRun(
+                cy_stc_csdidac_async_t * async)
+{
+    bool stop = false;
+
+    while (false == stop)
+    {
+        (void)Cy_CSDIDAC_AsyncProcess(async);
+
+        async->os.ptrLockFunc(async->os.osParam);
+        if (NULL != async->os.ptrWaitFunc)
+        {
+            while ((async->head == async->tail) && (false == async->stopRequest))
+            {
+                async->os.ptrWaitFunc(async->os.osParam);
+            }
+        }
+        stop = ((true == async->stopRequest) && (async->head == async->tail));
+        if (true == stop)
+        {
+            async->stopRequest = false;
+        }
+        async->os.ptrUnlockFunc(async->os.osParam);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_AsyncStop
+****************************************************************************//**
+*
+* Requests Cy_CSDIDAC_AsyncRun() to return after the queued requests
+* are executed.
+*
+* \param async
+* The pointer to the asynchronous API structure \ref cy_stc_csdidac_async_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_AsyncStop(
+                cy_stc_csdidac_async_t * async)
+{
+    async->os.ptrLockFunc(async->os.osParam);
+    async->stopRequest = true;
+    async->os.ptrUnlockFunc(async->os.osParam);
+
+    if (NULL != async->os.ptrSignalFunc)
+    {
+        async->os.ptrSignalFunc(async->os.osParam);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_AsyncExecute
+****************************************************************************//**
+*
+* Executes the request by the corresponding CSDIDAC middleware function.
+*
+* \param request
+* The pointer to the request structure \ref cy_stc_csdidac_async_request_t.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The status returned by the executed CSDIDAC middleware function.
+*
+*******************************************************************************/
+static cy_en_csdidac_status_t Cy_CSDIDAC_AsyncExecute(
+                const cy_stc_csdidac_async_request_t * request,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal;
+
+    switch (request->op)
+    {
+        case CY_CSDIDAC_ASYNC_ACQUIRE:
+            retVal = Cy_CSDIDAC_Restore(context);
+            break;
+        case CY_CSDIDAC_ASYNC_SET:
+            retVal = Cy_CSDIDAC_OutputEnable(request->ch, request->current, context);
+            break;
+        case CY_CSDIDAC_ASYNC_DISABLE:
+            retVal = Cy_CSDIDAC_OutputDisable(request->ch, context);
+            break;
+        case CY_CSDIDAC_ASYNC_RELEASE:
+            retVal = Cy_CSDIDAC_Save(context);
+            break;
+        case CY_CSDIDAC_ASYNC_INIT:
+            retVal = Cy_CSDIDAC_Init(request->ptrConfig, context);
+            break;
+        default:
+            retVal = CY_CSDIDAC_BAD_PARAM;
+            break;
+    }
+
+    return (retVal);
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
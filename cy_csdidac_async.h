@@ -0,0 +1,174 @@
+/***************************************************************************//**
+* \file cy_csdidac_async.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the asynchronous request API of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_ASYNC_H)
+#define CY_CSDIDAC_ASYNC_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+#if !defined(CY_CSDIDAC_ASYNC_QUEUE_SIZE)
+/**
+* The number of entries of the asynchronous request queue. The value must be
+* a power of two. The macro can be redefined by the user.
+*/
+#define CY_CSDIDAC_ASYNC_QUEUE_SIZE             (8u)
+#endif
+
+#if ((CY_CSDIDAC_ASYNC_QUEUE_SIZE < 2u) || (0u != (CY_CSDIDAC_ASYNC_QUEUE_SIZE & (CY_CSDIDAC_ASYNC_QUEUE_SIZE - 1u))))
+    #error "CY_CSDIDAC_ASYNC_QUEUE_SIZE must be a power of two not less than 2"
+#endif
+
+/** \} group_csdidac_macros */
+
+
+/***************************************
+* Enumerated Types and Parameters
+***************************************/
+/**
+* \addtogroup group_csdidac_enums
+* \{
+*/
+
+/** The CSDIDAC asynchronous request operation enumeration type. */
+typedef enum
+{
+    CY_CSDIDAC_ASYNC_ACQUIRE  = 0u,         /**< Acquires the CSD HW block by Cy_CSDIDAC_Restore() */
+    CY_CSDIDAC_ASYNC_SET      = 1u,         /**< Sets the output current by Cy_CSDIDAC_OutputEnable() */
+    CY_CSDIDAC_ASYNC_DISABLE  = 2u,         /**< Disables the output by Cy_CSDIDAC_OutputDisable() */
+    CY_CSDIDAC_ASYNC_RELEASE  = 3u,         /**< Releases the CSD HW block by Cy_CSDIDAC_Save() */
+    CY_CSDIDAC_ASYNC_INIT     = 4u,         /**< Initializes the middleware by Cy_CSDIDAC_Init() */
+} cy_en_csdidac_async_op_t;
+
+/** \} group_csdidac_enums */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/**
+* Signals the completion of an asynchronous request.
+*
+* The function is called in the worker context with the status returned by
+* the executed CSDIDAC function, e.g. to give a semaphore or a task
+* notification to the requesting task.
+*/
+typedef void (*cy_csdidac_async_callback_t)(cy_en_csdidac_status_t status, void * param);
+
+/** The OS abstraction layer function. */
+typedef void (*cy_csdidac_async_os_func_t)(void * osParam);
+
+/**
+* The CSDIDAC asynchronous API OS abstraction layer structure.
+*
+* The lock and unlock functions protect the request queue, e.g. by a mutex
+* or a critical section, and are mandatory. The signal and wait functions
+* wake up and block the worker and have the condition variable semantics:
+* the wait function is called with the queue locked, atomically unlocks it
+* and blocks until signaled, and locks it again before it returns, e.g.
+* pthread_cond_wait(). The worker re-checks the queue and the stop request
+* under the lock before each wait, so a signal sent while the worker is busy
+* is not lost and spurious wake-ups are allowed. An RTOS without condition
+* variables can implement the wait function by unlocking the mutex, taking
+* a counting semaphore given by the signal function, and locking the mutex
+* again. The signal and wait functions can be NULL if the worker polls
+* the queue by Cy_CSDIDAC_AsyncProcess().
+*/
+typedef struct
+{
+    cy_csdidac_async_os_func_t ptrLockFunc;   /**< Locks the request queue. */
+    cy_csdidac_async_os_func_t ptrUnlockFunc; /**< Unlocks the request queue. */
+    cy_csdidac_async_os_func_t ptrSignalFunc; /**< Wakes up the worker. Can be NULL. */
+    cy_csdidac_async_os_func_t ptrWaitFunc;   /**< Blocks the worker until it is signaled. Can be NULL. */
+    void * osParam;                         /**< The parameter passed to the OS abstraction layer functions. */
+} cy_stc_csdidac_async_os_t;
+
+/** The CSDIDAC asynchronous request structure */
+typedef struct
+{
+    cy_en_csdidac_async_op_t op;            /**< The requested operation. */
+    cy_en_csdidac_choice_t ch;              /**< The output channel(s) of the set and disable operations. */
+    int32_t current;                        /**< The current in nA of the set operation. */
+    const cy_stc_csdidac_config_t * ptrConfig; /**< The configuration of the init operation. */
+    cy_csdidac_async_callback_t ptrCallback; /**< The completion callback. Can be NULL. */
+    void * callbackParam;                   /**< The parameter passed to the completion callback. */
+} cy_stc_csdidac_async_request_t;
+
+/** The CSDIDAC asynchronous API structure, that contains the request queue. */
+typedef struct
+{
+    cy_stc_csdidac_async_os_t os;           /**< The OS abstraction layer copy. */
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    cy_stc_csdidac_async_request_t queue[CY_CSDIDAC_ASYNC_QUEUE_SIZE]; /**< The request queue. */
+    uint32_t head;                          /**< The free-running index of the next executed request. */
+    uint32_t tail;                          /**< The free-running index of the next submitted request. */
+    bool stopRequest;                       /**< Cy_CSDIDAC_AsyncRun() is requested to return. */
+} cy_stc_csdidac_async_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_AsyncInit(
+                const cy_stc_csdidac_async_os_t * os,
+                cy_stc_csdidac_async_t * async,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_AsyncSubmit(
+                const cy_stc_csdidac_async_request_t * request,
+                cy_stc_csdidac_async_t * async);
+uint32_t Cy_CSDIDAC_AsyncProcess(
+                cy_stc_csdidac_async_t * async);
+void Cy_CSDIDAC_AsyncRun(
+                cy_stc_csdidac_async_t * async);
+void Cy_CSDIDAC_AsyncStop(
+                cy_stc_csdidac_async_t * async);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_ASYNC_H */
+
+
+/* [] END OF FILE */
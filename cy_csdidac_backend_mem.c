@@ -0,0 +1,462 @@
+/***************************************************************************//**
+* \file cy_csdidac_backend_mem.c
+* \version 2.20
+*
+* \brief
+* This file provides the implementation of the in-memory hardware-access
+* backend of the CSDIDAC middleware, that models the CSD HW block and GPIO
+* pins for host builds, simulations, and tests.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_gpio.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_backend_mem.h"
+#include "cy_csd.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+#if (0u != CY_CSDIDAC_BACKEND_EN)
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static uint32_t Cy_CSDIDAC_BackendMemRegIndex(uint32_t offset);
+static cy_stc_csdidac_backend_mem_pin_t * Cy_CSDIDAC_BackendMemAllocPin(
+                GPIO_PRT_Type * port,
+                uint32_t pinNum,
+                cy_stc_csdidac_backend_mem_t * mem);
+static cy_en_csd_status_t Cy_CSDIDAC_BackendMemCsdInit(void * param, CSD_Type * base, cy_stc_csd_config_t const * config,
+                                                       cy_en_csd_key_t key, cy_stc_csd_context_t * context);
+static cy_en_csd_status_t Cy_CSDIDAC_BackendMemCsdDeInit(void * param, const CSD_Type * base, cy_en_csd_key_t key,
+                                                         cy_stc_csd_context_t * context);
+static cy_en_csd_key_t Cy_CSDIDAC_BackendMemCsdGetLockStatus(void * param, const CSD_Type * base,
+                                                             const cy_stc_csd_context_t * context);
+static cy_en_csd_status_t Cy_CSDIDAC_BackendMemCsdGetConversionStatus(void * param, const CSD_Type * base,
+                                                                      const cy_stc_csd_context_t * context);
+static uint32_t Cy_CSDIDAC_BackendMemCsdReadReg(void * param, const CSD_Type * base, uint32_t offset);
+static void Cy_CSDIDAC_BackendMemCsdWriteReg(void * param, CSD_Type * base, uint32_t offset, uint32_t value);
+static void Cy_CSDIDAC_BackendMemCsdSetBits(void * param, CSD_Type * base, uint32_t offset, uint32_t mask);
+static void Cy_CSDIDAC_BackendMemCsdClrBits(void * param, CSD_Type * base, uint32_t offset, uint32_t mask);
+static void Cy_CSDIDAC_BackendMemGpioSetDrivemode(void * param, GPIO_PRT_Type * base, uint32_t pinNum, uint32_t value);
+static uint32_t Cy_CSDIDAC_BackendMemGpioGetDrivemode(void * param, GPIO_PRT_Type * base, uint32_t pinNum);
+static void Cy_CSDIDAC_BackendMemGpioSetHsiom(void * param, GPIO_PRT_Type * base, uint32_t pinNum, en_hsiom_sel_t value);
+static en_hsiom_sel_t Cy_CSDIDAC_BackendMemGpioGetHsiom(void * param, GPIO_PRT_Type * base, uint32_t pinNum);
+static void Cy_CSDIDAC_BackendMemDelayUs(void * param, uint16_t microseconds);
+static uint32_t Cy_CSDIDAC_BackendMemEnterCriticalSection(void * param);
+static void Cy_CSDIDAC_BackendMemExitCriticalSection(void * param, uint32_t savedIntrStatus);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Constant Tables
+*******************************************************************************/
+/* The offsets of the modeled CSD HW block registers */
+static const uint32_t cy_csdidac_backendMemRegOffset[CY_CSDIDAC_BACKEND_MEM_REG_NUM] =
+{
+    CY_CSD_REG_OFFSET_CONFIG,
+    CY_CSD_REG_OFFSET_INTR_MASK,
+    CY_CSD_REG_OFFSET_SEQ_START,
+    CY_CSD_REG_OFFSET_SW_BYP_SEL,
+    CY_CSD_REG_OFFSET_SW_REFGEN_SEL,
+    CY_CSD_REG_OFFSET_IDACA,
+    CY_CSD_REG_OFFSET_IDACB,
+};
+
+const cy_stc_csdidac_backend_t cy_csdidac_backendMem =
+{
+    .csdInit                = &Cy_CSDIDAC_BackendMemCsdInit,
+    .csdDeInit              = &Cy_CSDIDAC_BackendMemCsdDeInit,
+    .csdGetLockStatus       = &Cy_CSDIDAC_BackendMemCsdGetLockStatus,
+    .csdGetConversionStatus = &Cy_CSDIDAC_BackendMemCsdGetConversionStatus,
+    .csdReadReg             = &Cy_CSDIDAC_BackendMemCsdReadReg,
+    .csdWriteReg            = &Cy_CSDIDAC_BackendMemCsdWriteReg,
+    .csdSetBits             = &Cy_CSDIDAC_BackendMemCsdSetBits,
+    .csdClrBits             = &Cy_CSDIDAC_BackendMemCsdClrBits,
+    .gpioSetDrivemode       = &Cy_CSDIDAC_BackendMemGpioSetDrivemode,
+    .gpioGetDrivemode       = &Cy_CSDIDAC_BackendMemGpioGetDrivemode,
+    .gpioSetHsiom           = &Cy_CSDIDAC_BackendMemGpioSetHsiom,
+    .gpioGetHsiom           = &Cy_CSDIDAC_BackendMemGpioGetHsiom,
+    .delayUs                = &Cy_CSDIDAC_BackendMemDelayUs,
+    .enterCriticalSection   = &Cy_CSDIDAC_BackendMemEnterCriticalSection,
+    .exitCriticalSection    = &Cy_CSDIDAC_BackendMemExitCriticalSection,
+};
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_BackendMemInit
+****************************************************************************//**
+*
+* Initializes the in-memory backend structure to the reset state: the CSD HW
+* block is free, its registers are zero, and no GPIO pin is modeled.
+*
+* To run the middleware on the in-memory backend, the ptrBackend field of
+* the CSDIDAC configuration structure is set to \ref cy_csdidac_backendMem
+* and the backendParam field to the in-memory backend structure. The base
+* and csdCxtPtr fields must not be NULL, but the objects they point to are
+* not accessed, and the pin port pointers are used only as the pin
+* identifiers.
+*
+* \param mem
+* The pointer to the in-memory backend structure
+* \ref cy_stc_csdidac_backend_mem_t allocated by the user.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_BackendMemInit(
+                cy_stc_csdidac_backend_mem_t * mem)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t i;
+
+    if (NULL != mem)
+    {
+        for (i = 0u; i < CY_CSDIDAC_BACKEND_MEM_REG_NUM; i++)
+        {
+            mem->csdReg[i] = 0u;
+        }
+        for (i = 0u; i < CY_CSDIDAC_BACKEND_MEM_PIN_NUM; i++)
+        {
+            mem->pin[i].port = NULL;
+        }
+        mem->lockKey = CY_CSD_NONE_KEY;
+        mem->writeCount = 0u;
+        mem->criticalDepth = 0u;
+        mem->delayUs = 0u;
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_BackendMemReadReg
+****************************************************************************//**
+*
+* Returns the modeled value of a CSD HW block register.
+*
+* \param offset
+* The register offset, e.g. CY_CSD_REG_OFFSET_IDACA.
+*
+* \param mem
+* The pointer to the in-memory backend structure
+* \ref cy_stc_csdidac_backend_mem_t.
+*
+* \return
+* The register value or zero if the register is not modeled.
+*
+*******************************************************************************/
+uint32_t Cy_CSDIDAC_BackendMemReadReg(
+                uint32_t offset,
+                const cy_stc_csdidac_backend_mem_t * mem)
+{
+    uint32_t idx = Cy_CSDIDAC_BackendMemRegIndex(offset);
+
+    return ((CY_CSDIDAC_BACKEND_MEM_REG_NUM > idx) ? mem->csdReg[idx] : 0u);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_BackendMemGetPin
+****************************************************************************//**
+*
+* Returns the modeled state of a GPIO pin.
+*
+* \param port
+* The pointer to the pin port.
+*
+* \param pinNum
+* The pin number in the port.
+*
+* \param mem
+* The pointer to the in-memory backend structure
+* \ref cy_stc_csdidac_backend_mem_t.
+*
+* \return
+* The pointer to the pin state or NULL if the pin was not accessed by
+* the middleware.
+*
+*******************************************************************************/
+const cy_stc_csdidac_backend_mem_pin_t * Cy_CSDIDAC_BackendMemGetPin(
+                const GPIO_PRT_Type * port,
+                uint32_t pinNum,
+                const cy_stc_csdidac_backend_mem_t * mem)
+{
+    const cy_stc_csdidac_backend_mem_pin_t * ptrPin = NULL;
+    uint32_t i;
+
+    for (i = 0u; (i < CY_CSDIDAC_BACKEND_MEM_PIN_NUM) && (NULL == ptrPin); i++)
+    {
+        if ((port == mem->pin[i].port) && (pinNum == mem->pin[i].pinNum))
+        {
+            ptrPin = &mem->pin[i];
+        }
+    }
+
+    return (ptrPin);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_BackendMemRegIndex
+****************************************************************************//**
+*
+* Returns the index of the modeled register.
+*
+* \param offset
+* The register offset.
+*
+* \return
+* The register index or CY_CSDIDAC_BACKEND_MEM_REG_NUM if the register is
+* not modeled.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDIDAC_BackendMemRegIndex(uint32_t offset)
+{
+    uint32_t idx = 0u;
+
+    while ((CY_CSDIDAC_BACKEND_MEM_REG_NUM > idx) && (offset != cy_csdidac_backendMemRegOffset[idx]))
+    {
+        idx++;
+    }
+
+    return (idx);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_BackendMemAllocPin
+****************************************************************************//**
+*
+* Returns the modeled state of a GPIO pin and allocates it in the reset state
+* on the first access.
+*
+* \param port
+* The pointer to the pin port.
+*
+* \param pinNum
+* The pin number in the port.
+*
+* \param mem
+* The pointer to the in-memory backend structure.
+*
+* \return
+* The pointer to the pin state or NULL if all the pin entries are used.
+*
+*******************************************************************************/
+static cy_stc_csdidac_backend_mem_pin_t * Cy_CSDIDAC_BackendMemAllocPin(
+                GPIO_PRT_Type * port,
+                uint32_t pinNum,
+                cy_stc_csdidac_backend_mem_t * mem)
+{
+    cy_stc_csdidac_backend_mem_pin_t * ptrPin = NULL;
+    uint32_t i;
+
+    for (i = 0u; (i < CY_CSDIDAC_BACKEND_MEM_PIN_NUM) && (NULL == ptrPin); i++)
+    {
+        if ((port == mem->pin[i].port) && (pinNum == mem->pin[i].pinNum))
+        {
+            ptrPin = &mem->pin[i];
+        }
+    }
+    for (i = 0u; (i < CY_CSDIDAC_BACKEND_MEM_PIN_NUM) && (NULL == ptrPin); i++)
+    {
+        if (NULL == mem->pin[i].port)
+        {
+            ptrPin = &mem->pin[i];
+            ptrPin->port = port;
+            ptrPin->pinNum = pinNum;
+            ptrPin->driveMode = CY_GPIO_DM_ANALOG;
+            ptrPin->hsiom = HSIOM_SEL_GPIO;
+        }
+    }
+
+    return (ptrPin);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_BackendMemCsdInit ... Cy_CSDIDAC_BackendMemExitCriticalSection
+****************************************************************************//**
+*
+* The functions of the \ref cy_csdidac_backendMem backend. The backend
+* parameter is the pointer to the \ref cy_stc_csdidac_backend_mem_t
+* structure. The CSD HW block capture follows the CSD driver: it fails with
+* CY_CSD_LOCKED if the block is owned, and Cy_CSD_DeInit() fails with
+* CY_CSD_LOCKED if the key does not match the owner. The block is never busy.
+* The writes of the not modeled registers are counted and ignored.
+*
+*******************************************************************************/
+static cy_en_csd_status_t Cy_CSDIDAC_BackendMemCsdInit(void * param, CSD_Type * base, cy_stc_csd_config_t const * config,
+                                                       cy_en_csd_key_t key, cy_stc_csd_context_t * context)
+{
+    cy_stc_csdidac_backend_mem_t * mem = (cy_stc_csdidac_backend_mem_t *)param;
+    cy_en_csd_status_t retVal = CY_CSD_LOCKED;
+
+    (void)base;
+    (void)context;
+
+    if (CY_CSD_NONE_KEY == mem->lockKey)
+    {
+        mem->lockKey = key;
+        mem->csdReg[0u] = config->config;
+        mem->csdReg[1u] = config->intrMask;
+        mem->csdReg[2u] = config->seqStart;
+        mem->csdReg[3u] = config->swBypSel;
+        mem->csdReg[4u] = config->swRefgenSel;
+        mem->csdReg[5u] = config->idacA;
+        mem->csdReg[6u] = config->idacB;
+        mem->writeCount += CY_CSDIDAC_BACKEND_MEM_REG_NUM;
+        retVal = CY_CSD_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+static cy_en_csd_status_t Cy_CSDIDAC_BackendMemCsdDeInit(void * param, const CSD_Type * base, cy_en_csd_key_t key,
+                                                         cy_stc_csd_context_t * context)
+{
+    cy_stc_csdidac_backend_mem_t * mem = (cy_stc_csdidac_backend_mem_t *)param;
+    cy_en_csd_status_t retVal = CY_CSD_LOCKED;
+
+    (void)base;
+    (void)context;
+
+    if (key == mem->lockKey)
+    {
+        mem->lockKey = CY_CSD_NONE_KEY;
+        retVal = CY_CSD_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+static cy_en_csd_key_t Cy_CSDIDAC_BackendMemCsdGetLockStatus(void * param, const CSD_Type * base,
+                                                             const cy_stc_csd_context_t * context)
+{
+    (void)base;
+    (void)context;
+    return (((const cy_stc_csdidac_backend_mem_t *)param)->lockKey);
+}
+
+static cy_en_csd_status_t Cy_CSDIDAC_BackendMemCsdGetConversionStatus(void * param, const CSD_Type * base,
+                                                                      const cy_stc_csd_context_t * context)
+{
+    (void)param;
+    (void)base;
+    (void)context;
+    return (CY_CSD_SUCCESS);
+}
+
+static uint32_t Cy_CSDIDAC_BackendMemCsdReadReg(void * param, const CSD_Type * base, uint32_t offset)
+{
+    (void)base;
+    return (Cy_CSDIDAC_BackendMemReadReg(offset, (const cy_stc_csdidac_backend_mem_t *)param));
+}
+
+static void Cy_CSDIDAC_BackendMemCsdWriteReg(void * param, CSD_Type * base, uint32_t offset, uint32_t value)
+{
+    cy_stc_csdidac_backend_mem_t * mem = (cy_stc_csdidac_backend_mem_t *)param;
+    uint32_t idx = Cy_CSDIDAC_BackendMemRegIndex(offset);
+
+    (void)base;
+
+    if (CY_CSDIDAC_BACKEND_MEM_REG_NUM > idx)
+    {
+        mem->csdReg[idx] = value;
+    }
+    mem->writeCount++;
+}
+
+static void Cy_CSDIDAC_BackendMemCsdSetBits(void * param, CSD_Type * base, uint32_t offset, uint32_t mask)
+{
+    Cy_CSDIDAC_BackendMemCsdWriteReg(param, base, offset, Cy_CSDIDAC_BackendMemCsdReadReg(param, base, offset) | mask);
+}
+
+static void Cy_CSDIDAC_BackendMemCsdClrBits(void * param, CSD_Type * base, uint32_t offset, uint32_t mask)
+{
+    Cy_CSDIDAC_BackendMemCsdWriteReg(param, base, offset, Cy_CSDIDAC_BackendMemCsdReadReg(param, base, offset) & ~mask);
+}
+
+static void Cy_CSDIDAC_BackendMemGpioSetDrivemode(void * param, GPIO_PRT_Type * base, uint32_t pinNum, uint32_t value)
+{
+    cy_stc_csdidac_backend_mem_pin_t * ptrPin = Cy_CSDIDAC_BackendMemAllocPin(base, pinNum, (cy_stc_csdidac_backend_mem_t *)param);
+
+    if (NULL != ptrPin)
+    {
+        ptrPin->driveMode = value;
+    }
+}
+
+static uint32_t Cy_CSDIDAC_BackendMemGpioGetDrivemode(void * param, GPIO_PRT_Type * base, uint32_t pinNum)
+{
+    const cy_stc_csdidac_backend_mem_pin_t * ptrPin = Cy_CSDIDAC_BackendMemGetPin(base, pinNum,
+                                                          (const cy_stc_csdidac_backend_mem_t *)param);
+
+    return ((NULL != ptrPin) ? ptrPin->driveMode : CY_GPIO_DM_ANALOG);
+}
+
+static void Cy_CSDIDAC_BackendMemGpioSetHsiom(void * param, GPIO_PRT_Type * base, uint32_t pinNum, en_hsiom_sel_t value)
+{
+    cy_stc_csdidac_backend_mem_pin_t * ptrPin = Cy_CSDIDAC_BackendMemAllocPin(base, pinNum, (cy_stc_csdidac_backend_mem_t *)param);
+
+    if (NULL != ptrPin)
+    {
+        ptrPin->hsiom = value;
+    }
+}
+
+static en_hsiom_sel_t Cy_CSDIDAC_BackendMemGpioGetHsiom(void * param, GPIO_PRT_Type * base, uint32_t pinNum)
+{
+    const cy_stc_csdidac_backend_mem_pin_t * ptrPin = Cy_CSDIDAC_BackendMemGetPin(base, pinNum,
+                                                          (const cy_stc_csdidac_backend_mem_t *)param);
+
+    return ((NULL != ptrPin) ? ptrPin->hsiom : HSIOM_SEL_GPIO);
+}
+
+static void Cy_CSDIDAC_BackendMemDelayUs(void * param, uint16_t microseconds)
+{
+    ((cy_stc_csdidac_backend_mem_t *)param)->delayUs += microseconds;
+}
+
+static uint32_t Cy_CSDIDAC_BackendMemEnterCriticalSection(void * param)
+{
+    cy_stc_csdidac_backend_mem_t * mem = (cy_stc_csdidac_backend_mem_t *)param;
+    uint32_t savedIntrStatus = mem->criticalDepth;
+
+    mem->criticalDepth++;
+
+    return (savedIntrStatus);
+}
+
+static void Cy_CSDIDAC_BackendMemExitCriticalSection(void * param, uint32_t savedIntrStatus)
+{
+    ((cy_stc_csdidac_backend_mem_t *)param)->criticalDepth = savedIntrStatus;
+}
+
+#endif /* (0u != CY_CSDIDAC_BACKEND_EN) */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
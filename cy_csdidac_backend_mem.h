@@ -0,0 +1,126 @@
+/***************************************************************************//**
+* \file cy_csdidac_backend_mem.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the in-memory hardware-access backend of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_BACKEND_MEM_H)
+#define CY_CSDIDAC_BACKEND_MEM_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+#if (0u != CY_CSDIDAC_BACKEND_EN)
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+#if !defined(CY_CSDIDAC_BACKEND_MEM_PIN_NUM)
+/**
+* The maximum number of the GPIO pins modeled by the in-memory backend.
+* The macro can be redefined by the user to model more pins, e.g. the scan
+* list pins.
+*/
+#define CY_CSDIDAC_BACKEND_MEM_PIN_NUM          (8u)
+#endif
+
+/** The number of the CSD HW block registers modeled by the in-memory backend. */
+#define CY_CSDIDAC_BACKEND_MEM_REG_NUM          (7u)
+
+/** \} group_csdidac_macros */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/** The GPIO pin state of the in-memory backend. */
+typedef struct
+{
+    GPIO_PRT_Type * port;                   /**< The pointer to the pin port, NULL for a free entry. */
+    uint32_t pinNum;                        /**< The pin number in the port. */
+    uint32_t driveMode;                     /**< The pin drive mode. */
+    en_hsiom_sel_t hsiom;                   /**< The pin HSIOM connection. */
+} cy_stc_csdidac_backend_mem_pin_t;
+
+/**
+* The in-memory backend structure, that contains the modeled hardware state.
+* The pointer to the structure is the backendParam field of the CSDIDAC
+* configuration structure.
+*/
+typedef struct
+{
+    uint32_t csdReg[CY_CSDIDAC_BACKEND_MEM_REG_NUM]; /**< The CSD HW block registers used by the middleware. */
+    cy_en_csd_key_t lockKey;                /**< The key of the CSD HW block owner. */
+    cy_stc_csdidac_backend_mem_pin_t pin[CY_CSDIDAC_BACKEND_MEM_PIN_NUM]; /**< The modeled GPIO pins. */
+    uint32_t writeCount;                    /**< The number of the CSD HW block register writes. */
+    uint32_t criticalDepth;                 /**< The nesting depth of the critical sections. */
+    uint32_t delayUs;                       /**< The total delay time in microseconds. */
+} cy_stc_csdidac_backend_mem_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+/**
+* The in-memory hardware-access backend. It models the CSD HW block lock and
+* registers, the GPIO pins, and the critical sections in the
+* \ref cy_stc_csdidac_backend_mem_t structure, so the middleware can run on
+* a host without the hardware.
+*/
+extern const cy_stc_csdidac_backend_t cy_csdidac_backendMem;
+
+cy_en_csdidac_status_t Cy_CSDIDAC_BackendMemInit(
+                cy_stc_csdidac_backend_mem_t * mem);
+uint32_t Cy_CSDIDAC_BackendMemReadReg(
+                uint32_t offset,
+                const cy_stc_csdidac_backend_mem_t * mem);
+const cy_stc_csdidac_backend_mem_pin_t * Cy_CSDIDAC_BackendMemGetPin(
+                const GPIO_PRT_Type * port,
+                uint32_t pinNum,
+                const cy_stc_csdidac_backend_mem_t * mem);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (0u != CY_CSDIDAC_BACKEND_EN) */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_BACKEND_MEM_H */
+
+
+/* [] END OF FILE */
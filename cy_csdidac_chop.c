@@ -0,0 +1,273 @@
+/***************************************************************************//**
+* \file cy_csdidac_chop.c
+* \version 2.20
+*
+* \brief
+* This file provides the implementation of the polarity chopping mode of
+* the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_chop.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static void Cy_CSDIDAC_ChopWrite(const cy_stc_csdidac_chop_t * chop);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+#define CY_CSDIDAC_CHOP_PHASE_SOURCE            (0u)
+#define CY_CSDIDAC_CHOP_PHASE_SINK              (2u)
+#define CY_CSDIDAC_CHOP_PHASE_DEAD_MSK          (1u)
+#define CY_CSDIDAC_CHOP_PHASE_MSK               (CY_CSDIDAC_CHOP_PHASE_NUM - 1u)
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ChopInit
+****************************************************************************//**
+*
+* Verifies the configuration and precomputes the IDAC register values of
+* the chopping phases.
+*
+* The chopping mode periodically reverses the polarity of the output current
+* to cancel the sensor offsets. The source and the sink IDAC register values
+* and the zero-code value of the dead time are calculated once, so each
+* polarity change performed by Cy_CSDIDAC_ChopTick() is a single IDAC
+* register write per channel.
+*
+* The CSDIDAC middleware must be initialized by Cy_CSDIDAC_Init() prior
+* to calling this function.
+*
+* \param config
+* The pointer to the chopping configuration structure
+* \ref cy_stc_csdidac_chop_config_t. The current must not exceed
+* \ref CY_CSDIDAC_MAX_CURRENT_NA and the half-period must be at least one tick.
+*
+* \param chop
+* The pointer to the chopping structure \ref cy_stc_csdidac_chop_t allocated
+* by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ChopInit(
+                const cy_stc_csdidac_chop_config_t * config,
+                cy_stc_csdidac_chop_t * chop,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t code;
+
+    if ((NULL != config) && (NULL != chop) && (NULL != context) &&
+        (CY_CSDIDAC_MAX_CURRENT_NA >= config->current) && (0u != config->halfPeriod))
+    {
+        if (true == Cy_CSDIDAC_IsIdacChoiceValid(config->ch, context->cfgCopy.configA, context->cfgCopy.configB))
+        {
+            chop->cfgCopy = *config;
+            chop->ptrCsdidacCxt = context;
+            chop->busy = false;
+
+            Cy_CSDIDAC_ConvertCurrent((int32_t)config->current, &polarity, &lsbIndex, &code);
+            chop->regValue[CY_CSDIDAC_CHOP_PHASE_SOURCE] = Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SOURCE, lsbIndex, code);
+            chop->regValue[CY_CSDIDAC_CHOP_PHASE_SINK] = Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SINK, lsbIndex, code);
+            chop->regValue[CY_CSDIDAC_CHOP_PHASE_SOURCE + CY_CSDIDAC_CHOP_PHASE_DEAD_MSK] =
+                                                       Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SOURCE, lsbIndex, 0u);
+            chop->regValue[CY_CSDIDAC_CHOP_PHASE_SINK + CY_CSDIDAC_CHOP_PHASE_DEAD_MSK] =
+                                                       Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SINK, lsbIndex, 0u);
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ChopStart
+****************************************************************************//**
+*
+* Enables the output(s) and starts the chopping from the source half-period.
+*
+* The sync callback is called with \ref CY_CSDIDAC_SOURCE after the source
+* current is set.
+*
+* \param chop
+* The pointer to the chopping structure \ref cy_stc_csdidac_chop_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or the channel is
+*                           disabled.
+* * CY_CSDIDAC_HW_LOCKED  - The CSD HW block is not captured by the CSDIDAC.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ChopStart(
+                cy_stc_csdidac_chop_t * chop)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != chop)
+    {
+        chop->busy = false;
+        retVal = Cy_CSDIDAC_OutputEnableExt(chop->cfgCopy.ch, CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u, chop->ptrCsdidacCxt);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            chop->phase = CY_CSDIDAC_CHOP_PHASE_SOURCE;
+            chop->remaining = chop->cfgCopy.halfPeriod;
+            Cy_CSDIDAC_ChopWrite(chop);
+            chop->busy = true;
+            if (NULL != chop->cfgCopy.ptrSyncCallback)
+            {
+                chop->cfgCopy.ptrSyncCallback(CY_CSDIDAC_SOURCE, chop->cfgCopy.callbackParam);
+            }
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ChopTick
+****************************************************************************//**
+*
+* Advances the chopping by one tick.
+*
+* The function is intended to be called from the interrupt service routine of
+* a timer. It performs no parameter checks and writes the IDAC register(s)
+* only at the phase changes. When the dead time is configured, the output is
+* set to the zero code for the dead time between the polarities. The sync
+* callback is called right after each polarity change with the new polarity.
+*
+* \param chop
+* The pointer to the chopping structure \ref cy_stc_csdidac_chop_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_ChopTick(
+                cy_stc_csdidac_chop_t * chop)
+{
+    uint32_t phase;
+
+    if (true == chop->busy)
+    {
+        chop->remaining--;
+        if (0u == chop->remaining)
+        {
+            phase = (chop->phase + 1u) & CY_CSDIDAC_CHOP_PHASE_MSK;
+            if ((0u == chop->cfgCopy.deadTime) && (0u != (phase & CY_CSDIDAC_CHOP_PHASE_DEAD_MSK)))
+            {
+                phase = (phase + 1u) & CY_CSDIDAC_CHOP_PHASE_MSK;
+            }
+            chop->phase = phase;
+            Cy_CSDIDAC_ChopWrite(chop);
+
+            if (0u != (phase & CY_CSDIDAC_CHOP_PHASE_DEAD_MSK))
+            {
+                chop->remaining = chop->cfgCopy.deadTime;
+            }
+            else
+            {
+                chop->remaining = chop->cfgCopy.halfPeriod;
+                if (NULL != chop->cfgCopy.ptrSyncCallback)
+                {
+                    chop->cfgCopy.ptrSyncCallback((CY_CSDIDAC_CHOP_PHASE_SOURCE == phase) ? CY_CSDIDAC_SOURCE : CY_CSDIDAC_SINK,
+                                                  chop->cfgCopy.callbackParam);
+                }
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ChopStop
+****************************************************************************//**
+*
+* Stops the chopping and disables the output(s).
+*
+* \param chop
+* The pointer to the chopping structure \ref cy_stc_csdidac_chop_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ChopStop(
+                cy_stc_csdidac_chop_t * chop)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != chop)
+    {
+        chop->busy = false;
+        retVal = Cy_CSDIDAC_OutputDisable(chop->cfgCopy.ch, chop->ptrCsdidacCxt);
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ChopWrite
+****************************************************************************//**
+*
+* Writes the precomputed IDAC register value of the current phase to
+* the chopped channel(s).
+*
+* \param chop
+* The pointer to the chopping structure.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_ChopWrite(const cy_stc_csdidac_chop_t * chop)
+{
+    uint32_t idacRegValue = chop->regValue[chop->phase];
+
+    if (CY_CSDIDAC_B != chop->cfgCopy.ch)
+    {
+        Cy_CSDIDAC_WriteIdacReg(CY_CSDIDAC_A, idacRegValue, chop->ptrCsdidacCxt);
+    }
+    if (CY_CSDIDAC_A != chop->cfgCopy.ch)
+    {
+        Cy_CSDIDAC_WriteIdacReg(CY_CSDIDAC_B, idacRegValue, chop->ptrCsdidacCxt);
+    }
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,116 @@
+/***************************************************************************//**
+* \file cy_csdidac_chop.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the polarity chopping mode of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_CHOP_H)
+#define CY_CSDIDAC_CHOP_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+/**
+* The number of the chopping phases: the source, the dead time, the sink,
+* and the dead time.
+*/
+#define CY_CSDIDAC_CHOP_PHASE_NUM               (4u)
+
+/** \} group_csdidac_macros */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/**
+* Signals the start of a chopping half-period of the specified polarity.
+*
+* The function is called by Cy_CSDIDAC_ChopStart() and Cy_CSDIDAC_ChopTick(),
+* that is usually an interrupt service routine, right after the output
+* polarity is changed, so the measurement code can demodulate the signal.
+*/
+typedef void (*cy_csdidac_chop_callback_t)(cy_en_csdidac_polarity_t polarity, void * param);
+
+/** The CSDIDAC chopping configuration structure */
+typedef struct
+{
+    cy_en_csdidac_choice_t ch;              /**< The chopped channel(s). */
+    uint32_t current;                       /**< The magnitude of the chopped current in nA. */
+    uint32_t halfPeriod;                    /**< The duration of each polarity in ticks, at least one. */
+    uint32_t deadTime;                      /**< The duration of the zero-code phase between the polarities in ticks, zero to disable. */
+    cy_csdidac_chop_callback_t ptrSyncCallback; /**< Called on each polarity change. Can be NULL. */
+    void * callbackParam;                   /**< The parameter passed to the callback. */
+} cy_stc_csdidac_chop_config_t;
+
+/** The CSDIDAC chopping structure, that contains the precomputed IDAC register values and the phase state. */
+typedef struct
+{
+    cy_stc_csdidac_chop_config_t cfgCopy;   /**< A configuration structure copy. */
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    uint32_t regValue[CY_CSDIDAC_CHOP_PHASE_NUM]; /**< The IDAC register values of the phases. */
+    uint32_t phase;                         /**< The current phase. */
+    uint32_t remaining;                     /**< The number of the ticks to the next phase. */
+    bool busy;                              /**< The chopping is running. */
+} cy_stc_csdidac_chop_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_ChopInit(
+                const cy_stc_csdidac_chop_config_t * config,
+                cy_stc_csdidac_chop_t * chop,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_ChopStart(
+                cy_stc_csdidac_chop_t * chop);
+void Cy_CSDIDAC_ChopTick(
+                cy_stc_csdidac_chop_t * chop);
+cy_en_csdidac_status_t Cy_CSDIDAC_ChopStop(
+                cy_stc_csdidac_chop_t * chop);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_CHOP_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,389 @@
+/***************************************************************************//**
+* \file cy_csdidac_dds.c
+* \version 2.20
+*
+* \brief
+* This file provides the direct digital synthesis (DDS) waveform generator
+* implementation of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_dds.h"
+#include "cy_csd.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static void Cy_CSDIDAC_DdsBuildTable(cy_stc_csdidac_dds_t * dds);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+#define CY_CSDIDAC_DDS_CONST_1000               (1000u)
+#define CY_CSDIDAC_DDS_NYQUIST_FACTOR           (500u)
+
+/* The phase accumulator layout: 2 MSB - the quadrant, next bits - the table index */
+#define CY_CSDIDAC_DDS_QUADRANT_POS             (30u)
+#define CY_CSDIDAC_DDS_QUADRANT_MIRROR_MSK      (1u)
+#define CY_CSDIDAC_DDS_QUADRANT_SINK_MSK        (2u)
+#define CY_CSDIDAC_DDS_INDEX_POS                (CY_CSDIDAC_DDS_QUADRANT_POS - CY_CSDIDAC_DDS_TABLE_SIZE_LOG2)
+#define CY_CSDIDAC_DDS_INDEX_MSK                (CY_CSDIDAC_DDS_TABLE_SIZE - 1u)
+
+/* The shared quarter-wave sine table */
+#define CY_CSDIDAC_DDS_SINE_SIZE_LOG2           (6u)
+#define CY_CSDIDAC_DDS_SINE_STRIDE              (1u << (CY_CSDIDAC_DDS_SINE_SIZE_LOG2 - CY_CSDIDAC_DDS_TABLE_SIZE_LOG2))
+#define CY_CSDIDAC_DDS_SINE_SHIFT               (15u)
+#define CY_CSDIDAC_DDS_SINE_ROUND               (1u << (CY_CSDIDAC_DDS_SINE_SHIFT - 1u))
+
+
+/*******************************************************************************
+* Constant Tables
+*******************************************************************************/
+/* sin(i * pi / 128) * 32767, i = 0..64 */
+static const uint16_t cy_csdidac_ddsSine[(1u << CY_CSDIDAC_DDS_SINE_SIZE_LOG2) + 1u] =
+{
+        0u,   804u,  1608u,  2410u,  3212u,  4011u,  4808u,  5602u,
+     6393u,  7179u,  7962u,  8739u,  9512u, 10278u, 11039u, 11793u,
+    12539u, 13279u, 14010u, 14732u, 15446u, 16151u, 16846u, 17530u,
+    18204u, 18868u, 19519u, 20159u, 20787u, 21403u, 22005u, 22594u,
+    23170u, 23731u, 24279u, 24811u, 25329u, 25832u, 26319u, 26790u,
+    27245u, 27683u, 28105u, 28510u, 28898u, 29268u, 29621u, 29956u,
+    30273u, 30571u, 30852u, 31113u, 31356u, 31580u, 31785u, 31971u,
+    32137u, 32285u, 32412u, 32521u, 32609u, 32678u, 32728u, 32757u,
+    32767u,
+};
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DdsInit
+****************************************************************************//**
+*
+* Initializes the direct digital synthesis (DDS) waveform generator of
+* the specified channel.
+*
+* The generator produces a periodic bipolar waveform (a sourcing current in
+* the first half-period and a sinking current in the second half-period)
+* from a phase accumulator and a quarter-wave table of precomputed IDAC
+* register values. The memory size is constant regardless of the waveform
+* frequency and the table is recalculated only when the amplitude changes.
+* Each sample is written by the Cy_CSDIDAC_DdsTick() function that is called
+* at the configured tick frequency, e.g. from a timer interrupt.
+*
+* The generator is initialized with zero frequency and zero amplitude.
+* The CSDIDAC middleware must be initialized by Cy_CSDIDAC_Init() prior
+* to calling this function.
+*
+* \param config
+* The pointer to the DDS configuration structure
+* \ref cy_stc_csdidac_dds_config_t.
+*
+* \param dds
+* The pointer to the DDS structure \ref cy_stc_csdidac_dds_t allocated
+* by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_DdsInit(
+                const cy_stc_csdidac_dds_config_t * config,
+                cy_stc_csdidac_dds_t * dds,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((NULL != config) && (NULL != dds) && (NULL != context))
+    {
+        if ((0u != config->tickFrequency) &&
+            ((CY_CSDIDAC_DDS_SINE == config->waveform) || (CY_CSDIDAC_DDS_TRIANGLE == config->waveform)) &&
+            (((CY_CSDIDAC_A == config->ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configA)) ||
+             ((CY_CSDIDAC_B == config->ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configB))))
+        {
+            dds->cfgCopy = *config;
+            dds->ptrCsdidacCxt = context;
+            dds->phase = 0u;
+            dds->phaseIncrement = 0u;
+            dds->sinkMask = ((uint32_t)CY_CSDIDAC_SINK) << CY_CSDIDAC_POLARITY_POS;
+            dds->amplitude = 0u;
+            Cy_CSDIDAC_DdsBuildTable(dds);
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DdsSetFrequency
+****************************************************************************//**
+*
+* Sets the waveform frequency.
+*
+* The function recalculates only the phase increment, so the frequency can
+* be changed at runtime without the waveform phase discontinuity.
+*
+* \param frequency
+* The waveform frequency in mHz. The frequency must be less than half of
+* the tick frequency.
+*
+* \param dds
+* The pointer to the DDS structure \ref cy_stc_csdidac_dds_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_DdsSetFrequency(
+                uint32_t frequency,
+                cy_stc_csdidac_dds_t * dds)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != dds)
+    {
+        if ((uint64_t)frequency < ((uint64_t)dds->cfgCopy.tickFrequency * CY_CSDIDAC_DDS_NYQUIST_FACTOR))
+        {
+            dds->phaseIncrement = (uint32_t)(((uint64_t)frequency << 32u) /
+                                             ((uint64_t)dds->cfgCopy.tickFrequency * CY_CSDIDAC_DDS_CONST_1000));
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DdsSetAmplitude
+****************************************************************************//**
+*
+* Sets the waveform amplitude.
+*
+* The function chooses the minimum LSB to cover the amplitude and
+* recalculates the quarter-wave table. The whole waveform uses the same
+* LSB, so there are no LSB range transitions during the waveform generation.
+* The table is updated in the critical section, so the function can be
+* called while the generator is running.
+*
+* \param amplitude
+* The waveform peak current in nA in the range from 0 to
+* \ref CY_CSDIDAC_MAX_CURRENT_NA.
+*
+* \param dds
+* The pointer to the DDS structure \ref cy_stc_csdidac_dds_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_DdsSetAmplitude(
+                uint32_t amplitude,
+                cy_stc_csdidac_dds_t * dds)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t interruptState;
+
+    if ((NULL != dds) && (CY_CSDIDAC_MAX_CURRENT_NA >= amplitude))
+    {
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(dds->ptrCsdidacCxt);
+        dds->amplitude = amplitude;
+        Cy_CSDIDAC_DdsBuildTable(dds);
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(dds->ptrCsdidacCxt, interruptState);
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DdsStart
+****************************************************************************//**
+*
+* Resets the waveform phase and enables the generator channel output.
+*
+* The output is connected by Cy_CSDIDAC_OutputEnableExt() with the zero
+* code, so the subsequent Cy_CSDIDAC_DdsTick() calls write only the IDAC
+* register.
+*
+* \param dds
+* The pointer to the DDS structure \ref cy_stc_csdidac_dds_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_DdsStart(
+                cy_stc_csdidac_dds_t * dds)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != dds)
+    {
+        dds->phase = 0u;
+        retVal = Cy_CSDIDAC_OutputEnableExt(dds->cfgCopy.ch, CY_CSDIDAC_SOURCE,
+                                            dds->lsbIndex, 0u, dds->ptrCsdidacCxt);
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DdsStop
+****************************************************************************//**
+*
+* Disables the generator channel output.
+*
+* Stop calling Cy_CSDIDAC_DdsTick() before calling this function.
+*
+* \param dds
+* The pointer to the DDS structure \ref cy_stc_csdidac_dds_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_DdsStop(
+                cy_stc_csdidac_dds_t * dds)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != dds)
+    {
+        retVal = Cy_CSDIDAC_OutputDisable(dds->cfgCopy.ch, dds->ptrCsdidacCxt);
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DdsTick
+****************************************************************************//**
+*
+* Writes the current waveform sample to the IDAC register and advances
+* the phase.
+*
+* The function is intended to be called from a periodic interrupt at the
+* configured tick frequency. It performs no parameter verification: one
+* table load, the quadrant symmetry handling, and one register write.
+*
+* \param dds
+* The pointer to the DDS structure \ref cy_stc_csdidac_dds_t started by
+* Cy_CSDIDAC_DdsStart().
+*
+*******************************************************************************/
+void Cy_CSDIDAC_DdsTick(
+                cy_stc_csdidac_dds_t * dds)
+{
+    uint32_t phase = dds->phase;
+    uint32_t quadrant = phase >> CY_CSDIDAC_DDS_QUADRANT_POS;
+    uint32_t index = (phase >> CY_CSDIDAC_DDS_INDEX_POS) & CY_CSDIDAC_DDS_INDEX_MSK;
+    uint32_t idacRegValue;
+
+    /* The second and the fourth quadrants are mirrored */
+    if (0u != (quadrant & CY_CSDIDAC_DDS_QUADRANT_MIRROR_MSK))
+    {
+        index = CY_CSDIDAC_DDS_TABLE_SIZE - index;
+    }
+    idacRegValue = dds->regTable[index];
+    /* The second half-period is the sinking current */
+    if (0u != (quadrant & CY_CSDIDAC_DDS_QUADRANT_SINK_MSK))
+    {
+        idacRegValue |= dds->sinkMask;
+    }
+
+    Cy_CSDIDAC_WriteIdacReg(dds->cfgCopy.ch, idacRegValue, dds->ptrCsdidacCxt);
+    dds->phase = phase + dds->phaseIncrement;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DdsBuildTable
+****************************************************************************//**
+*
+* Chooses the LSB for the amplitude and calculates the quarter-wave table
+* of the IDAC register values with the sourcing polarity.
+*
+* \param dds
+* The pointer to the DDS structure \ref cy_stc_csdidac_dds_t.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_DdsBuildTable(cy_stc_csdidac_dds_t * dds)
+{
+    uint32_t amplitudePa = dds->amplitude * CY_CSDIDAC_DDS_CONST_1000;
+    uint32_t lsb = (uint32_t)CY_CSDIDAC_LSB_37_IDX;
+    uint32_t peakCode;
+    uint32_t code;
+    uint32_t i;
+
+    while ((lsb < (uint32_t)CY_CSDIDAC_LSB_4800_IDX) && (amplitudePa > cy_csdidac_lsbMaxCurrentPa[lsb]))
+    {
+        lsb++;
+    }
+    peakCode = (amplitudePa + (cy_csdidac_lsbPa[lsb] >> 1u)) / cy_csdidac_lsbPa[lsb];
+    if (peakCode > CY_CSDIDAC_MAX_CODE)
+    {
+        peakCode = CY_CSDIDAC_MAX_CODE;
+    }
+    dds->lsbIndex = (cy_en_csdidac_lsb_t)lsb;
+
+    for (i = 0u; i <= CY_CSDIDAC_DDS_TABLE_SIZE; i++)
+    {
+        if (CY_CSDIDAC_DDS_SINE == dds->cfgCopy.waveform)
+        {
+            code = ((peakCode * cy_csdidac_ddsSine[i * CY_CSDIDAC_DDS_SINE_STRIDE]) + CY_CSDIDAC_DDS_SINE_ROUND) >>
+                   CY_CSDIDAC_DDS_SINE_SHIFT;
+        }
+        else
+        {
+            code = ((peakCode * i) + (CY_CSDIDAC_DDS_TABLE_SIZE >> 1u)) >> CY_CSDIDAC_DDS_TABLE_SIZE_LOG2;
+        }
+        dds->regTable[i] = Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SOURCE, (cy_en_csdidac_lsb_t)lsb, code);
+    }
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
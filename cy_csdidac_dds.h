@@ -0,0 +1,143 @@
+/***************************************************************************//**
+* \file cy_csdidac_dds.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the direct digital synthesis (DDS) waveform generator of the CSDIDAC
+* middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_DDS_H)
+#define CY_CSDIDAC_DDS_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+#if !defined(CY_CSDIDAC_DDS_TABLE_SIZE_LOG2)
+/**
+* The binary logarithm of the number of the DDS quarter-wave table intervals.
+* The generator table contains (1 << CY_CSDIDAC_DDS_TABLE_SIZE_LOG2) + 1 IDAC
+* register values. The valid range is from 2 to 6. The macro can be
+* redefined by the user to trade off the RAM size against the waveform
+* resolution.
+*/
+#define CY_CSDIDAC_DDS_TABLE_SIZE_LOG2          (5u)
+#endif
+
+/** The number of the DDS quarter-wave table intervals. */
+#define CY_CSDIDAC_DDS_TABLE_SIZE               (1u << CY_CSDIDAC_DDS_TABLE_SIZE_LOG2)
+
+#if ((CY_CSDIDAC_DDS_TABLE_SIZE_LOG2 < 2u) || (CY_CSDIDAC_DDS_TABLE_SIZE_LOG2 > 6u))
+    #error "CY_CSDIDAC_DDS_TABLE_SIZE_LOG2 is out of the 2..6 range"
+#endif
+
+/** \} group_csdidac_macros */
+
+
+/***************************************
+* Enumerated Types and Parameters
+***************************************/
+/**
+* \addtogroup group_csdidac_enums
+* \{
+*/
+
+/** The CSDIDAC DDS waveform enumeration type. */
+typedef enum
+{
+    CY_CSDIDAC_DDS_SINE       = 0u,         /**< Sine waveform */
+    CY_CSDIDAC_DDS_TRIANGLE   = 1u,         /**< Triangle waveform */
+} cy_en_csdidac_dds_waveform_t;
+
+/** \} group_csdidac_enums */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/** The CSDIDAC DDS configuration structure */
+typedef struct
+{
+    cy_en_csdidac_choice_t ch;              /**< The output channel: CY_CSDIDAC_A or CY_CSDIDAC_B. */
+    cy_en_csdidac_dds_waveform_t waveform;  /**< The waveform shape. */
+    uint32_t tickFrequency;                 /**< The frequency of the Cy_CSDIDAC_DdsTick() calls in Hz. */
+} cy_stc_csdidac_dds_config_t;
+
+/** The CSDIDAC DDS structure, that contains the generator state. */
+typedef struct
+{
+    cy_stc_csdidac_dds_config_t cfgCopy;    /**< A configuration structure copy. */
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    uint32_t phase;                         /**< The phase accumulator. */
+    uint32_t phaseIncrement;                /**< The phase increment per tick. */
+    uint32_t sinkMask;                      /**< The IDAC register polarity bits of the negative half-wave. */
+    uint32_t amplitude;                     /**< The waveform amplitude in nA. */
+    cy_en_csdidac_lsb_t lsbIndex;           /**< The LSB used for the whole waveform. */
+    uint32_t regTable[CY_CSDIDAC_DDS_TABLE_SIZE + 1u]; /**< The quarter-wave table of the IDAC register values. */
+} cy_stc_csdidac_dds_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_DdsInit(
+                const cy_stc_csdidac_dds_config_t * config,
+                cy_stc_csdidac_dds_t * dds,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_DdsSetFrequency(
+                uint32_t frequency,
+                cy_stc_csdidac_dds_t * dds);
+cy_en_csdidac_status_t Cy_CSDIDAC_DdsSetAmplitude(
+                uint32_t amplitude,
+                cy_stc_csdidac_dds_t * dds);
+cy_en_csdidac_status_t Cy_CSDIDAC_DdsStart(
+                cy_stc_csdidac_dds_t * dds);
+cy_en_csdidac_status_t Cy_CSDIDAC_DdsStop(
+                cy_stc_csdidac_dds_t * dds);
+void Cy_CSDIDAC_DdsTick(
+                cy_stc_csdidac_dds_t * dds);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_DDS_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,387 @@
+/***************************************************************************//**
+* \file cy_csdidac_diff.c
+* \version 2.20
+*
+* \brief
+* This file provides the implementation of the differential source/sink pair
+* mode of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_diff.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static bool Cy_CSDIDAC_DiffLoadCalibration(
+                const cy_stc_csdidac_range_cal_t * ptrCal,
+                uint32_t lsb,
+                uint32_t * gain,
+                int32_t * offset);
+static uint32_t Cy_CSDIDAC_DiffCorrectCode(
+                uint32_t code,
+                uint32_t gain,
+                int32_t offset);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+#define CY_CSDIDAC_DIFF_Q16_SHIFT               (16u)
+#define CY_CSDIDAC_DIFF_Q32_HALF                (0x80000000uL)
+#define CY_CSDIDAC_DIFF_MAX_OFFSET              ((int64_t)CY_CSDIDAC_MAX_CODE << CY_CSDIDAC_DIFF_Q16_SHIFT)
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DiffInit
+****************************************************************************//**
+*
+* Verifies the configuration and initializes the differential pair of
+* the IDAC A and IDAC B.
+*
+* The differential pair drives the same current magnitude with the opposite
+* polarities: a positive current is sourced by the IDAC A and sunk by
+* the IDAC B, a negative current is sunk by the IDAC A and sourced by
+* the IDAC B. Both channels must be configured as GPIO or AMUX.
+*
+* The optional calibrations match the channels. They are calculated by
+* Cy_CSDIDAC_SweepGetCalibration() from the sweeps of the IDAC A in the source
+* polarity and of the IDAC B in the sink polarity, and are applied to both
+* current directions. The gain scales the current magnitude in both
+* polarities. The offset is the signed current at the zero code, so it adds
+* to the magnitude of the sourced current and subtracts from the magnitude
+* of the sunk current, and Cy_CSDIDAC_DiffSet() applies it with the sign of
+* the active polarity of each channel. The corrections are precomputed by
+* this function, so Cy_CSDIDAC_DiffSet() performs no division.
+*
+* The CSDIDAC middleware must be initialized by Cy_CSDIDAC_Init() prior
+* to calling this function.
+*
+* \param config
+* The pointer to the differential pair configuration structure
+* \ref cy_stc_csdidac_diff_config_t.
+*
+* \param diff
+* The pointer to the differential pair structure \ref cy_stc_csdidac_diff_t
+* allocated by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL, a channel is not
+*                           configured as GPIO or AMUX, or a calibration has
+*                           the gain below 2 or the offset beyond the full
+*                           scale.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_DiffInit(
+                const cy_stc_csdidac_diff_config_t * config,
+                cy_stc_csdidac_diff_t * diff,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t i;
+
+    if ((NULL != config) && (NULL != diff) && (NULL != context))
+    {
+        if (((CY_CSDIDAC_GPIO == context->cfgCopy.configA) || (CY_CSDIDAC_AMUX == context->cfgCopy.configA)) &&
+            ((CY_CSDIDAC_GPIO == context->cfgCopy.configB) || (CY_CSDIDAC_AMUX == context->cfgCopy.configB)))
+        {
+            retVal = CY_CSDIDAC_SUCCESS;
+            for (i = 0u; i < CY_CSDIDAC_LSB_NUM; i++)
+            {
+                if ((false == Cy_CSDIDAC_DiffLoadCalibration((NULL != config->ptrCalA) ? &config->ptrCalA[i] : NULL,
+                                                             cy_csdidac_lsbPa[i], &diff->gainA[i], &diff->offsetA[i])) ||
+                    (false == Cy_CSDIDAC_DiffLoadCalibration((NULL != config->ptrCalB) ? &config->ptrCalB[i] : NULL,
+                                                             cy_csdidac_lsbPa[i], &diff->gainB[i], &diff->offsetB[i])))
+                {
+                    retVal = CY_CSDIDAC_BAD_PARAM;
+                }
+            }
+            diff->ptrCsdidacCxt = context;
+            diff->idacRegValueA = 0u;
+            diff->idacRegValueB = 0u;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DiffStart
+****************************************************************************//**
+*
+* Enables and connects both outputs of the differential pair at the zero code.
+*
+* \param diff
+* The pointer to the differential pair structure \ref cy_stc_csdidac_diff_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+* * CY_CSDIDAC_HW_LOCKED  - The CSD HW block is not captured by the CSDIDAC.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_DiffStart(
+                cy_stc_csdidac_diff_t * diff)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != diff)
+    {
+        retVal = Cy_CSDIDAC_OutputEnableExt(CY_CSDIDAC_AB, CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u, diff->ptrCsdidacCxt);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            diff->idacRegValueA = Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u);
+            diff->idacRegValueB = diff->idacRegValueA;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DiffSet
+****************************************************************************//**
+*
+* Sets the current of the differential pair.
+*
+* The current is converted once to the LSB and the code shared by both
+* channels, the calibration corrections are applied to the code of each
+* channel with the offset sign of its polarity, the next LSB is used if a corrected code exceeds
+* \ref CY_CSDIDAC_MAX_CODE, and both IDAC registers are written in one short critical section,
+* so the channels change their currents back-to-back.
+*
+* \param current
+* The current in nA with a sign, in the range from -\ref CY_CSDIDAC_MAX_CURRENT_NA
+* to \ref CY_CSDIDAC_MAX_CURRENT_NA. A positive current is sourced by
+* the IDAC A and sunk by the IDAC B.
+*
+* \param diff
+* The pointer to the differential pair structure \ref cy_stc_csdidac_diff_t
+* started by Cy_CSDIDAC_DiffStart().
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or the current is out
+*                           of the range.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_DiffSet(
+                int32_t current,
+                cy_stc_csdidac_diff_t * diff)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t absCurrent = (0 > current) ? (uint32_t)(-current) : (uint32_t)current;
+    int32_t offsetSign = (0 > current) ? -1 : 1;
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t code;
+    uint32_t codeA;
+    uint32_t codeB;
+    uint32_t shift;
+    uint32_t idacRegValueA;
+    uint32_t idacRegValueB;
+    uint32_t interruptState;
+
+    if ((NULL != diff) && (CY_CSDIDAC_MAX_CURRENT_NA >= absCurrent))
+    {
+        /* The offsets are signed currents: the IDAC A sources a positive current and the IDAC B sinks it */
+        Cy_CSDIDAC_ConvertCurrent(current, &polarity, &lsbIndex, &code);
+        codeA = Cy_CSDIDAC_DiffCorrectCode(code, diff->gainA[lsbIndex], offsetSign * diff->offsetA[lsbIndex]);
+        codeB = Cy_CSDIDAC_DiffCorrectCode(code, diff->gainB[lsbIndex], -offsetSign * diff->offsetB[lsbIndex]);
+
+        /*
+        * Moves to the next LSB if a corrected code overflows. The LSB ratio is
+        * a power of two, so the code is rounded by the shift of
+        * (lsb + lsb / 2) difference.
+        */
+        while (((CY_CSDIDAC_MAX_CODE < codeA) || (CY_CSDIDAC_MAX_CODE < codeB)) &&
+               ((uint32_t)lsbIndex < (CY_CSDIDAC_LSB_NUM - 1u)))
+        {
+            shift = ((uint32_t)lsbIndex + 1u) + (((uint32_t)lsbIndex + 1u) >> 1u) -
+                    ((uint32_t)lsbIndex + ((uint32_t)lsbIndex >> 1u));
+            code = (code + (1u << (shift - 1u))) >> shift;
+            lsbIndex = (cy_en_csdidac_lsb_t)((uint32_t)lsbIndex + 1u);
+            codeA = Cy_CSDIDAC_DiffCorrectCode(code, diff->gainA[lsbIndex], offsetSign * diff->offsetA[lsbIndex]);
+            codeB = Cy_CSDIDAC_DiffCorrectCode(code, diff->gainB[lsbIndex], -offsetSign * diff->offsetB[lsbIndex]);
+        }
+        codeA = (CY_CSDIDAC_MAX_CODE < codeA) ? CY_CSDIDAC_MAX_CODE : codeA;
+        codeB = (CY_CSDIDAC_MAX_CODE < codeB) ? CY_CSDIDAC_MAX_CODE : codeB;
+
+        idacRegValueA = Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, codeA);
+        idacRegValueB = Cy_CSDIDAC_GetIdacRegValue((CY_CSDIDAC_SOURCE == polarity) ? CY_CSDIDAC_SINK : CY_CSDIDAC_SOURCE,
+                                                   lsbIndex, codeB);
+
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(diff->ptrCsdidacCxt);
+        Cy_CSDIDAC_WriteIdacRegMasked(CY_CSDIDAC_A, idacRegValueA, diff->ptrCsdidacCxt);
+        Cy_CSDIDAC_WriteIdacRegMasked(CY_CSDIDAC_B, idacRegValueB, diff->ptrCsdidacCxt);
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(diff->ptrCsdidacCxt, interruptState);
+        CY_CSDIDAC_VERIFY_NOTIFY(diff->ptrCsdidacCxt)
+
+        diff->idacRegValueA = idacRegValueA;
+        diff->idacRegValueB = idacRegValueB;
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DiffStop
+****************************************************************************//**
+*
+* Disables both outputs of the differential pair.
+*
+* \param diff
+* The pointer to the differential pair structure \ref cy_stc_csdidac_diff_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_DiffStop(
+                cy_stc_csdidac_diff_t * diff)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != diff)
+    {
+        retVal = Cy_CSDIDAC_OutputDisable(CY_CSDIDAC_AB, diff->ptrCsdidacCxt);
+        diff->idacRegValueA = 0u;
+        diff->idacRegValueB = 0u;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DiffLoadCalibration
+****************************************************************************//**
+*
+* Converts the calibration of one LSB range to the code correction factor,
+* that is the nominal LSB to the measured LSB ratio, and the signed offset
+* in the nominal LSBs, positive for the sourced current.
+*
+* \param ptrCal
+* The pointer to the calibration, NULL for the nominal.
+*
+* \param lsb
+* The nominal LSB in pA.
+*
+* \param gain
+* The pointer to the code correction factor in the Q16 format.
+*
+* \param offset
+* The pointer to the offset in the Q16 format.
+*
+* \return
+* False if the calibration is invalid, true otherwise.
+*
+*******************************************************************************/
+static bool Cy_CSDIDAC_DiffLoadCalibration(
+                const cy_stc_csdidac_range_cal_t * ptrCal,
+                uint32_t lsb,
+                uint32_t * gain,
+                int32_t * offset)
+{
+    bool isValid = true;
+    int64_t offsetQ16;
+
+    *gain = 0u;
+    *offset = 0;
+    if (NULL != ptrCal)
+    {
+        offsetQ16 = ((int64_t)ptrCal->offset << CY_CSDIDAC_DIFF_Q16_SHIFT) / (int64_t)lsb;
+        isValid = ((1u < ptrCal->gain) &&
+                   (CY_CSDIDAC_DIFF_MAX_OFFSET >= offsetQ16) && (-CY_CSDIDAC_DIFF_MAX_OFFSET <= offsetQ16));
+        if (true == isValid)
+        {
+            *gain = (uint32_t)((((uint64_t)1u << (2u * CY_CSDIDAC_DIFF_Q16_SHIFT)) + (ptrCal->gain >> 1u)) / ptrCal->gain);
+            *offset = (int32_t)offsetQ16;
+        }
+    }
+
+    return (isValid);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_DiffCorrectCode
+****************************************************************************//**
+*
+* Applies the calibration correction to the nominal code: the offset is
+* subtracted, the result is scaled by the correction factor and rounded
+* to the nearest code. The result can exceed \ref CY_CSDIDAC_MAX_CODE.
+* The zero code is not corrected.
+*
+* \param code
+* The nominal code.
+*
+* \param gain
+* The code correction factor in the Q16 format, zero if not calibrated.
+*
+* \param offset
+* The offset in the nominal LSBs in the Q16 format in the output current
+* direction.
+*
+* \return
+* The corrected code.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDIDAC_DiffCorrectCode(
+                uint32_t code,
+                uint32_t gain,
+                int32_t offset)
+{
+    int64_t value;
+    uint32_t corrected = code;
+
+    if ((0u != gain) && (0u != code))
+    {
+        value = ((int64_t)code << CY_CSDIDAC_DIFF_Q16_SHIFT) - (int64_t)offset;
+        corrected = 0u;
+        if (0 < value)
+        {
+            corrected = (uint32_t)((((uint64_t)value * gain) + CY_CSDIDAC_DIFF_Q32_HALF) >> (2u * CY_CSDIDAC_DIFF_Q16_SHIFT));
+        }
+    }
+
+    return (corrected);
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
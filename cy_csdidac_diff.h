@@ -0,0 +1,93 @@
+/***************************************************************************//**
+* \file cy_csdidac_diff.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the differential source/sink pair mode of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_DIFF_H)
+#define CY_CSDIDAC_DIFF_H
+
+#include "cy_csdidac.h"
+#include "cy_csdidac_sweep.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/** The CSDIDAC differential pair configuration structure */
+typedef struct
+{
+    const cy_stc_csdidac_range_cal_t * ptrCalA; /**< The pointer to \ref CY_CSDIDAC_LSB_NUM calibrations of the IDAC A sourcing current indexed by the LSB index, NULL for the nominal. */
+    const cy_stc_csdidac_range_cal_t * ptrCalB; /**< The pointer to \ref CY_CSDIDAC_LSB_NUM calibrations of the IDAC B sinking current indexed by the LSB index, NULL for the nominal. */
+} cy_stc_csdidac_diff_config_t;
+
+/** The CSDIDAC differential pair structure, that contains the precomputed calibration corrections. */
+typedef struct
+{
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    uint32_t gainA[CY_CSDIDAC_LSB_NUM];     /**< The IDAC A code correction factor in the Q16 format, zero if not calibrated. */
+    int32_t offsetA[CY_CSDIDAC_LSB_NUM];    /**< The IDAC A offset in the nominal LSBs in the Q16 format, positive for the sourced current. */
+    uint32_t gainB[CY_CSDIDAC_LSB_NUM];     /**< The IDAC B code correction factor in the Q16 format, zero if not calibrated. */
+    int32_t offsetB[CY_CSDIDAC_LSB_NUM];    /**< The IDAC B offset in the nominal LSBs in the Q16 format, positive for the sourced current. */
+    uint32_t idacRegValueA;                 /**< The last written IDAC A register value. */
+    uint32_t idacRegValueB;                 /**< The last written IDAC B register value. */
+} cy_stc_csdidac_diff_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_DiffInit(
+                const cy_stc_csdidac_diff_config_t * config,
+                cy_stc_csdidac_diff_t * diff,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_DiffStart(
+                cy_stc_csdidac_diff_t * diff);
+cy_en_csdidac_status_t Cy_CSDIDAC_DiffSet(
+                int32_t current,
+                cy_stc_csdidac_diff_t * diff);
+cy_en_csdidac_status_t Cy_CSDIDAC_DiffStop(
+                cy_stc_csdidac_diff_t * diff);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_DIFF_H */
+
+
+/* [] END OF FILE */
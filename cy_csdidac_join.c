@@ -0,0 +1,335 @@
+/***************************************************************************//**
+* \file cy_csdidac_join.c
+* \version 2.20
+*
+* \brief
+* This file provides the implementation of the joined-channel current split
+* of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_join.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+/* The split unit is the 37.5 nA LSB, the coarse LSB of 4.8 uA is 128 units */
+#define CY_CSDIDAC_JOIN_COARSE_SHIFT            (7u)
+#define CY_CSDIDAC_JOIN_MAX_UNITS               ((CY_CSDIDAC_MAX_CODE << CY_CSDIDAC_JOIN_COARSE_SHIFT) * 2u)
+#define CY_CSDIDAC_JOIN_SIZE                    ((CY_CSDIDAC_JOIN_MAX_UNITS >> CY_CSDIDAC_JOIN_COARSE_SHIFT) + 1u)
+
+/*
+* The units in Q8: (512 * nA) / 75, the reciprocal is rounded up, so the
+* integer and the half units are exact for the joined current range
+*/
+#define CY_CSDIDAC_JOIN_FRACTION_SHIFT          (8u)
+#define CY_CSDIDAC_JOIN_UNIT_RECIPROCAL         (29320310149uLL)
+#define CY_CSDIDAC_JOIN_UNIT_RECIPROCAL_SHIFT   (32u)
+#define CY_CSDIDAC_JOIN_TABLE_SHIFT             (CY_CSDIDAC_JOIN_COARSE_SHIFT + CY_CSDIDAC_JOIN_FRACTION_SHIFT)
+
+/* The table entry layout: 6:0 - the IDAC A code, 10:8 - the IDAC B LSB index */
+#define CY_CSDIDAC_JOIN_LSB_POS                 (8u)
+
+
+/*******************************************************************************
+* Constant Tables
+*******************************************************************************/
+/*
+* The split of the joined current indexed by the current in the coarse LSBs.
+* The IDAC A provides the coarse part in the 4.8 uA LSB. The IDAC B provides
+* the remainder in the smallest LSB that covers the remainder of any current
+* of the index.
+*/
+static const uint16_t cy_csdidac_joinTable[CY_CSDIDAC_JOIN_SIZE] =
+{
+    /* Coarse codes 0..127, the fine LSB index 0 */
+    0x0000u, 0x0001u, 0x0002u, 0x0003u, 0x0004u, 0x0005u, 0x0006u, 0x0007u,
+    0x0008u, 0x0009u, 0x000Au, 0x000Bu, 0x000Cu, 0x000Du, 0x000Eu, 0x000Fu,
+    0x0010u, 0x0011u, 0x0012u, 0x0013u, 0x0014u, 0x0015u, 0x0016u, 0x0017u,
+    0x0018u, 0x0019u, 0x001Au, 0x001Bu, 0x001Cu, 0x001Du, 0x001Eu, 0x001Fu,
+    0x0020u, 0x0021u, 0x0022u, 0x0023u, 0x0024u, 0x0025u, 0x0026u, 0x0027u,
+    0x0028u, 0x0029u, 0x002Au, 0x002Bu, 0x002Cu, 0x002Du, 0x002Eu, 0x002Fu,
+    0x0030u, 0x0031u, 0x0032u, 0x0033u, 0x0034u, 0x0035u, 0x0036u, 0x0037u,
+    0x0038u, 0x0039u, 0x003Au, 0x003Bu, 0x003Cu, 0x003Du, 0x003Eu, 0x003Fu,
+    0x0040u, 0x0041u, 0x0042u, 0x0043u, 0x0044u, 0x0045u, 0x0046u, 0x0047u,
+    0x0048u, 0x0049u, 0x004Au, 0x004Bu, 0x004Cu, 0x004Du, 0x004Eu, 0x004Fu,
+    0x0050u, 0x0051u, 0x0052u, 0x0053u, 0x0054u, 0x0055u, 0x0056u, 0x0057u,
+    0x0058u, 0x0059u, 0x005Au, 0x005Bu, 0x005Cu, 0x005Du, 0x005Eu, 0x005Fu,
+    0x0060u, 0x0061u, 0x0062u, 0x0063u, 0x0064u, 0x0065u, 0x0066u, 0x0067u,
+    0x0068u, 0x0069u, 0x006Au, 0x006Bu, 0x006Cu, 0x006Du, 0x006Eu, 0x006Fu,
+    0x0070u, 0x0071u, 0x0072u, 0x0073u, 0x0074u, 0x0075u, 0x0076u, 0x0077u,
+    0x0078u, 0x0079u, 0x007Au, 0x007Bu, 0x007Cu, 0x007Du, 0x007Eu, 0x007Fu,
+    /* Coarse code 127, the smallest fine LSB index that covers the remainder */
+    0x027Fu, 0x027Fu, 0x027Fu, 0x027Fu, 0x027Fu, 0x027Fu, 0x037Fu, 0x037Fu,
+    0x037Fu, 0x037Fu, 0x037Fu, 0x037Fu, 0x037Fu, 0x037Fu, 0x047Fu, 0x047Fu,
+    0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu,
+    0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu,
+    0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu,
+    0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu,
+    0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu,
+    0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x047Fu, 0x057Fu, 0x057Fu,
+    0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu,
+    0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu,
+    0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu,
+    0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu,
+    0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu,
+    0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu,
+    0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu,
+    0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu, 0x057Fu
+};
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_JoinInit
+****************************************************************************//**
+*
+* Verifies the configuration and initializes the joined-channel current split.
+*
+* When one of the channels is configured as \ref CY_CSDIDAC_JOIN, both IDACs
+* feed the same output. The joined current is split into the coarse part
+* of the IDAC A in the 4.8 uA LSB and the fine remainder of the IDAC B, so
+* the currents up to 614.4 uA are set in 37.5 nA steps, and the currents up to
+* \ref CY_CSDIDAC_JOIN_MAX_CURRENT_NA in the steps of the smallest IDAC B
+* LSB, that covers the remainder. A single channel sets the currents above
+* 304.8 uA in 4.8 uA steps.
+*
+* The CSDIDAC middleware must be initialized by Cy_CSDIDAC_Init() prior
+* to calling this function.
+*
+* \param join
+* The pointer to the joined-channel structure \ref cy_stc_csdidac_join_t
+* allocated by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or no channel is
+*                           configured as \ref CY_CSDIDAC_JOIN.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_JoinInit(
+                cy_stc_csdidac_join_t * join,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((NULL != join) && (NULL != context))
+    {
+        if ((CY_CSDIDAC_JOIN == context->cfgCopy.configA) || (CY_CSDIDAC_JOIN == context->cfgCopy.configB))
+        {
+            join->ptrCsdidacCxt = context;
+            join->idacRegValueA = 0u;
+            join->idacRegValueB = 0u;
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_JoinStart
+****************************************************************************//**
+*
+* Enables both joined channels at the zero code.
+*
+* \param join
+* The pointer to the joined-channel structure \ref cy_stc_csdidac_join_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+* * CY_CSDIDAC_HW_LOCKED  - The CSD HW block is not captured by the CSDIDAC.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_JoinStart(
+                cy_stc_csdidac_join_t * join)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != join)
+    {
+        retVal = Cy_CSDIDAC_OutputEnableExt(CY_CSDIDAC_AB, CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u, join->ptrCsdidacCxt);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            join->idacRegValueA = Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u);
+            join->idacRegValueB = join->idacRegValueA;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_JoinConvertCurrent
+****************************************************************************//**
+*
+* Splits the joined current into the IDAC A and IDAC B register values.
+*
+* The current is converted to the 37.5 nA units with a fraction by
+* a reciprocal multiplication, the split is read from the table indexed by
+* the rounded current in the 4.8 uA units, and the IDAC B code is rounded
+* once by a shift, so the output error is within a half of the IDAC B LSB
+* and the conversion cost does not depend on the current.
+*
+* \param current
+* The joined current in nA with a sign, in the range from
+* -\ref CY_CSDIDAC_JOIN_MAX_CURRENT_NA to \ref CY_CSDIDAC_JOIN_MAX_CURRENT_NA.
+* Both IDACs source a positive current and sink a negative one.
+*
+* \param idacRegValueA
+* The pointer to the IDAC A register value.
+*
+* \param idacRegValueB
+* The pointer to the IDAC B register value.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or the current is out
+*                           of the range.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_JoinConvertCurrent(
+                int32_t current,
+                uint32_t * idacRegValueA,
+                uint32_t * idacRegValueB)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t absCurrent = (0 > current) ? (0u - (uint32_t)current) : (uint32_t)current;
+    cy_en_csdidac_polarity_t polarity = (0 > current) ? CY_CSDIDAC_SINK : CY_CSDIDAC_SOURCE;
+    uint32_t units;
+    uint32_t entry;
+    uint32_t codeA;
+    uint32_t lsbIndexB;
+    uint32_t shift;
+    uint32_t codeB;
+
+    if ((NULL != idacRegValueA) && (NULL != idacRegValueB) && (CY_CSDIDAC_JOIN_MAX_CURRENT_NA >= absCurrent))
+    {
+        units = (uint32_t)(((uint64_t)absCurrent * CY_CSDIDAC_JOIN_UNIT_RECIPROCAL) >> CY_CSDIDAC_JOIN_UNIT_RECIPROCAL_SHIFT);
+        entry = cy_csdidac_joinTable[(units + (1u << (CY_CSDIDAC_JOIN_FRACTION_SHIFT - 1u))) >> CY_CSDIDAC_JOIN_TABLE_SHIFT];
+        codeA = entry & CY_CSDIDAC_MAX_CODE;
+        lsbIndexB = entry >> CY_CSDIDAC_JOIN_LSB_POS;
+
+        /* The LSB of the index N is (1 << (N + N / 2)) units, the remainder with the half LSB is not negative */
+        shift = lsbIndexB + (lsbIndexB >> 1u) + CY_CSDIDAC_JOIN_FRACTION_SHIFT;
+        codeB = (units + ((1u << shift) >> 1u)) - (codeA << CY_CSDIDAC_JOIN_TABLE_SHIFT);
+        codeB >>= shift;
+        codeB = (CY_CSDIDAC_MAX_CODE < codeB) ? CY_CSDIDAC_MAX_CODE : codeB;
+
+        *idacRegValueA = Cy_CSDIDAC_GetIdacRegValue(polarity, CY_CSDIDAC_LSB_4800_IDX, codeA);
+        *idacRegValueB = Cy_CSDIDAC_GetIdacRegValue(polarity, (cy_en_csdidac_lsb_t)lsbIndexB, codeB);
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_JoinSet
+****************************************************************************//**
+*
+* Sets the joined current.
+*
+* The current is split by Cy_CSDIDAC_JoinConvertCurrent() and both IDAC
+* registers are written in one short critical section.
+*
+* \param current
+* The joined current in nA with a sign, in the range from
+* -\ref CY_CSDIDAC_JOIN_MAX_CURRENT_NA to \ref CY_CSDIDAC_JOIN_MAX_CURRENT_NA.
+*
+* \param join
+* The pointer to the joined-channel structure \ref cy_stc_csdidac_join_t
+* started by Cy_CSDIDAC_JoinStart().
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or the current is out
+*                           of the range.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_JoinSet(
+                int32_t current,
+                cy_stc_csdidac_join_t * join)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t idacRegValueA;
+    uint32_t idacRegValueB;
+    uint32_t interruptState;
+
+    if (NULL != join)
+    {
+        retVal = Cy_CSDIDAC_JoinConvertCurrent(current, &idacRegValueA, &idacRegValueB);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(join->ptrCsdidacCxt);
+            Cy_CSDIDAC_WriteIdacRegMasked(CY_CSDIDAC_A, idacRegValueA, join->ptrCsdidacCxt);
+            Cy_CSDIDAC_WriteIdacRegMasked(CY_CSDIDAC_B, idacRegValueB, join->ptrCsdidacCxt);
+            CY_CSDIDAC_EXIT_CRITICAL_SECTION(join->ptrCsdidacCxt, interruptState);
+            CY_CSDIDAC_VERIFY_NOTIFY(join->ptrCsdidacCxt)
+
+            join->idacRegValueA = idacRegValueA;
+            join->idacRegValueB = idacRegValueB;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_JoinStop
+****************************************************************************//**
+*
+* Disables both joined channels.
+*
+* \param join
+* The pointer to the joined-channel structure \ref cy_stc_csdidac_join_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_JoinStop(
+                cy_stc_csdidac_join_t * join)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != join)
+    {
+        retVal = Cy_CSDIDAC_OutputDisable(CY_CSDIDAC_AB, join->ptrCsdidacCxt);
+        join->idacRegValueA = 0u;
+        join->idacRegValueB = 0u;
+    }
+
+    return (retVal);
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
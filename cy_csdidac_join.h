@@ -0,0 +1,97 @@
+/***************************************************************************//**
+* \file cy_csdidac_join.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the joined-channel current split of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_JOIN_H)
+#define CY_CSDIDAC_JOIN_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+/**
+* The maximum joined output current in nA, that is the sum of the maximum
+* currents of both IDACs.
+*/
+#define CY_CSDIDAC_JOIN_MAX_CURRENT_NA          (2u * CY_CSDIDAC_MAX_CURRENT_NA)
+
+/** \} group_csdidac_macros */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/** The CSDIDAC joined-channel structure */
+typedef struct
+{
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    uint32_t idacRegValueA;                 /**< The last written IDAC A register value. */
+    uint32_t idacRegValueB;                 /**< The last written IDAC B register value. */
+} cy_stc_csdidac_join_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_JoinInit(
+                cy_stc_csdidac_join_t * join,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_JoinStart(
+                cy_stc_csdidac_join_t * join);
+cy_en_csdidac_status_t Cy_CSDIDAC_JoinConvertCurrent(
+                int32_t current,
+                uint32_t * idacRegValueA,
+                uint32_t * idacRegValueB);
+cy_en_csdidac_status_t Cy_CSDIDAC_JoinSet(
+                int32_t current,
+                cy_stc_csdidac_join_t * join);
+cy_en_csdidac_status_t Cy_CSDIDAC_JoinStop(
+                cy_stc_csdidac_join_t * join);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_JOIN_H */
+
+
+/* [] END OF FILE */
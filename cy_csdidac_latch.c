@@ -0,0 +1,267 @@
+/***************************************************************************//**
+* \file cy_csdidac_latch.c
+* \version 2.20
+*
+* \brief
+* This file provides the implementation of the double-buffered setpoints
+* of the CSDIDAC middleware, that are latched on an external trigger.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_setpoint.h"
+#include "cy_csdidac_latch.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LatchInit
+****************************************************************************//**
+*
+* Initializes the latch structure with no staged setpoints.
+*
+* The latch decouples the calculation of the output current from the instant
+* of its application: the setpoints are staged by Cy_CSDIDAC_LatchStage()
+* or Cy_CSDIDAC_LatchStageSetpoint() at any time and applied together by
+* Cy_CSDIDAC_LatchTrigger() called from the interrupt service routine of
+* a timer, ADC, or other trigger source.
+*
+* The CSDIDAC middleware must be initialized by Cy_CSDIDAC_Init() prior
+* to calling this function.
+*
+* \param latch
+* The pointer to the latch structure \ref cy_stc_csdidac_latch_t allocated
+* by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_LatchInit(
+                cy_stc_csdidac_latch_t * latch,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((NULL != latch) && (NULL != context))
+    {
+        latch->ptrCsdidacCxt = context;
+        latch->stagedRegValueA = 0u;
+        latch->stagedRegValueB = 0u;
+        latch->pending = 0u;
+        latch->overrun = 0u;
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LatchStage
+****************************************************************************//**
+*
+* Verifies the specified output current and stages it for the next
+* Cy_CSDIDAC_LatchTrigger() call.
+*
+* The verification and conversion rules are the same as for
+* Cy_CSDIDAC_SetpointPrepare(). The output must be enabled by
+* Cy_CSDIDAC_OutputEnable() or Cy_CSDIDAC_OutputEnableExt() prior to
+* the latch.
+*
+* \param ch
+* The channel(s) the setpoint is staged for.
+*
+* \param current
+* The current value in nA with a sign. The absolute value must not exceed
+* \ref CY_CSDIDAC_MAX_CURRENT_NA.
+*
+* \param latch
+* The pointer to the latch structure \ref cy_stc_csdidac_latch_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_LatchStage(
+                cy_en_csdidac_choice_t ch,
+                int32_t current,
+                cy_stc_csdidac_latch_t * latch)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    cy_stc_csdidac_setpoint_t setpoint;
+
+    if (NULL != latch)
+    {
+        retVal = Cy_CSDIDAC_SetpointPrepare(ch, current, &setpoint, latch->ptrCsdidacCxt);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            Cy_CSDIDAC_LatchStageSetpoint(&setpoint, latch);
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LatchStageSetpoint
+****************************************************************************//**
+*
+* Stages the prepared setpoint for the next Cy_CSDIDAC_LatchTrigger() call.
+*
+* If a setpoint staged earlier for the same channel is not latched yet, it is
+* replaced and the channel is marked in the overrun status returned by
+* Cy_CSDIDAC_LatchGetOverrun(). The staged value and the pending status are
+* updated in a short critical section, so the function can be called from
+* the thread mode or from an interrupt of a lower priority than the trigger
+* interrupt.
+*
+* \param setpoint
+* The pointer to the setpoint structure \ref cy_stc_csdidac_setpoint_t
+* prepared by Cy_CSDIDAC_SetpointPrepare() or Cy_CSDIDAC_SetpointPrepareExt()
+* for the context of the latch.
+*
+* \param latch
+* The pointer to the latch structure \ref cy_stc_csdidac_latch_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_LatchStageSetpoint(
+                const cy_stc_csdidac_setpoint_t * setpoint,
+                cy_stc_csdidac_latch_t * latch)
+{
+    uint32_t interruptState;
+    uint32_t mask = 0u;
+
+    if (CY_CSDIDAC_B != setpoint->ch)
+    {
+        mask |= CY_CSDIDAC_LATCH_A_MSK;
+    }
+    if (CY_CSDIDAC_A != setpoint->ch)
+    {
+        mask |= CY_CSDIDAC_LATCH_B_MSK;
+    }
+
+    interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(latch->ptrCsdidacCxt);
+    if (0u != (mask & CY_CSDIDAC_LATCH_A_MSK))
+    {
+        latch->stagedRegValueA = setpoint->idacRegValue;
+    }
+    if (0u != (mask & CY_CSDIDAC_LATCH_B_MSK))
+    {
+        latch->stagedRegValueB = setpoint->idacRegValue;
+    }
+    latch->overrun |= latch->pending & mask;
+    latch->pending |= mask;
+    CY_CSDIDAC_EXIT_CRITICAL_SECTION(latch->ptrCsdidacCxt, interruptState);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LatchTrigger
+****************************************************************************//**
+*
+* Applies the staged setpoints to the IDAC registers.
+*
+* The function is intended to be called first in the interrupt service
+* routine of the trigger source. It performs no verification and applies
+* each pending setpoint by a single IDAC register write, so the outputs
+* change at a fixed delay after the trigger. If no setpoint is pending,
+* the IDAC registers are not written.
+*
+* \param latch
+* The pointer to the latch structure \ref cy_stc_csdidac_latch_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_LatchTrigger(
+                cy_stc_csdidac_latch_t * latch)
+{
+    uint32_t pending = latch->pending;
+
+    if (0u != (pending & CY_CSDIDAC_LATCH_A_MSK))
+    {
+        Cy_CSDIDAC_WriteIdacReg(CY_CSDIDAC_A, latch->stagedRegValueA, latch->ptrCsdidacCxt);
+    }
+    if (0u != (pending & CY_CSDIDAC_LATCH_B_MSK))
+    {
+        Cy_CSDIDAC_WriteIdacReg(CY_CSDIDAC_B, latch->stagedRegValueB, latch->ptrCsdidacCxt);
+    }
+    latch->pending = 0u;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LatchGetPending
+****************************************************************************//**
+*
+* Returns the channels with the staged setpoints not latched yet.
+*
+* \param latch
+* The pointer to the latch structure \ref cy_stc_csdidac_latch_t.
+*
+* \return
+* The combination of \ref CY_CSDIDAC_LATCH_A_MSK and
+* \ref CY_CSDIDAC_LATCH_B_MSK.
+*
+*******************************************************************************/
+uint32_t Cy_CSDIDAC_LatchGetPending(
+                const cy_stc_csdidac_latch_t * latch)
+{
+    return (latch->pending);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LatchGetOverrun
+****************************************************************************//**
+*
+* Returns and clears the overrun status.
+*
+* A channel is marked in the overrun status when its staged setpoint is
+* replaced before being latched, i.e. one update of the channel was missed
+* because the trigger did not occur between two staging calls.
+*
+* \param latch
+* The pointer to the latch structure \ref cy_stc_csdidac_latch_t.
+*
+* \return
+* The combination of \ref CY_CSDIDAC_LATCH_A_MSK and
+* \ref CY_CSDIDAC_LATCH_B_MSK.
+*
+*******************************************************************************/
+uint32_t Cy_CSDIDAC_LatchGetOverrun(
+                cy_stc_csdidac_latch_t * latch)
+{
+    uint32_t interruptState;
+    uint32_t overrun;
+
+    interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(latch->ptrCsdidacCxt);
+    overrun = latch->overrun;
+    latch->overrun = 0u;
+    CY_CSDIDAC_EXIT_CRITICAL_SECTION(latch->ptrCsdidacCxt, interruptState);
+
+    return (overrun);
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,103 @@
+/***************************************************************************//**
+* \file cy_csdidac_latch.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the double-buffered setpoints of the CSDIDAC middleware, that are
+* latched on an external trigger.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_LATCH_H)
+#define CY_CSDIDAC_LATCH_H
+
+#include "cy_csdidac.h"
+#include "cy_csdidac_setpoint.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+/** The latch status mask of the output channel A. */
+#define CY_CSDIDAC_LATCH_A_MSK                  (0x01u)
+
+/** The latch status mask of the output channel B. */
+#define CY_CSDIDAC_LATCH_B_MSK                  (0x02u)
+
+/** \} group_csdidac_macros */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/** The CSDIDAC latch structure, that contains the staged setpoints of both channels. */
+typedef struct
+{
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    volatile uint32_t stagedRegValueA;      /**< The staged IDAC register value of the channel A. */
+    volatile uint32_t stagedRegValueB;      /**< The staged IDAC register value of the channel B. */
+    volatile uint32_t pending;              /**< The channels with the staged setpoints not latched yet. */
+    volatile uint32_t overrun;              /**< The channels with the staged setpoints overwritten before the latch. */
+} cy_stc_csdidac_latch_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_LatchInit(
+                cy_stc_csdidac_latch_t * latch,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_LatchStage(
+                cy_en_csdidac_choice_t ch,
+                int32_t current,
+                cy_stc_csdidac_latch_t * latch);
+void Cy_CSDIDAC_LatchStageSetpoint(
+                const cy_stc_csdidac_setpoint_t * setpoint,
+                cy_stc_csdidac_latch_t * latch);
+void Cy_CSDIDAC_LatchTrigger(
+                cy_stc_csdidac_latch_t * latch);
+uint32_t Cy_CSDIDAC_LatchGetPending(
+                const cy_stc_csdidac_latch_t * latch);
+uint32_t Cy_CSDIDAC_LatchGetOverrun(
+                cy_stc_csdidac_latch_t * latch);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_LATCH_H */
+
+
+/* [] END OF FILE */
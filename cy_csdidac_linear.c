@@ -0,0 +1,517 @@
+/***************************************************************************//**
+* \file cy_csdidac_linear.c
+* \version 2.20
+*
+* \brief
+* This file provides the unified linear code space implementation of
+* the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_linear.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static int32_t Cy_CSDIDAC_LinearClampIndex(int32_t index);
+static uint32_t Cy_CSDIDAC_LinearGetEntryCurrent(uint32_t entry);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+#define CY_CSDIDAC_LINEAR_SIZE                  ((uint32_t)CY_CSDIDAC_LINEAR_MAX_INDEX + 1u)
+
+/* The table entry layout: 6:0 - the code, 10:7 - the IDAC register bits 25:22 */
+#define CY_CSDIDAC_LINEAR_RANGE_SHIFT           (15u)
+#define CY_CSDIDAC_LINEAR_RANGE_MSK             (CY_CSDIDAC_RANGE_MASK >> CY_CSDIDAC_LINEAR_RANGE_SHIFT)
+#define CY_CSDIDAC_LINEAR_LSB_POS               (CY_CSDIDAC_LSB_POS - CY_CSDIDAC_LINEAR_RANGE_SHIFT)
+#define CY_CSDIDAC_LINEAR_LEG2_EN_POS           (CY_CSDIDAC_LEG2_EN_POS - CY_CSDIDAC_LINEAR_RANGE_SHIFT)
+#define CY_CSDIDAC_LINEAR_RANGE_VAL_MSK         (3u)
+
+
+/*******************************************************************************
+* Constant Tables
+*******************************************************************************/
+/*
+* The unique output currents of a channel in the ascending order. Each current
+* is represented by its smallest LSB, so the table contains all the codes of
+* the 37.5 nA LSB and only the codes of the larger LSBs that exceed the maximum
+* current of the previous LSB.
+*/
+static const uint16_t cy_csdidac_linearTable[CY_CSDIDAC_LINEAR_SIZE] =
+{
+    /* LSB index 0, codes 0..127 */
+    0x0200u, 0x0201u, 0x0202u, 0x0203u, 0x0204u, 0x0205u, 0x0206u, 0x0207u,
+    0x0208u, 0x0209u, 0x020Au, 0x020Bu, 0x020Cu, 0x020Du, 0x020Eu, 0x020Fu,
+    0x0210u, 0x0211u, 0x0212u, 0x0213u, 0x0214u, 0x0215u, 0x0216u, 0x0217u,
+    0x0218u, 0x0219u, 0x021Au, 0x021Bu, 0x021Cu, 0x021Du, 0x021Eu, 0x021Fu,
+    0x0220u, 0x0221u, 0x0222u, 0x0223u, 0x0224u, 0x0225u, 0x0226u, 0x0227u,
+    0x0228u, 0x0229u, 0x022Au, 0x022Bu, 0x022Cu, 0x022Du, 0x022Eu, 0x022Fu,
+    0x0230u, 0x0231u, 0x0232u, 0x0233u, 0x0234u, 0x0235u, 0x0236u, 0x0237u,
+    0x0238u, 0x0239u, 0x023Au, 0x023Bu, 0x023Cu, 0x023Du, 0x023Eu, 0x023Fu,
+    0x0240u, 0x0241u, 0x0242u, 0x0243u, 0x0244u, 0x0245u, 0x0246u, 0x0247u,
+    0x0248u, 0x0249u, 0x024Au, 0x024Bu, 0x024Cu, 0x024Du, 0x024Eu, 0x024Fu,
+    0x0250u, 0x0251u, 0x0252u, 0x0253u, 0x0254u, 0x0255u, 0x0256u, 0x0257u,
+    0x0258u, 0x0259u, 0x025Au, 0x025Bu, 0x025Cu, 0x025Du, 0x025Eu, 0x025Fu,
+    0x0260u, 0x0261u, 0x0262u, 0x0263u, 0x0264u, 0x0265u, 0x0266u, 0x0267u,
+    0x0268u, 0x0269u, 0x026Au, 0x026Bu, 0x026Cu, 0x026Du, 0x026Eu, 0x026Fu,
+    0x0270u, 0x0271u, 0x0272u, 0x0273u, 0x0274u, 0x0275u, 0x0276u, 0x0277u,
+    0x0278u, 0x0279u, 0x027Au, 0x027Bu, 0x027Cu, 0x027Du, 0x027Eu, 0x027Fu,
+    /* LSB index 1, codes 64..127 */
+    0x0640u, 0x0641u, 0x0642u, 0x0643u, 0x0644u, 0x0645u, 0x0646u, 0x0647u,
+    0x0648u, 0x0649u, 0x064Au, 0x064Bu, 0x064Cu, 0x064Du, 0x064Eu, 0x064Fu,
+    0x0650u, 0x0651u, 0x0652u, 0x0653u, 0x0654u, 0x0655u, 0x0656u, 0x0657u,
+    0x0658u, 0x0659u, 0x065Au, 0x065Bu, 0x065Cu, 0x065Du, 0x065Eu, 0x065Fu,
+    0x0660u, 0x0661u, 0x0662u, 0x0663u, 0x0664u, 0x0665u, 0x0666u, 0x0667u,
+    0x0668u, 0x0669u, 0x066Au, 0x066Bu, 0x066Cu, 0x066Du, 0x066Eu, 0x066Fu,
+    0x0670u, 0x0671u, 0x0672u, 0x0673u, 0x0674u, 0x0675u, 0x0676u, 0x0677u,
+    0x0678u, 0x0679u, 0x067Au, 0x067Bu, 0x067Cu, 0x067Du, 0x067Eu, 0x067Fu,
+    /* LSB index 2, codes 32..127 */
+    0x02A0u, 0x02A1u, 0x02A2u, 0x02A3u, 0x02A4u, 0x02A5u, 0x02A6u, 0x02A7u,
+    0x02A8u, 0x02A9u, 0x02AAu, 0x02ABu, 0x02ACu, 0x02ADu, 0x02AEu, 0x02AFu,
+    0x02B0u, 0x02B1u, 0x02B2u, 0x02B3u, 0x02B4u, 0x02B5u, 0x02B6u, 0x02B7u,
+    0x02B8u, 0x02B9u, 0x02BAu, 0x02BBu, 0x02BCu, 0x02BDu, 0x02BEu, 0x02BFu,
+    0x02C0u, 0x02C1u, 0x02C2u, 0x02C3u, 0x02C4u, 0x02C5u, 0x02C6u, 0x02C7u,
+    0x02C8u, 0x02C9u, 0x02CAu, 0x02CBu, 0x02CCu, 0x02CDu, 0x02CEu, 0x02CFu,
+    0x02D0u, 0x02D1u, 0x02D2u, 0x02D3u, 0x02D4u, 0x02D5u, 0x02D6u, 0x02D7u,
+    0x02D8u, 0x02D9u, 0x02DAu, 0x02DBu, 0x02DCu, 0x02DDu, 0x02DEu, 0x02DFu,
+    0x02E0u, 0x02E1u, 0x02E2u, 0x02E3u, 0x02E4u, 0x02E5u, 0x02E6u, 0x02E7u,
+    0x02E8u, 0x02E9u, 0x02EAu, 0x02EBu, 0x02ECu, 0x02EDu, 0x02EEu, 0x02EFu,
+    0x02F0u, 0x02F1u, 0x02F2u, 0x02F3u, 0x02F4u, 0x02F5u, 0x02F6u, 0x02F7u,
+    0x02F8u, 0x02F9u, 0x02FAu, 0x02FBu, 0x02FCu, 0x02FDu, 0x02FEu, 0x02FFu,
+    /* LSB index 3, codes 64..127 */
+    0x06C0u, 0x06C1u, 0x06C2u, 0x06C3u, 0x06C4u, 0x06C5u, 0x06C6u, 0x06C7u,
+    0x06C8u, 0x06C9u, 0x06CAu, 0x06CBu, 0x06CCu, 0x06CDu, 0x06CEu, 0x06CFu,
+    0x06D0u, 0x06D1u, 0x06D2u, 0x06D3u, 0x06D4u, 0x06D5u, 0x06D6u, 0x06D7u,
+    0x06D8u, 0x06D9u, 0x06DAu, 0x06DBu, 0x06DCu, 0x06DDu, 0x06DEu, 0x06DFu,
+    0x06E0u, 0x06E1u, 0x06E2u, 0x06E3u, 0x06E4u, 0x06E5u, 0x06E6u, 0x06E7u,
+    0x06E8u, 0x06E9u, 0x06EAu, 0x06EBu, 0x06ECu, 0x06EDu, 0x06EEu, 0x06EFu,
+    0x06F0u, 0x06F1u, 0x06F2u, 0x06F3u, 0x06F4u, 0x06F5u, 0x06F6u, 0x06F7u,
+    0x06F8u, 0x06F9u, 0x06FAu, 0x06FBu, 0x06FCu, 0x06FDu, 0x06FEu, 0x06FFu,
+    /* LSB index 4, codes 32..127 */
+    0x0320u, 0x0321u, 0x0322u, 0x0323u, 0x0324u, 0x0325u, 0x0326u, 0x0327u,
+    0x0328u, 0x0329u, 0x032Au, 0x032Bu, 0x032Cu, 0x032Du, 0x032Eu, 0x032Fu,
+    0x0330u, 0x0331u, 0x0332u, 0x0333u, 0x0334u, 0x0335u, 0x0336u, 0x0337u,
+    0x0338u, 0x0339u, 0x033Au, 0x033Bu, 0x033Cu, 0x033Du, 0x033Eu, 0x033Fu,
+    0x0340u, 0x0341u, 0x0342u, 0x0343u, 0x0344u, 0x0345u, 0x0346u, 0x0347u,
+    0x0348u, 0x0349u, 0x034Au, 0x034Bu, 0x034Cu, 0x034Du, 0x034Eu, 0x034Fu,
+    0x0350u, 0x0351u, 0x0352u, 0x0353u, 0x0354u, 0x0355u, 0x0356u, 0x0357u,
+    0x0358u, 0x0359u, 0x035Au, 0x035Bu, 0x035Cu, 0x035Du, 0x035Eu, 0x035Fu,
+    0x0360u, 0x0361u, 0x0362u, 0x0363u, 0x0364u, 0x0365u, 0x0366u, 0x0367u,
+    0x0368u, 0x0369u, 0x036Au, 0x036Bu, 0x036Cu, 0x036Du, 0x036Eu, 0x036Fu,
+    0x0370u, 0x0371u, 0x0372u, 0x0373u, 0x0374u, 0x0375u, 0x0376u, 0x0377u,
+    0x0378u, 0x0379u, 0x037Au, 0x037Bu, 0x037Cu, 0x037Du, 0x037Eu, 0x037Fu,
+    /* LSB index 5, codes 64..127 */
+    0x0740u, 0x0741u, 0x0742u, 0x0743u, 0x0744u, 0x0745u, 0x0746u, 0x0747u,
+    0x0748u, 0x0749u, 0x074Au, 0x074Bu, 0x074Cu, 0x074Du, 0x074Eu, 0x074Fu,
+    0x0750u, 0x0751u, 0x0752u, 0x0753u, 0x0754u, 0x0755u, 0x0756u, 0x0757u,
+    0x0758u, 0x0759u, 0x075Au, 0x075Bu, 0x075Cu, 0x075Du, 0x075Eu, 0x075Fu,
+    0x0760u, 0x0761u, 0x0762u, 0x0763u, 0x0764u, 0x0765u, 0x0766u, 0x0767u,
+    0x0768u, 0x0769u, 0x076Au, 0x076Bu, 0x076Cu, 0x076Du, 0x076Eu, 0x076Fu,
+    0x0770u, 0x0771u, 0x0772u, 0x0773u, 0x0774u, 0x0775u, 0x0776u, 0x0777u,
+    0x0778u, 0x0779u, 0x077Au, 0x077Bu, 0x077Cu, 0x077Du, 0x077Eu, 0x077Fu,
+};
+
+
+/*
+* The index of the code 0 of each LSB in the table: the table index of
+* the first code of the LSB minus that code, so the index of a current is
+* the offset of its smallest LSB plus its code.
+*/
+static const uint16_t cy_csdidac_linearOffset[CY_CSDIDAC_LSB_NUM] =
+{
+    0u, 64u, 160u, 224u, 320u, 384u,
+};
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LinearInit
+****************************************************************************//**
+*
+* Initializes the linear code space control of the specified channel.
+*
+* The linear code space maps the six overlapping LSB ranges of the IDAC to
+* a single monotonic index: each index step selects the next larger unique
+* output current. A change of the index costs one table load and one IDAC
+* register write, so the index can be used directly as the output of
+* a control loop. The index range is from -\ref CY_CSDIDAC_LINEAR_MAX_INDEX
+* to \ref CY_CSDIDAC_LINEAR_MAX_INDEX, the negative indexes correspond to
+* the sinking currents.
+*
+* The CSDIDAC middleware must be initialized by Cy_CSDIDAC_Init() prior
+* to calling this function.
+*
+* \param ch
+* The output channel: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param linear
+* The pointer to the linear code space structure
+* \ref cy_stc_csdidac_linear_t allocated by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_LinearInit(
+                cy_en_csdidac_choice_t ch,
+                cy_stc_csdidac_linear_t * linear,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((NULL != linear) && (NULL != context))
+    {
+        if (((CY_CSDIDAC_A == ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configA)) ||
+            ((CY_CSDIDAC_B == ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configB)))
+        {
+            linear->ptrCsdidacCxt = context;
+            linear->ch = ch;
+            linear->index = 0;
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LinearStart
+****************************************************************************//**
+*
+* Enables the channel output with the current of the specified index.
+*
+* \param index
+* The linear index in the range from -\ref CY_CSDIDAC_LINEAR_MAX_INDEX
+* to \ref CY_CSDIDAC_LINEAR_MAX_INDEX.
+*
+* \param linear
+* The pointer to the linear code space structure \ref cy_stc_csdidac_linear_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_LinearStart(
+                int32_t index,
+                cy_stc_csdidac_linear_t * linear)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((NULL != linear) && (CY_CSDIDAC_LINEAR_MAX_INDEX >= index) && (-CY_CSDIDAC_LINEAR_MAX_INDEX <= index))
+    {
+        /* Connects the output and writes the register value of the index at once */
+        retVal = Cy_CSDIDAC_OutputEnableReg(linear->ch, Cy_CSDIDAC_LinearGetRegValue(index), true, linear->ptrCsdidacCxt);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            linear->index = index;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LinearSet
+****************************************************************************//**
+*
+* Sets the output current of the specified index.
+*
+* The index is clamped to the range from -\ref CY_CSDIDAC_LINEAR_MAX_INDEX
+* to \ref CY_CSDIDAC_LINEAR_MAX_INDEX. The function performs no other
+* verification and writes only the IDAC register through
+* Cy_CSDIDAC_WriteIdacReg(), which keeps the cached IDAC register value
+* of the CSDIDAC context structure coherent with the output.
+*
+* \param index
+* The linear index.
+*
+* \param linear
+* The pointer to the linear code space structure \ref cy_stc_csdidac_linear_t
+* started by Cy_CSDIDAC_LinearStart().
+*
+*******************************************************************************/
+void Cy_CSDIDAC_LinearSet(
+                int32_t index,
+                cy_stc_csdidac_linear_t * linear)
+{
+    index = Cy_CSDIDAC_LinearClampIndex(index);
+    Cy_CSDIDAC_WriteIdacReg(linear->ch, Cy_CSDIDAC_LinearGetRegValue(index), linear->ptrCsdidacCxt);
+    linear->index = index;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LinearStep
+****************************************************************************//**
+*
+* Changes the output current by the specified number of index steps.
+*
+* The positive steps increase the output current (in the sourcing direction),
+* the negative steps decrease it. The resulting index is clamped as in
+* Cy_CSDIDAC_LinearSet().
+*
+* \param steps
+* The number of index steps.
+*
+* \param linear
+* The pointer to the linear code space structure \ref cy_stc_csdidac_linear_t
+* started by Cy_CSDIDAC_LinearStart().
+*
+*******************************************************************************/
+void Cy_CSDIDAC_LinearStep(
+                int32_t steps,
+                cy_stc_csdidac_linear_t * linear)
+{
+    int32_t index = linear->index;
+
+    /* Clamps the steps before the addition to avoid the overflow */
+    if (steps > (2 * CY_CSDIDAC_LINEAR_MAX_INDEX))
+    {
+        steps = 2 * CY_CSDIDAC_LINEAR_MAX_INDEX;
+    }
+    else if (steps < (-2 * CY_CSDIDAC_LINEAR_MAX_INDEX))
+    {
+        steps = -2 * CY_CSDIDAC_LINEAR_MAX_INDEX;
+    }
+    else
+    {
+        /* The steps are in the range */
+    }
+    Cy_CSDIDAC_LinearSet(index + steps, linear);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LinearGetIndex
+****************************************************************************//**
+*
+* Returns the current linear index of the channel.
+*
+* \param linear
+* The pointer to the linear code space structure \ref cy_stc_csdidac_linear_t.
+*
+* \return
+* The current linear index.
+*
+*******************************************************************************/
+int32_t Cy_CSDIDAC_LinearGetIndex(
+                const cy_stc_csdidac_linear_t * linear)
+{
+    return (linear->index);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LinearFindIndex
+****************************************************************************//**
+*
+* Returns the index of the output current nearest to the specified current.
+*
+* The current out of the range from -\ref CY_CSDIDAC_MAX_CURRENT_NA to
+* \ref CY_CSDIDAC_MAX_CURRENT_NA is clamped. If two output currents are
+* equally near, the smaller magnitude is chosen. The index is computed
+* from the LSB range and the code of the current without a table search.
+*
+* \param current
+* The current value in nA with a sign.
+*
+* \return
+* The linear index.
+*
+*******************************************************************************/
+int32_t Cy_CSDIDAC_LinearFindIndex(
+                int32_t current)
+{
+    uint32_t absCurrent = (0 > current) ? (0u - (uint32_t)current) : (uint32_t)current;
+    uint32_t lsb = (uint32_t)CY_CSDIDAC_LSB_37_IDX;
+    uint32_t low;
+    int32_t index;
+
+    if (absCurrent > CY_CSDIDAC_MAX_CURRENT_NA)
+    {
+        absCurrent = CY_CSDIDAC_MAX_CURRENT_NA;
+    }
+    /* Converts absCurrent to pA */
+    absCurrent *= 1000u;
+
+    /*
+    * Chooses the smallest LSB, that covers the current, and finds the largest
+    * index with the current not exceeding absCurrent. Below the minimum code
+    * of the LSB, the rounded down code is one less than the minimum, that is
+    * the maximum code of the previous LSB, the previous table entry.
+    */
+    while ((lsb < (CY_CSDIDAC_LSB_NUM - 1u)) && (absCurrent > cy_csdidac_lsbMaxCurrentPa[lsb]))
+    {
+        lsb++;
+    }
+    low = (uint32_t)cy_csdidac_linearOffset[lsb] + (absCurrent / cy_csdidac_lsbPa[lsb]);
+
+    /* Chooses the nearest neighbor */
+    if ((low < (CY_CSDIDAC_LINEAR_SIZE - 1u)) &&
+        ((Cy_CSDIDAC_LinearGetEntryCurrent(cy_csdidac_linearTable[low + 1u]) - absCurrent) <
+         (absCurrent - Cy_CSDIDAC_LinearGetEntryCurrent(cy_csdidac_linearTable[low]))))
+    {
+        low++;
+    }
+
+    index = (int32_t)low;
+    if (0 > current)
+    {
+        index = -index;
+    }
+
+    return (index);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LinearGetCurrentPa
+****************************************************************************//**
+*
+* Returns the nominal output current of the specified index.
+*
+* \param index
+* The linear index. The index is clamped as in Cy_CSDIDAC_LinearSet().
+*
+* \return
+* The current value in pA with a sign.
+*
+*******************************************************************************/
+int32_t Cy_CSDIDAC_LinearGetCurrentPa(
+                int32_t index)
+{
+    int32_t current;
+
+    index = Cy_CSDIDAC_LinearClampIndex(index);
+    current = (int32_t)Cy_CSDIDAC_LinearGetEntryCurrent(cy_csdidac_linearTable[(0 > index) ? -index : index]);
+
+    return ((0 > index) ? -current : current);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LinearGetRegValue
+****************************************************************************//**
+*
+* Returns the IDAC register value of the specified index.
+*
+* \param index
+* The linear index. The index is clamped as in Cy_CSDIDAC_LinearSet().
+*
+* \return
+* The IDAC register value.
+*
+*******************************************************************************/
+uint32_t Cy_CSDIDAC_LinearGetRegValue(
+                int32_t index)
+{
+    uint32_t entry;
+    uint32_t idacRegValue;
+
+    index = Cy_CSDIDAC_LinearClampIndex(index);
+    if (0 > index)
+    {
+        entry = cy_csdidac_linearTable[-index];
+        idacRegValue = ((uint32_t)CY_CSDIDAC_SINK) << CY_CSDIDAC_POLARITY_POS;
+    }
+    else
+    {
+        entry = cy_csdidac_linearTable[index];
+        idacRegValue = ((uint32_t)CY_CSDIDAC_SOURCE) << CY_CSDIDAC_POLARITY_POS;
+    }
+    idacRegValue |= (entry & CY_CSDIDAC_MAX_CODE) |
+                    ((entry & CY_CSDIDAC_LINEAR_RANGE_MSK) << CY_CSDIDAC_LINEAR_RANGE_SHIFT);
+
+    return (idacRegValue);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LinearClampIndex
+****************************************************************************//**
+*
+* Clamps the index to the linear code space range.
+*
+* \param index
+* The linear index.
+*
+* \return
+* The clamped linear index.
+*
+*******************************************************************************/
+static int32_t Cy_CSDIDAC_LinearClampIndex(int32_t index)
+{
+    if (index > CY_CSDIDAC_LINEAR_MAX_INDEX)
+    {
+        index = CY_CSDIDAC_LINEAR_MAX_INDEX;
+    }
+    else if (index < -CY_CSDIDAC_LINEAR_MAX_INDEX)
+    {
+        index = -CY_CSDIDAC_LINEAR_MAX_INDEX;
+    }
+    else
+    {
+        /* The index is in the range */
+    }
+
+    return (index);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_LinearGetEntryCurrent
+****************************************************************************//**
+*
+* Returns the output current of the table entry.
+*
+* \param entry
+* The linear table entry.
+*
+* \return
+* The current value in pA.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDIDAC_LinearGetEntryCurrent(uint32_t entry)
+{
+    uint32_t lsbIndex = (((entry >> CY_CSDIDAC_LINEAR_LSB_POS) & CY_CSDIDAC_LINEAR_RANGE_VAL_MSK) << 1u) |
+                        ((entry >> CY_CSDIDAC_LINEAR_LEG2_EN_POS) & 1u);
+
+    return ((entry & CY_CSDIDAC_MAX_CODE) * cy_csdidac_lsbPa[lsbIndex]);
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
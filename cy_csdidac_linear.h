@@ -0,0 +1,106 @@
+/***************************************************************************//**
+* \file cy_csdidac_linear.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the unified linear code space of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_LINEAR_H)
+#define CY_CSDIDAC_LINEAR_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+/**
+* The maximum index of the linear code space. The index range from
+* -CY_CSDIDAC_LINEAR_MAX_INDEX to CY_CSDIDAC_LINEAR_MAX_INDEX covers all
+* the unique output currents of a channel, the negative indexes correspond
+* to the sinking currents.
+*/
+#define CY_CSDIDAC_LINEAR_MAX_INDEX             (511)
+
+/** \} group_csdidac_macros */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/** The CSDIDAC linear code space structure, that contains the channel index. */
+typedef struct
+{
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    cy_en_csdidac_choice_t ch;              /**< The output channel: CY_CSDIDAC_A or CY_CSDIDAC_B. */
+    int32_t index;                          /**< The current linear index. */
+} cy_stc_csdidac_linear_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_LinearInit(
+                cy_en_csdidac_choice_t ch,
+                cy_stc_csdidac_linear_t * linear,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_LinearStart(
+                int32_t index,
+                cy_stc_csdidac_linear_t * linear);
+void Cy_CSDIDAC_LinearSet(
+                int32_t index,
+                cy_stc_csdidac_linear_t * linear);
+void Cy_CSDIDAC_LinearStep(
+                int32_t steps,
+                cy_stc_csdidac_linear_t * linear);
+int32_t Cy_CSDIDAC_LinearGetIndex(
+                const cy_stc_csdidac_linear_t * linear);
+int32_t Cy_CSDIDAC_LinearFindIndex(
+                int32_t current);
+int32_t Cy_CSDIDAC_LinearGetCurrentPa(
+                int32_t index);
+uint32_t Cy_CSDIDAC_LinearGetRegValue(
+                int32_t index);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_LINEAR_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,439 @@
+/***************************************************************************//**
+* \file cy_csdidac_multi.c
+* \version 2.20
+*
+* \brief
+* This file provides the implementation of the multi-instance manager of
+* the CSDIDAC middleware, that controls the IDACs of several CSD HW blocks
+* as one set of virtual channels.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_multi.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static cy_en_csdidac_channel_config_t Cy_CSDIDAC_MultiGetChannelConfig(
+                uint32_t channel,
+                const cy_stc_csdidac_multi_t * multi);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+/* The instance and the IDAC of a virtual channel */
+#define CY_CSDIDAC_MULTI_INSTANCE(channel)      ((channel) >> 1u)
+#define CY_CSDIDAC_MULTI_CH(channel)            ((0u == ((channel) & 1u)) ? CY_CSDIDAC_A : CY_CSDIDAC_B)
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_MultiInit
+****************************************************************************//**
+*
+* Initializes the CSDIDAC instances of the multi-instance manager.
+*
+* The function captures the CSD HW blocks of all the instances back-to-back
+* as Cy_CSDIDAC_Init() does, and then waits for the longest CSD HW block
+* initialization time once instead of once per block. If any CSD HW block
+* cannot be captured, the already captured blocks are released.
+*
+* After the initialization, the single-instance functions are called with
+* the context returned by Cy_CSDIDAC_MultiGetContext().
+*
+* \param configs
+* The pointer to the array of the instance configuration structures
+* \ref cy_stc_csdidac_config_t, each for a different CSD HW block.
+*
+* \param instanceCount
+* The number of the instances from 1u to \ref CY_CSDIDAC_MULTI_MAX_INSTANCES.
+*
+* \param multi
+* The pointer to the multi-instance manager structure
+* \ref cy_stc_csdidac_multi_t allocated by the user.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS           - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM         - The input pointer is NULL or the number of
+*                                  the instances is invalid.
+* * CY_CSDIDAC_HW_LOCKED         - A CSD HW block is already in use by other
+*                                  middleware.
+* * CY_CSDIDAC_HW_FAILURE        - A CSD HW block failure.
+* * CY_CSDIDAC_BAD_CONFIGURATION - An invalid configuration structure.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_MultiInit(
+                const cy_stc_csdidac_config_t * configs,
+                uint32_t instanceCount,
+                cy_stc_csdidac_multi_t * multi)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t slowest = 0u;
+    uint32_t i;
+
+    if ((NULL != configs) && (NULL != multi) &&
+        (0u != instanceCount) && (CY_CSDIDAC_MULTI_MAX_INSTANCES >= instanceCount))
+    {
+        multi->instanceCount = 0u;
+        multi->pending = 0u;
+        retVal = CY_CSDIDAC_SUCCESS;
+
+        /* Captures all the CSD HW blocks without waiting for each of them to settle */
+        for (i = 0u; (i < instanceCount) && (CY_CSDIDAC_SUCCESS == retVal); i++)
+        {
+            retVal = Cy_CSDIDAC_Capture(&configs[i], &multi->context[i]);
+            if (CY_CSDIDAC_SUCCESS == retVal)
+            {
+                multi->regValue[2u * i] = 0u;
+                multi->regValue[(2u * i) + 1u] = 0u;
+                if (configs[i].csdInitTime > configs[slowest].csdInitTime)
+                {
+                    slowest = i;
+                }
+            }
+            else
+            {
+                /* Releases the CSD HW blocks captured before the failure */
+                while (0u != i)
+                {
+                    i--;
+                    (void)Cy_CSDIDAC_DeInit(&multi->context[i]);
+                }
+            }
+        }
+
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            /* Waits for all the CSD HW blocks to settle */
+            (void)Cy_CSDIDAC_Wakeup(&multi->context[slowest]);
+            multi->instanceCount = instanceCount;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_MultiDeInit
+****************************************************************************//**
+*
+* Releases the CSD HW blocks of all the instances of the multi-instance
+* manager by Cy_CSDIDAC_DeInit().
+*
+* \param multi
+* The pointer to the multi-instance manager structure
+* \ref cy_stc_csdidac_multi_t.
+*
+* \return
+* The function returns the status of its operation, that is the status of
+* the first failed instance or CY_CSDIDAC_SUCCESS.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_MultiDeInit(
+                cy_stc_csdidac_multi_t * multi)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    cy_en_csdidac_status_t status;
+    uint32_t i;
+
+    if (NULL != multi)
+    {
+        retVal = CY_CSDIDAC_SUCCESS;
+        for (i = 0u; i < multi->instanceCount; i++)
+        {
+            status = Cy_CSDIDAC_DeInit(&multi->context[i]);
+            if (CY_CSDIDAC_SUCCESS == retVal)
+            {
+                retVal = status;
+            }
+        }
+        multi->instanceCount = 0u;
+        multi->pending = 0u;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_MultiGetContext
+****************************************************************************//**
+*
+* Returns the context of an instance of the multi-instance manager to be used
+* with the single-instance functions.
+*
+* \param instance
+* The index of the instance.
+*
+* \param multi
+* The pointer to the multi-instance manager structure
+* \ref cy_stc_csdidac_multi_t.
+*
+* \return
+* The pointer to the instance context or NULL if the parameters are invalid.
+*
+*******************************************************************************/
+cy_stc_csdidac_context_t * Cy_CSDIDAC_MultiGetContext(
+                uint32_t instance,
+                cy_stc_csdidac_multi_t * multi)
+{
+    cy_stc_csdidac_context_t * ptrContext = NULL;
+
+    if ((NULL != multi) && (instance < multi->instanceCount))
+    {
+        ptrContext = &multi->context[instance];
+    }
+
+    return (ptrContext);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_MultiStart
+****************************************************************************//**
+*
+* Enables all the configured virtual channels with the zero current.
+*
+* \param multi
+* The pointer to the multi-instance manager structure
+* \ref cy_stc_csdidac_multi_t.
+*
+* \return
+* The function returns the status of its operation, that is the status of
+* the first failed channel or CY_CSDIDAC_SUCCESS.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_MultiStart(
+                cy_stc_csdidac_multi_t * multi)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t zeroRegValue = Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u);
+    uint32_t channel;
+
+    if ((NULL != multi) && (0u != multi->instanceCount))
+    {
+        retVal = CY_CSDIDAC_SUCCESS;
+        multi->pending = 0u;
+        for (channel = 0u; (channel < (2u * multi->instanceCount)) && (CY_CSDIDAC_SUCCESS == retVal); channel++)
+        {
+            if (CY_CSDIDAC_DISABLED != Cy_CSDIDAC_MultiGetChannelConfig(channel, multi))
+            {
+                retVal = Cy_CSDIDAC_OutputEnableExt(CY_CSDIDAC_MULTI_CH(channel), CY_CSDIDAC_SOURCE,
+                                                    CY_CSDIDAC_LSB_37_IDX, 0u,
+                                                    &multi->context[CY_CSDIDAC_MULTI_INSTANCE(channel)]);
+                multi->regValue[channel] = zeroRegValue;
+            }
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_MultiStage
+****************************************************************************//**
+*
+* Stages the current of a virtual channel for the next group update.
+*
+* The function converts the current to the IDAC register value out of
+* the time critical path. The staged values of all the virtual channels are
+* written by Cy_CSDIDAC_MultiUpdate() back-to-back. A channel staged twice
+* before the update is written with the last value.
+*
+* \param channel
+* The virtual channel: 2 * i for the IDAC A and 2 * i + 1 for the IDAC B
+* of the instance i.
+*
+* \param current
+* The current value in nA with a sign. If the parameter is positive,
+* a sourcing current is generated. If the parameter is negative, a sinking
+* current is generated.
+*
+* \param multi
+* The pointer to the multi-instance manager structure
+* \ref cy_stc_csdidac_multi_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL, the channel is invalid
+*                           or disabled, or the current is out of range.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_MultiStage(
+                uint32_t channel,
+                int32_t current,
+                cy_stc_csdidac_multi_t * multi)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t idacCode;
+    uint32_t regValue;
+    uint32_t interruptState;
+    uint32_t absCurrent = (0 > current) ? (uint32_t)(-current) : (uint32_t)current;
+
+    if ((NULL != multi) && (channel < (2u * multi->instanceCount)) &&
+        (CY_CSDIDAC_MAX_CURRENT_NA >= absCurrent) &&
+        (CY_CSDIDAC_DISABLED != Cy_CSDIDAC_MultiGetChannelConfig(channel, multi)))
+    {
+        Cy_CSDIDAC_ConvertCurrent(current, &polarity, &lsbIndex, &idacCode);
+        regValue = Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, idacCode);
+
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(&multi->context[0u]);
+        multi->regValue[channel] = regValue;
+        multi->pending |= (1uL << channel);
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(&multi->context[0u], interruptState);
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_MultiUpdate
+****************************************************************************//**
+*
+* Writes the staged register values of all the virtual channels back-to-back.
+*
+* The function is intended to be called from the interrupt service routine of
+* a timer or other trigger source. It performs no parameter checks and writes
+* only the virtual channels staged since the previous update, in the
+* ascending order of the virtual channels, with interrupts disabled. The
+* channels must be enabled by Cy_CSDIDAC_MultiStart().
+*
+* \param multi
+* The pointer to the multi-instance manager structure
+* \ref cy_stc_csdidac_multi_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_MultiUpdate(
+                cy_stc_csdidac_multi_t * multi)
+{
+    uint32_t interruptState;
+    uint32_t pending;
+    uint32_t channel = 0u;
+    #if (0u != CY_CSDIDAC_VERIFY_EN)
+        uint32_t instance;
+    #endif
+
+    interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(&multi->context[0u]);
+    pending = multi->pending;
+    multi->pending = 0u;
+    while (0u != pending)
+    {
+        if (0u != (pending & 1u))
+        {
+            Cy_CSDIDAC_WriteIdacRegMasked(CY_CSDIDAC_MULTI_CH(channel), multi->regValue[channel],
+                                          &multi->context[CY_CSDIDAC_MULTI_INSTANCE(channel)]);
+        }
+        pending >>= 1u;
+        channel++;
+    }
+    CY_CSDIDAC_EXIT_CRITICAL_SECTION(&multi->context[0u], interruptState);
+
+    #if (0u != CY_CSDIDAC_VERIFY_EN)
+        for (instance = 0u; instance < multi->instanceCount; instance++)
+        {
+            Cy_CSDIDAC_VerifyNotify(&multi->context[instance]);
+        }
+    #endif
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_MultiStop
+****************************************************************************//**
+*
+* Disables all the configured virtual channels and discards the staged values.
+*
+* \param multi
+* The pointer to the multi-instance manager structure
+* \ref cy_stc_csdidac_multi_t.
+*
+* \return
+* The function returns the status of its operation, that is the status of
+* the first failed channel or CY_CSDIDAC_SUCCESS.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_MultiStop(
+                cy_stc_csdidac_multi_t * multi)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    cy_en_csdidac_status_t status;
+    uint32_t channel;
+
+    if (NULL != multi)
+    {
+        retVal = CY_CSDIDAC_SUCCESS;
+        multi->pending = 0u;
+        for (channel = 0u; channel < (2u * multi->instanceCount); channel++)
+        {
+            if (CY_CSDIDAC_DISABLED != Cy_CSDIDAC_MultiGetChannelConfig(channel, multi))
+            {
+                status = Cy_CSDIDAC_OutputDisable(CY_CSDIDAC_MULTI_CH(channel),
+                                                  &multi->context[CY_CSDIDAC_MULTI_INSTANCE(channel)]);
+                if (CY_CSDIDAC_SUCCESS == retVal)
+                {
+                    retVal = status;
+                }
+            }
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_MultiGetChannelConfig
+****************************************************************************//**
+*
+* Returns the configuration of the IDAC of a virtual channel.
+*
+* \param channel
+* The virtual channel.
+*
+* \param multi
+* The pointer to the multi-instance manager structure.
+*
+* \return
+* The IDAC channel configuration.
+*
+*******************************************************************************/
+static cy_en_csdidac_channel_config_t Cy_CSDIDAC_MultiGetChannelConfig(
+                uint32_t channel,
+                const cy_stc_csdidac_multi_t * multi)
+{
+    const cy_stc_csdidac_config_t * ptrConfig = &multi->context[CY_CSDIDAC_MULTI_INSTANCE(channel)].cfgCopy;
+
+    return ((0u == (channel & 1u)) ? ptrConfig->configA : ptrConfig->configB);
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,117 @@
+/***************************************************************************//**
+* \file cy_csdidac_multi.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the multi-instance manager of the CSDIDAC middleware, that controls
+* the IDACs of several CSD HW blocks.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_MULTI_H)
+#define CY_CSDIDAC_MULTI_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+#if !defined(CY_CSDIDAC_MULTI_MAX_INSTANCES)
+/**
+* The maximum number of the CSDIDAC instances of the multi-instance manager.
+* The macro can be redefined by the user to the number of the CSD HW blocks
+* of the device.
+*/
+#define CY_CSDIDAC_MULTI_MAX_INSTANCES          (2u)
+#endif
+
+#if ((CY_CSDIDAC_MULTI_MAX_INSTANCES < 1u) || (CY_CSDIDAC_MULTI_MAX_INSTANCES > 16u))
+    #error "CY_CSDIDAC_MULTI_MAX_INSTANCES is out of the 1..16 range"
+#endif
+
+/** The maximum number of the virtual channels of the multi-instance manager. */
+#define CY_CSDIDAC_MULTI_MAX_CHANNELS           (2u * CY_CSDIDAC_MULTI_MAX_INSTANCES)
+
+/** \} group_csdidac_macros */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/**
+* The CSDIDAC multi-instance manager structure. The virtual channel 2 * i is
+* the IDAC A and the virtual channel 2 * i + 1 is the IDAC B of the instance i.
+*/
+typedef struct
+{
+    cy_stc_csdidac_context_t context[CY_CSDIDAC_MULTI_MAX_INSTANCES]; /**< The contexts of the CSDIDAC instances. */
+    uint32_t instanceCount;                 /**< The number of the CSDIDAC instances. */
+    uint32_t regValue[CY_CSDIDAC_MULTI_MAX_CHANNELS]; /**< The staged IDAC register values of the virtual channels. */
+    uint32_t pending;                       /**< The bit mask of the virtual channels staged since the last update. */
+} cy_stc_csdidac_multi_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_MultiInit(
+                const cy_stc_csdidac_config_t * configs,
+                uint32_t instanceCount,
+                cy_stc_csdidac_multi_t * multi);
+cy_en_csdidac_status_t Cy_CSDIDAC_MultiDeInit(
+                cy_stc_csdidac_multi_t * multi);
+cy_stc_csdidac_context_t * Cy_CSDIDAC_MultiGetContext(
+                uint32_t instance,
+                cy_stc_csdidac_multi_t * multi);
+cy_en_csdidac_status_t Cy_CSDIDAC_MultiStart(
+                cy_stc_csdidac_multi_t * multi);
+cy_en_csdidac_status_t Cy_CSDIDAC_MultiStage(
+                uint32_t channel,
+                int32_t current,
+                cy_stc_csdidac_multi_t * multi);
+void Cy_CSDIDAC_MultiUpdate(
+                cy_stc_csdidac_multi_t * multi);
+cy_en_csdidac_status_t Cy_CSDIDAC_MultiStop(
+                cy_stc_csdidac_multi_t * multi);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_MULTI_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,376 @@
+/***************************************************************************//**
+* \file cy_csdidac_pwl.c
+* \version 2.20
+*
+* \brief
+* This file provides the implementation of the piecewise-linear current
+* profile interpolator of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_pwl.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static void Cy_CSDIDAC_PwlLoadSegment(cy_stc_csdidac_pwl_t * pwl);
+static void Cy_CSDIDAC_PwlWrite(cy_stc_csdidac_pwl_t * pwl);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+#define CY_CSDIDAC_PWL_NA_TO_PA                 (1000)
+
+/* The interpolated current is kept in pA in the Q32 format */
+#define CY_CSDIDAC_PWL_FRAC_SHIFT               (32u)
+#define CY_CSDIDAC_PWL_ONE                      (4294967296ull)
+/* One nA in the Q32 pA format, signed for the arithmetic with the negative currents */
+#define CY_CSDIDAC_PWL_NA_TO_Q32                ((int64_t)(CY_CSDIDAC_PWL_NA_TO_PA * CY_CSDIDAC_PWL_ONE))
+#define CY_CSDIDAC_PWL_HALF                     (2147483648u)
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_PwlInit
+****************************************************************************//**
+*
+* Verifies the breakpoints and initializes the piecewise-linear profile.
+*
+* The profile is described by breakpoints of the time in ticks and
+* the current in nA. Between two breakpoints, the current is interpolated
+* linearly on each Cy_CSDIDAC_PwlTick() call. The interpolation uses the Q32
+* fixed-point current in pA and one division per segment, that is performed
+* when the segment starts. The interpolated current is converted to the IDAC
+* register value by the division-free conversion of
+* Cy_CSDIDAC_ConvertCurrentPa(). The deviation of the interpolated current
+* from the exact straight line is below 1 pA before the conversion.
+*
+* The CSDIDAC middleware must be initialized by Cy_CSDIDAC_Init() prior
+* to calling this function.
+*
+* \param config
+* The pointer to the profile configuration structure
+* \ref cy_stc_csdidac_pwl_config_t. The breakpoint times must strictly
+* increase and the breakpoint currents must be in the range from
+* -\ref CY_CSDIDAC_MAX_CURRENT_NA to \ref CY_CSDIDAC_MAX_CURRENT_NA.
+*
+* \param pwl
+* The pointer to the profile structure \ref cy_stc_csdidac_pwl_t allocated
+* by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL, an invalid parameter
+*                           is passed, or the breakpoints are invalid.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_PwlInit(
+                const cy_stc_csdidac_pwl_config_t * config,
+                cy_stc_csdidac_pwl_t * pwl,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    const cy_stc_csdidac_pwl_point_t * ptrPoints;
+    uint32_t absCurrent;
+    uint32_t i;
+
+    if ((NULL != config) && (NULL != pwl) && (NULL != context) &&
+        (NULL != config->ptrPoints) && (2u <= config->pointCount))
+    {
+        if (((CY_CSDIDAC_A == config->ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configA)) ||
+            ((CY_CSDIDAC_B == config->ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configB)))
+        {
+            ptrPoints = config->ptrPoints;
+            retVal = CY_CSDIDAC_SUCCESS;
+            for (i = 0u; (i < config->pointCount) && (CY_CSDIDAC_SUCCESS == retVal); i++)
+            {
+                absCurrent = (0 > ptrPoints[i].current) ? (uint32_t)(-ptrPoints[i].current) : (uint32_t)ptrPoints[i].current;
+                if ((CY_CSDIDAC_MAX_CURRENT_NA < absCurrent) ||
+                    ((0u != i) && (ptrPoints[i].time <= ptrPoints[i - 1u].time)))
+                {
+                    retVal = CY_CSDIDAC_BAD_PARAM;
+                }
+            }
+        }
+    }
+
+    if (CY_CSDIDAC_SUCCESS == retVal)
+    {
+        pwl->cfgCopy = *config;
+        pwl->ptrCsdidacCxt = context;
+        pwl->busy = false;
+        pwl->point = 0u;
+        Cy_CSDIDAC_PwlLoadSegment(pwl);
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_PwlStart
+****************************************************************************//**
+*
+* Enables the output and starts the profile from the first breakpoint.
+*
+* The output current of the first breakpoint is set immediately, each
+* following Cy_CSDIDAC_PwlTick() call advances the profile by one tick.
+*
+* \param pwl
+* The pointer to the profile structure \ref cy_stc_csdidac_pwl_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+* * CY_CSDIDAC_HW_LOCKED  - The CSD HW block is not captured by the CSDIDAC.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_PwlStart(
+                cy_stc_csdidac_pwl_t * pwl)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != pwl)
+    {
+        pwl->busy = false;
+        retVal = Cy_CSDIDAC_OutputEnableExt(pwl->cfgCopy.ch, CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u, pwl->ptrCsdidacCxt);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            pwl->point = 0u;
+            Cy_CSDIDAC_PwlLoadSegment(pwl);
+            pwl->idacRegValue = Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u);
+            Cy_CSDIDAC_PwlWrite(pwl);
+            pwl->busy = true;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_PwlTick
+****************************************************************************//**
+*
+* Advances the profile by one tick and updates the output current.
+*
+* The function is intended to be called from the interrupt service routine of
+* a timer. It performs no parameter checks and writes the IDAC register only
+* if its value changes. When a breakpoint is reached, the interpolated current
+* is set to the exact breakpoint current and the progress callback is called
+* with the breakpoint index. When the last breakpoint is reached, a looped
+* profile restarts from the first breakpoint, that is output instead of
+* the last one, otherwise the profile stops with the last breakpoint
+* current and the completion callback is called.
+*
+* \param pwl
+* The pointer to the profile structure \ref cy_stc_csdidac_pwl_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_PwlTick(
+                cy_stc_csdidac_pwl_t * pwl)
+{
+    uint32_t point;
+
+    if (true == pwl->busy)
+    {
+        pwl->remaining--;
+        if (0u != pwl->remaining)
+        {
+            pwl->value += pwl->slope;
+        }
+        else
+        {
+            pwl->point++;
+            point = pwl->point;
+            if (point == (pwl->cfgCopy.pointCount - 1u))
+            {
+                if (true == pwl->cfgCopy.loop)
+                {
+                    pwl->point = 0u;
+                    Cy_CSDIDAC_PwlLoadSegment(pwl);
+                }
+                else
+                {
+                    pwl->value = (int64_t)pwl->cfgCopy.ptrPoints[point].current *
+                                 CY_CSDIDAC_PWL_NA_TO_Q32;
+                    pwl->busy = false;
+                }
+            }
+            else
+            {
+                Cy_CSDIDAC_PwlLoadSegment(pwl);
+            }
+
+            if (NULL != pwl->cfgCopy.ptrProgressCallback)
+            {
+                pwl->cfgCopy.ptrProgressCallback(point, pwl->cfgCopy.callbackParam);
+            }
+            if ((false == pwl->busy) && (NULL != pwl->cfgCopy.ptrCompleteCallback))
+            {
+                pwl->cfgCopy.ptrCompleteCallback(point, pwl->cfgCopy.callbackParam);
+            }
+        }
+        Cy_CSDIDAC_PwlWrite(pwl);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_PwlIsBusy
+****************************************************************************//**
+*
+* Returns whether the profile is running.
+*
+* \param pwl
+* The pointer to the profile structure \ref cy_stc_csdidac_pwl_t.
+*
+* \return
+* True if the profile is running, false if it is completed or stopped.
+*
+*******************************************************************************/
+bool Cy_CSDIDAC_PwlIsBusy(
+                const cy_stc_csdidac_pwl_t * pwl)
+{
+    return (pwl->busy);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_PwlGetCurrentPa
+****************************************************************************//**
+*
+* Returns the interpolated current before its conversion to the IDAC
+* register value.
+*
+* \param pwl
+* The pointer to the profile structure \ref cy_stc_csdidac_pwl_t.
+*
+* \return
+* The interpolated current in pA rounded to the nearest integer, positive
+* for sourcing.
+*
+*******************************************************************************/
+int64_t Cy_CSDIDAC_PwlGetCurrentPa(
+                const cy_stc_csdidac_pwl_t * pwl)
+{
+    uint64_t absValue = (0 > pwl->value) ? (uint64_t)(-pwl->value) : (uint64_t)pwl->value;
+    int64_t current = (int64_t)((absValue + CY_CSDIDAC_PWL_HALF) >> CY_CSDIDAC_PWL_FRAC_SHIFT);
+
+    return ((0 > pwl->value) ? -current : current);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_PwlStop
+****************************************************************************//**
+*
+* Stops the profile and disables the output.
+*
+* \param pwl
+* The pointer to the profile structure \ref cy_stc_csdidac_pwl_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_PwlStop(
+                cy_stc_csdidac_pwl_t * pwl)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != pwl)
+    {
+        pwl->busy = false;
+        retVal = Cy_CSDIDAC_OutputDisable(pwl->cfgCopy.ch, pwl->ptrCsdidacCxt);
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_PwlLoadSegment
+****************************************************************************//**
+*
+* Sets the interpolated current to the first breakpoint of the current
+* segment and calculates the increment per tick rounded to the nearest Q32
+* value. This is the only division of the interpolation.
+*
+* \param pwl
+* The pointer to the profile structure.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_PwlLoadSegment(cy_stc_csdidac_pwl_t * pwl)
+{
+    const cy_stc_csdidac_pwl_point_t * ptrPoint = &pwl->cfgCopy.ptrPoints[pwl->point];
+    uint32_t length = ptrPoint[1u].time - ptrPoint[0u].time;
+    int64_t delta = ((int64_t)ptrPoint[1u].current - (int64_t)ptrPoint[0u].current) *
+                    CY_CSDIDAC_PWL_NA_TO_Q32;
+    int64_t halfLength = (int64_t)(length >> 1u);
+
+    pwl->value = (int64_t)ptrPoint[0u].current * CY_CSDIDAC_PWL_NA_TO_Q32;
+    pwl->slope = (0 > delta) ? -((halfLength - delta) / (int64_t)length) : ((delta + halfLength) / (int64_t)length);
+    pwl->remaining = length;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_PwlWrite
+****************************************************************************//**
+*
+* Converts the interpolated current to the IDAC register value and writes it
+* if it differs from the last written value.
+*
+* \param pwl
+* The pointer to the profile structure.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_PwlWrite(cy_stc_csdidac_pwl_t * pwl)
+{
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t idacCode;
+    uint32_t idacRegValue;
+
+    /* The breakpoints are verified, so the current is always in the range */
+    (void)Cy_CSDIDAC_ConvertCurrentPa(Cy_CSDIDAC_PwlGetCurrentPa(pwl), &polarity, &lsbIndex, &idacCode);
+    idacRegValue = Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, idacCode);
+    if (idacRegValue != pwl->idacRegValue)
+    {
+        pwl->idacRegValue = idacRegValue;
+        Cy_CSDIDAC_WriteIdacReg(pwl->cfgCopy.ch, idacRegValue, pwl->ptrCsdidacCxt);
+    }
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
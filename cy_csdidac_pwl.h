@@ -0,0 +1,118 @@
+/***************************************************************************//**
+* \file cy_csdidac_pwl.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the piecewise-linear current profile interpolator of the CSDIDAC
+* middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_PWL_H)
+#define CY_CSDIDAC_PWL_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/**
+* Signals the progress of a piecewise-linear profile.
+*
+* The function is called by Cy_CSDIDAC_PwlTick(), that is usually an interrupt
+* service routine, when the profile reaches the breakpoint of the specified
+* index.
+*/
+typedef void (*cy_csdidac_pwl_callback_t)(uint32_t point, void * param);
+
+/** The CSDIDAC piecewise-linear profile breakpoint structure */
+typedef struct
+{
+    uint32_t time;                          /**< The breakpoint time in ticks from the profile start. */
+    int32_t current;                        /**< The breakpoint current in nA with a sign. */
+} cy_stc_csdidac_pwl_point_t;
+
+/** The CSDIDAC piecewise-linear profile configuration structure */
+typedef struct
+{
+    cy_en_csdidac_choice_t ch;              /**< The output channel: CY_CSDIDAC_A or CY_CSDIDAC_B. */
+    const cy_stc_csdidac_pwl_point_t * ptrPoints; /**< The pointer to the breakpoints, e.g. in the flash. */
+    uint32_t pointCount;                    /**< The number of the breakpoints, at least two. */
+    bool loop;                              /**< The profile is repeated from the first breakpoint after the last one. */
+    cy_csdidac_pwl_callback_t ptrProgressCallback; /**< Called on each reached breakpoint. Can be NULL. */
+    cy_csdidac_pwl_callback_t ptrCompleteCallback; /**< Called when a not looped profile completes. Can be NULL. */
+    void * callbackParam;                   /**< The parameter passed to the callbacks. */
+} cy_stc_csdidac_pwl_config_t;
+
+/** The CSDIDAC piecewise-linear profile structure, that contains the interpolator state. */
+typedef struct
+{
+    cy_stc_csdidac_pwl_config_t cfgCopy;    /**< A configuration structure copy. */
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    int64_t value;                          /**< The interpolated current in pA in the Q32 format. */
+    int64_t slope;                          /**< The current increment per tick in pA in the Q32 format. */
+    uint32_t point;                         /**< The index of the first breakpoint of the current segment. */
+    uint32_t remaining;                     /**< The number of the ticks to the next breakpoint. */
+    uint32_t idacRegValue;                  /**< The last written IDAC register value. */
+    bool busy;                              /**< The profile is running. */
+} cy_stc_csdidac_pwl_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_PwlInit(
+                const cy_stc_csdidac_pwl_config_t * config,
+                cy_stc_csdidac_pwl_t * pwl,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_PwlStart(
+                cy_stc_csdidac_pwl_t * pwl);
+void Cy_CSDIDAC_PwlTick(
+                cy_stc_csdidac_pwl_t * pwl);
+bool Cy_CSDIDAC_PwlIsBusy(
+                const cy_stc_csdidac_pwl_t * pwl);
+int64_t Cy_CSDIDAC_PwlGetCurrentPa(
+                const cy_stc_csdidac_pwl_t * pwl);
+cy_en_csdidac_status_t Cy_CSDIDAC_PwlStop(
+                cy_stc_csdidac_pwl_t * pwl);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_PWL_H */
+
+
+/* [] END OF FILE */
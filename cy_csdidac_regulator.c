@@ -0,0 +1,444 @@
+/***************************************************************************//**
+* \file cy_csdidac_regulator.c
+* \version 2.20
+*
+* \brief
+* This file provides the closed-loop current regulator implementation
+* of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_regulator.h"
+#include "cy_csd.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static uint32_t Cy_CSDIDAC_RegulatorConvert(cy_stc_csdidac_regulator_t * regulator);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+#define CY_CSDIDAC_REGULATOR_CONST_1000         (1000u)
+
+/* The error is limited to the span of two joined channels */
+#define CY_CSDIDAC_REGULATOR_ERROR_LIMIT        ((int64_t)CY_CSDIDAC_MAX_CURRENT_NA * 2)
+#define CY_CSDIDAC_REGULATOR_INTEGRAL_LIMIT     (CY_CSDIDAC_REGULATOR_ERROR_LIMIT << CY_CSDIDAC_REGULATOR_GAIN_SHIFT)
+#define CY_CSDIDAC_REGULATOR_OUTPUT_LIMIT       ((int64_t)CY_CSDIDAC_MAX_CURRENT_NA)
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_RegulatorInit
+****************************************************************************//**
+*
+* Initializes the closed-loop current regulator of the specified channel.
+*
+* The regulator keeps the channel current at the target value despite load
+* and temperature drift. Each regulation step takes a feedback sample of the
+* actual current, updates the integer PI state, and writes only the IDAC
+* register of the regulated channel. The output is limited at
+* \ref CY_CSDIDAC_MAX_CODE of the maximum LSB and the integral state is frozen
+* while the output is limited (anti-windup). The LSB is switched automatically
+* with hysteresis when the output current crosses the range boundaries.
+*
+* The CSDIDAC middleware must be initialized by Cy_CSDIDAC_Init() prior
+* to calling this function. The output is not changed by this function.
+*
+* \param config
+* The pointer to the regulator configuration structure
+* \ref cy_stc_csdidac_regulator_config_t.
+*
+* \param regulator
+* The pointer to the regulator structure \ref cy_stc_csdidac_regulator_t
+* allocated by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_RegulatorInit(
+                const cy_stc_csdidac_regulator_config_t * config,
+                cy_stc_csdidac_regulator_t * regulator,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((NULL != config) && (NULL != regulator) && (NULL != context))
+    {
+        if ((CY_CSDIDAC_REGULATOR_MAX_GAIN >= config->kp) &&
+            (CY_CSDIDAC_REGULATOR_MAX_GAIN >= config->ki) &&
+            (((CY_CSDIDAC_A == config->ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configA)) ||
+             ((CY_CSDIDAC_B == config->ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configB))))
+        {
+            regulator->cfgCopy = *config;
+            regulator->ptrCsdidacCxt = context;
+            regulator->target = 0;
+            regulator->output = 0;
+            regulator->integral = 0;
+            regulator->idacRegValue = 0u;
+            regulator->lsbIndex = CY_CSDIDAC_LSB_37_IDX;
+            regulator->saturated = false;
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_RegulatorSetTarget
+****************************************************************************//**
+*
+* Sets the target current of the regulator.
+*
+* The integral state is kept, so the target change is bumpless. The new
+* target is applied by the next Cy_CSDIDAC_RegulatorUpdate() or
+* Cy_CSDIDAC_RegulatorProcess() call.
+*
+* \param target
+* The target current in nA with a sign. The absolute value is in the range
+* from 0 to \ref CY_CSDIDAC_MAX_CURRENT_NA.
+*
+* \param regulator
+* The pointer to the regulator structure \ref cy_stc_csdidac_regulator_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_RegulatorSetTarget(
+                int32_t target,
+                cy_stc_csdidac_regulator_t * regulator)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t absTarget = (0 > target) ? (uint32_t)(-target) : (uint32_t)target;
+
+    if ((NULL != regulator) && (CY_CSDIDAC_MAX_CURRENT_NA >= absTarget))
+    {
+        regulator->target = target;
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_RegulatorStart
+****************************************************************************//**
+*
+* Resets the regulator state and enables the regulated channel output
+* with the target current.
+*
+* The output is connected by Cy_CSDIDAC_OutputEnableExt(), so all
+* subsequent regulation steps write only the IDAC register.
+*
+* \param regulator
+* The pointer to the regulator structure \ref cy_stc_csdidac_regulator_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_RegulatorStart(
+                cy_stc_csdidac_regulator_t * regulator)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t idacRegValue;
+
+    if (NULL != regulator)
+    {
+        regulator->integral = 0;
+        regulator->output = regulator->target;
+        regulator->saturated = false;
+        regulator->lsbIndex = CY_CSDIDAC_LSB_37_IDX;
+
+        idacRegValue = Cy_CSDIDAC_RegulatorConvert(regulator);
+        retVal = Cy_CSDIDAC_OutputEnableExt(regulator->cfgCopy.ch,
+                    (0 > regulator->output) ? CY_CSDIDAC_SINK : CY_CSDIDAC_SOURCE,
+                    regulator->lsbIndex,
+                    idacRegValue & CY_CSDIDAC_MAX_CODE,
+                    regulator->ptrCsdidacCxt);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            regulator->idacRegValue = idacRegValue;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_RegulatorUpdate
+****************************************************************************//**
+*
+* Performs one regulation step with the specified feedback sample.
+*
+* The function calculates the error between the target and the feedback,
+* updates the PI state and writes the new value to the IDAC register of
+* the regulated channel. The register is written only if its value changes.
+* The register value cached in the CSDIDAC context structure is updated
+* accordingly.
+*
+* The output current equals the target current corrected by the PI terms:
+* output = target + (kp * error + sum(ki * error)) / 2^\ref CY_CSDIDAC_REGULATOR_GAIN_SHIFT
+*
+* Cy_CSDIDAC_RegulatorStart() must be called prior to calling this function.
+*
+* \param feedback
+* The measured current in nA with a sign.
+*
+* \param regulator
+* The pointer to the regulator structure \ref cy_stc_csdidac_regulator_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_RegulatorUpdate(
+                int32_t feedback,
+                cy_stc_csdidac_regulator_t * regulator)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    int64_t error;
+    int64_t integral;
+    int64_t output;
+    uint32_t idacRegValue;
+
+    if (NULL != regulator)
+    {
+        error = (int64_t)regulator->target - (int64_t)feedback;
+        if (error > CY_CSDIDAC_REGULATOR_ERROR_LIMIT)
+        {
+            error = CY_CSDIDAC_REGULATOR_ERROR_LIMIT;
+        }
+        else if (error < -CY_CSDIDAC_REGULATOR_ERROR_LIMIT)
+        {
+            error = -CY_CSDIDAC_REGULATOR_ERROR_LIMIT;
+        }
+        else
+        {
+            /* The error is within the limits */
+        }
+
+        integral = (int64_t)regulator->integral + ((int64_t)regulator->cfgCopy.ki * error);
+        if (integral > CY_CSDIDAC_REGULATOR_INTEGRAL_LIMIT)
+        {
+            integral = CY_CSDIDAC_REGULATOR_INTEGRAL_LIMIT;
+        }
+        else if (integral < -CY_CSDIDAC_REGULATOR_INTEGRAL_LIMIT)
+        {
+            integral = -CY_CSDIDAC_REGULATOR_INTEGRAL_LIMIT;
+        }
+        else
+        {
+            /* The integral is within the limits */
+        }
+
+        /* Scales the PI sum symmetrically to avoid the negative bias of the arithmetic shift */
+        output = ((int64_t)regulator->cfgCopy.kp * error) + integral;
+        if (0 > output)
+        {
+            output = -(int64_t)((uint64_t)(-output) >> CY_CSDIDAC_REGULATOR_GAIN_SHIFT);
+        }
+        else
+        {
+            output = (int64_t)((uint64_t)output >> CY_CSDIDAC_REGULATOR_GAIN_SHIFT);
+        }
+        output += regulator->target;
+
+        /* Limits the output and freezes the integral state while the output is limited */
+        regulator->saturated = true;
+        if (output > CY_CSDIDAC_REGULATOR_OUTPUT_LIMIT)
+        {
+            output = CY_CSDIDAC_REGULATOR_OUTPUT_LIMIT;
+            if (0 < error)
+            {
+                integral = regulator->integral;
+            }
+        }
+        else if (output < -CY_CSDIDAC_REGULATOR_OUTPUT_LIMIT)
+        {
+            output = -CY_CSDIDAC_REGULATOR_OUTPUT_LIMIT;
+            if (0 > error)
+            {
+                integral = regulator->integral;
+            }
+        }
+        else
+        {
+            regulator->saturated = false;
+        }
+
+        regulator->integral = (int32_t)integral;
+        regulator->output = (int32_t)output;
+
+        idacRegValue = Cy_CSDIDAC_RegulatorConvert(regulator);
+        if (idacRegValue != regulator->idacRegValue)
+        {
+            Cy_CSDIDAC_WriteIdacReg(regulator->cfgCopy.ch, idacRegValue, regulator->ptrCsdidacCxt);
+            regulator->idacRegValue = idacRegValue;
+        }
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_RegulatorProcess
+****************************************************************************//**
+*
+* Takes the feedback sample from the configured feedback source and performs
+* one regulation step.
+*
+* \param regulator
+* The pointer to the regulator structure \ref cy_stc_csdidac_regulator_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or the feedback source
+*                           is not configured.
+* * Any other status returned by the feedback source.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_RegulatorProcess(
+                cy_stc_csdidac_regulator_t * regulator)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    int32_t feedback = 0;
+
+    if ((NULL != regulator) && (NULL != regulator->cfgCopy.ptrFeedbackFunc))
+    {
+        retVal = regulator->cfgCopy.ptrFeedbackFunc(&feedback, regulator->cfgCopy.feedbackParam);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            retVal = Cy_CSDIDAC_RegulatorUpdate(feedback, regulator);
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_RegulatorStop
+****************************************************************************//**
+*
+* Disables the regulated channel output.
+*
+* \param regulator
+* The pointer to the regulator structure \ref cy_stc_csdidac_regulator_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_RegulatorStop(
+                cy_stc_csdidac_regulator_t * regulator)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != regulator)
+    {
+        retVal = Cy_CSDIDAC_OutputDisable(regulator->cfgCopy.ch, regulator->ptrCsdidacCxt);
+        regulator->integral = 0;
+        regulator->idacRegValue = 0u;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_RegulatorConvert
+****************************************************************************//**
+*
+* Converts the regulator output current to the IDAC register value.
+*
+* The LSB is increased when the output current exceeds the current LSB range
+* and decreased with hysteresis when the output current fits the smaller LSB
+* range. The code is rounded to the nearest value.
+*
+* \param regulator
+* The pointer to the regulator structure \ref cy_stc_csdidac_regulator_t.
+*
+* \return
+* The IDAC register value.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDIDAC_RegulatorConvert(cy_stc_csdidac_regulator_t * regulator)
+{
+    int32_t output = regulator->output;
+    uint32_t absCurrent = ((0 > output) ? (uint32_t)(-output) : (uint32_t)output) * CY_CSDIDAC_REGULATOR_CONST_1000;
+    uint32_t lsb = (uint32_t)regulator->lsbIndex;
+    uint32_t code;
+
+    while ((lsb < (uint32_t)CY_CSDIDAC_LSB_4800_IDX) && (absCurrent > cy_csdidac_lsbMaxCurrentPa[lsb]))
+    {
+        lsb++;
+    }
+    while ((lsb > (uint32_t)CY_CSDIDAC_LSB_37_IDX) &&
+           (absCurrent < (cy_csdidac_lsbMaxCurrentPa[lsb - 1u] -
+                         (cy_csdidac_lsbMaxCurrentPa[lsb - 1u] >> CY_CSDIDAC_REGULATOR_HYST_SHIFT))))
+    {
+        lsb--;
+    }
+
+    code = (absCurrent + (cy_csdidac_lsbPa[lsb] >> 1u)) / cy_csdidac_lsbPa[lsb];
+    if (code > CY_CSDIDAC_MAX_CODE)
+    {
+        code = CY_CSDIDAC_MAX_CODE;
+    }
+    regulator->lsbIndex = (cy_en_csdidac_lsb_t)lsb;
+
+    return (Cy_CSDIDAC_GetIdacRegValue((0 > output) ? CY_CSDIDAC_SINK : CY_CSDIDAC_SOURCE,
+                                       (cy_en_csdidac_lsb_t)lsb, code));
+}
+
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
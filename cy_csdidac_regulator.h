@@ -0,0 +1,139 @@
+/***************************************************************************//**
+* \file cy_csdidac_regulator.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the closed-loop current regulator of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_REGULATOR_H)
+#define CY_CSDIDAC_REGULATOR_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+/**
+* The number of fractional bits of the regulator gains. The kp and ki fields
+* of the \ref cy_stc_csdidac_regulator_config_t structure are specified
+* with 1.0 equal to (1 << CY_CSDIDAC_REGULATOR_GAIN_SHIFT).
+*/
+#define CY_CSDIDAC_REGULATOR_GAIN_SHIFT         (8u)
+
+/**
+* The maximum value of the regulator kp and ki gains.
+*/
+#define CY_CSDIDAC_REGULATOR_MAX_GAIN           (0xFFFFu)
+
+/**
+* The LSB range hand-over hysteresis of the regulator. The regulator switches
+* to the next smaller LSB only when the output current is below the maximum
+* current of that LSB reduced by 1/(2^CY_CSDIDAC_REGULATOR_HYST_SHIFT).
+*/
+#define CY_CSDIDAC_REGULATOR_HYST_SHIFT         (3u)
+
+/** \} group_csdidac_macros */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/**
+* Provides the feedback sample of the regulated current.
+*
+* The function is called by Cy_CSDIDAC_RegulatorProcess() and returns
+* the measured current in nA with the same sign convention as the target:
+* positive for sourcing current, negative for sinking current.
+* The sample can come from the CSDADC middleware or any other source.
+* Any status other than CY_CSDIDAC_SUCCESS skips the regulation step and
+* is returned by Cy_CSDIDAC_RegulatorProcess().
+*/
+typedef cy_en_csdidac_status_t (*cy_csdidac_regulator_feedback_t)(int32_t * feedback, void * param);
+
+/** The CSDIDAC regulator configuration structure */
+typedef struct
+{
+    cy_en_csdidac_choice_t ch;              /**< The regulated channel: CY_CSDIDAC_A or CY_CSDIDAC_B. */
+    uint32_t kp;                            /**< The proportional gain, see \ref CY_CSDIDAC_REGULATOR_GAIN_SHIFT. */
+    uint32_t ki;                            /**< The integral gain per update, see \ref CY_CSDIDAC_REGULATOR_GAIN_SHIFT. */
+    cy_csdidac_regulator_feedback_t ptrFeedbackFunc; /**< The feedback source. Can be NULL if only Cy_CSDIDAC_RegulatorUpdate() is used. */
+    void * feedbackParam;                   /**< The parameter passed to the feedback source. */
+} cy_stc_csdidac_regulator_config_t;
+
+/** The CSDIDAC regulator structure, that contains the regulator state. */
+typedef struct
+{
+    cy_stc_csdidac_regulator_config_t cfgCopy; /**< A configuration structure copy. */
+    cy_stc_csdidac_context_t * ptrCsdidacCxt;  /**< The pointer to the CSDIDAC context structure. */
+    int32_t target;                         /**< The target current in nA. */
+    int32_t output;                         /**< The last output current in nA. */
+    int32_t integral;                       /**< The integral state in nA scaled by the gain factor. */
+    uint32_t idacRegValue;                  /**< The last written IDAC register value. */
+    cy_en_csdidac_lsb_t lsbIndex;           /**< The current LSB of the regulated channel. */
+    bool saturated;                         /**< The output is limited by CY_CSDIDAC_MAX_CODE of the maximum LSB. */
+} cy_stc_csdidac_regulator_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_RegulatorInit(
+                const cy_stc_csdidac_regulator_config_t * config,
+                cy_stc_csdidac_regulator_t * regulator,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_RegulatorSetTarget(
+                int32_t target,
+                cy_stc_csdidac_regulator_t * regulator);
+cy_en_csdidac_status_t Cy_CSDIDAC_RegulatorStart(
+                cy_stc_csdidac_regulator_t * regulator);
+cy_en_csdidac_status_t Cy_CSDIDAC_RegulatorUpdate(
+                int32_t feedback,
+                cy_stc_csdidac_regulator_t * regulator);
+cy_en_csdidac_status_t Cy_CSDIDAC_RegulatorProcess(
+                cy_stc_csdidac_regulator_t * regulator);
+cy_en_csdidac_status_t Cy_CSDIDAC_RegulatorStop(
+                cy_stc_csdidac_regulator_t * regulator);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_REGULATOR_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,387 @@
+/***************************************************************************//**
+* \file cy_csdidac_scan.c
+* \version 2.20
+*
+* \brief
+* This file provides the time-multiplexed pin scanning mode implementation
+* of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_gpio.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_scan.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static void Cy_CSDIDAC_ScanSwitch(
+                uint32_t index,
+                cy_stc_csdidac_scan_t * scan);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ScanInit
+****************************************************************************//**
+*
+* Initializes the time-multiplexed pin scanning mode of the specified channel.
+*
+* The scanning mode connects one IDAC to the pins of the list one at a time,
+* e.g. to bias a set of sensor electrodes in sequence, without
+* the reconfiguration of the CSDIDAC middleware by Cy_CSDIDAC_WriteConfig().
+* Each pin has its own current setpoint that is converted to the IDAC register
+* value by Cy_CSDIDAC_ScanSetCurrent() in advance, so switching to the next
+* pin performs only two HSIOM writes and two IDAC register writes.
+*
+* The channel must be configured as CY_CSDIDAC_GPIO. The scan routes the channel
+* to its own pins, so it cannot be used with the automatic output routing of
+* \ref CY_CSDIDAC_AUTOROUTE_EN enabled. All the pin setpoints are initialized
+* with zero current. The CSDIDAC middleware must be initialized by
+* Cy_CSDIDAC_Init() prior to calling this function.
+*
+* \param config
+* The pointer to the scan configuration structure
+* \ref cy_stc_csdidac_scan_config_t. The pin array must remain valid
+* while the scan is used.
+*
+* \param scan
+* The pointer to the scan structure \ref cy_stc_csdidac_scan_t allocated
+* by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ScanInit(
+                const cy_stc_csdidac_scan_config_t * config,
+                cy_stc_csdidac_scan_t * scan,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t i;
+
+    if ((NULL != config) && (NULL != scan) && (NULL != context))
+    {
+        if ((NULL != config->ptrPins) && (0u != config->pinCount) &&
+            (CY_CSDIDAC_SCAN_MAX_PINS >= config->pinCount) &&
+            (((CY_CSDIDAC_A == config->ch) && (CY_CSDIDAC_GPIO == context->cfgCopy.configA)) ||
+             ((CY_CSDIDAC_B == config->ch) && (CY_CSDIDAC_GPIO == context->cfgCopy.configB))))
+        {
+            retVal = CY_CSDIDAC_SUCCESS;
+            #if (0u != CY_CSDIDAC_AUTOROUTE_EN)
+                if (true == context->autoRouteEn)
+                {
+                    retVal = CY_CSDIDAC_BAD_PARAM;
+                }
+            #endif
+        }
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            scan->cfgCopy = *config;
+            scan->ptrCsdidacCxt = context;
+            for (i = 0u; i < config->pinCount; i++)
+            {
+                scan->idacRegValue[i] = Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u);
+                scan->driveMode[i] = CY_GPIO_DM_ANALOG;
+            }
+            scan->index = 0u;
+            scan->active = false;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ScanSetCurrent
+****************************************************************************//**
+*
+* Sets the current setpoint of the specified pin of the scan list.
+*
+* The current is converted to the IDAC register value with the same rules
+* as in Cy_CSDIDAC_OutputEnable(). If the pin is connected at the moment,
+* the new value is applied immediately.
+*
+* \param index
+* The index of the pin in the scan list.
+*
+* \param current
+* The current value in nA with a sign. The absolute value must not exceed
+* \ref CY_CSDIDAC_MAX_CURRENT_NA.
+*
+* \param scan
+* The pointer to the scan structure \ref cy_stc_csdidac_scan_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ScanSetCurrent(
+                uint32_t index,
+                int32_t current,
+                cy_stc_csdidac_scan_t * scan)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t absCurrent = (0 > current) ? (uint32_t)(-current) : (uint32_t)current;
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t code;
+
+    if ((NULL != scan) && (CY_CSDIDAC_MAX_CURRENT_NA >= absCurrent))
+    {
+        if (index < scan->cfgCopy.pinCount)
+        {
+            Cy_CSDIDAC_ConvertCurrent(current, &polarity, &lsbIndex, &code);
+            scan->idacRegValue[index] = Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, code);
+            if ((true == scan->active) && (index == scan->index))
+            {
+                Cy_CSDIDAC_WriteIdacReg(scan->cfgCopy.ch, scan->idacRegValue[index], scan->ptrCsdidacCxt);
+            }
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ScanStart
+****************************************************************************//**
+*
+* Starts the scan by connecting the channel output to the first pin of
+* the scan list.
+*
+* The channel pin of the CSDIDAC configuration is disconnected. The drive
+* modes of all the pins of the list are saved and set to analog once, so
+* the pin switching changes only the HSIOM settings. The channel is enabled
+* with the setpoint of the first pin, so the register value and the state
+* of the channel in the CSDIDAC context structure follow the scan. The
+* CSDIDAC configuration is not modified. Do not call Cy_CSDIDAC_WriteConfig(),
+* Cy_CSDIDAC_OutputEnable(), or Cy_CSDIDAC_Save() for the scanned channel
+* until Cy_CSDIDAC_ScanStop() is called: they act on the channel pin of
+* the CSDIDAC configuration and leave the scanned pin connected.
+*
+* \param scan
+* The pointer to the scan structure \ref cy_stc_csdidac_scan_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ScanStart(
+                cy_stc_csdidac_scan_t * scan)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    cy_stc_csdidac_context_t * context;
+    const cy_stc_csdidac_pin_t * ptrPin;
+    uint32_t i;
+
+    if ((NULL != scan) && (false == scan->active))
+    {
+        context = scan->ptrCsdidacCxt;
+        (void)Cy_CSDIDAC_OutputDisable(scan->cfgCopy.ch, context);
+        for (i = 0u; i < scan->cfgCopy.pinCount; i++)
+        {
+            ptrPin = &scan->cfgCopy.ptrPins[i];
+            scan->driveMode[i] = CY_CSDIDAC_GPIO_GET_DRIVEMODE(context, ptrPin->ioPcPtr, (uint32_t)ptrPin->pin);
+            CY_CSDIDAC_GPIO_SET_DRIVEMODE(context, ptrPin->ioPcPtr, (uint32_t)ptrPin->pin, CY_GPIO_DM_ANALOG);
+        }
+
+        /* Connects the first pin and enables the channel without the configured pin */
+        scan->index = 0u;
+        ptrPin = &scan->cfgCopy.ptrPins[0u];
+        CY_CSDIDAC_GPIO_SET_HSIOM(context, ptrPin->ioPcPtr, (uint32_t)ptrPin->pin,
+                                  (CY_CSDIDAC_A == scan->cfgCopy.ch) ? HSIOM_SEL_AMUXA : HSIOM_SEL_AMUXB);
+        retVal = Cy_CSDIDAC_OutputEnableReg(scan->cfgCopy.ch, scan->idacRegValue[0u], false, context);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            scan->active = true;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ScanSelect
+****************************************************************************//**
+*
+* Connects the channel output to the specified pin of the scan list.
+*
+* The previous pin is disconnected and the current setpoint of the selected
+* pin is applied.
+*
+* \param index
+* The index of the pin in the scan list.
+*
+* \param scan
+* The pointer to the scan structure \ref cy_stc_csdidac_scan_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL, an invalid parameter
+*                           is passed, or the scan is not started.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ScanSelect(
+                uint32_t index,
+                cy_stc_csdidac_scan_t * scan)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != scan)
+    {
+        if ((true == scan->active) && (index < scan->cfgCopy.pinCount))
+        {
+            Cy_CSDIDAC_ScanSwitch(index, scan);
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ScanNext
+****************************************************************************//**
+*
+* Connects the channel output to the next pin of the scan list.
+*
+* After the last pin the scan wraps around to the first pin. The function is
+* intended to be called from an interrupt and performs no parameter
+* verification.
+*
+* \param scan
+* The pointer to the scan structure \ref cy_stc_csdidac_scan_t started by
+* Cy_CSDIDAC_ScanStart().
+*
+*******************************************************************************/
+void Cy_CSDIDAC_ScanNext(
+                cy_stc_csdidac_scan_t * scan)
+{
+    uint32_t index = scan->index + 1u;
+
+    if (index >= scan->cfgCopy.pinCount)
+    {
+        index = 0u;
+    }
+    Cy_CSDIDAC_ScanSwitch(index, scan);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ScanStop
+****************************************************************************//**
+*
+* Stops the scan, disables the channel, disconnects the scanned pin, and
+* restores the drive modes of the pins of the list saved by
+* Cy_CSDIDAC_ScanStart().
+*
+* \param scan
+* The pointer to the scan structure \ref cy_stc_csdidac_scan_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or the scan is not
+*                           started.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_ScanStop(
+                cy_stc_csdidac_scan_t * scan)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    cy_stc_csdidac_context_t * context;
+    const cy_stc_csdidac_pin_t * ptrPin;
+    uint32_t i;
+
+    if ((NULL != scan) && (true == scan->active))
+    {
+        context = scan->ptrCsdidacCxt;
+        retVal = Cy_CSDIDAC_OutputDisable(scan->cfgCopy.ch, context);
+        ptrPin = &scan->cfgCopy.ptrPins[scan->index];
+        CY_CSDIDAC_GPIO_SET_HSIOM(context, ptrPin->ioPcPtr, (uint32_t)ptrPin->pin, HSIOM_SEL_GPIO);
+        for (i = 0u; i < scan->cfgCopy.pinCount; i++)
+        {
+            ptrPin = &scan->cfgCopy.ptrPins[i];
+            CY_CSDIDAC_GPIO_SET_DRIVEMODE(context, ptrPin->ioPcPtr, (uint32_t)ptrPin->pin, scan->driveMode[i]);
+        }
+        scan->active = false;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_ScanSwitch
+****************************************************************************//**
+*
+* Connects the specified pin to the channel AMUX bus instead of the current
+* pin and writes the pin setpoint to the IDAC register.
+*
+* The IDAC code is zero while the pins are switched, so the current is never
+* interrupted on a driven pin nor shared between two pins.
+*
+* \param index
+* The index of the pin in the scan list.
+*
+* \param scan
+* The pointer to the scan structure \ref cy_stc_csdidac_scan_t.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_ScanSwitch(
+                uint32_t index,
+                cy_stc_csdidac_scan_t * scan)
+{
+    const cy_stc_csdidac_pin_t * ptrOldPin = &scan->cfgCopy.ptrPins[scan->index];
+    const cy_stc_csdidac_pin_t * ptrNewPin = &scan->cfgCopy.ptrPins[index];
+
+    Cy_CSDIDAC_WriteIdacReg(scan->cfgCopy.ch, scan->idacRegValue[scan->index] & ~CY_CSDIDAC_MAX_CODE, scan->ptrCsdidacCxt);
+    CY_CSDIDAC_GPIO_SET_HSIOM(scan->ptrCsdidacCxt, ptrOldPin->ioPcPtr, (uint32_t)ptrOldPin->pin, HSIOM_SEL_GPIO);
+    CY_CSDIDAC_GPIO_SET_HSIOM(scan->ptrCsdidacCxt, ptrNewPin->ioPcPtr, (uint32_t)ptrNewPin->pin,
+                              (CY_CSDIDAC_A == scan->cfgCopy.ch) ? HSIOM_SEL_AMUXA : HSIOM_SEL_AMUXB);
+    Cy_CSDIDAC_WriteIdacReg(scan->cfgCopy.ch, scan->idacRegValue[index], scan->ptrCsdidacCxt);
+    scan->index = index;
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,118 @@
+/***************************************************************************//**
+* \file cy_csdidac_scan.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the time-multiplexed pin scanning mode of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_SCAN_H)
+#define CY_CSDIDAC_SCAN_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+#if !defined(CY_CSDIDAC_SCAN_MAX_PINS)
+/**
+* The maximum number of pins in the scan list of one channel. The macro can
+* be redefined by the user to trade off the RAM size of the
+* \ref cy_stc_csdidac_scan_t structure against the number of pins.
+*/
+#define CY_CSDIDAC_SCAN_MAX_PINS                (8u)
+#endif
+
+#if ((CY_CSDIDAC_SCAN_MAX_PINS < 1u) || (CY_CSDIDAC_SCAN_MAX_PINS > 255u))
+    #error "CY_CSDIDAC_SCAN_MAX_PINS is out of the 1..255 range"
+#endif
+
+/** \} group_csdidac_macros */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/** The CSDIDAC pin scan configuration structure */
+typedef struct
+{
+    cy_en_csdidac_choice_t ch;              /**< The scanned channel: CY_CSDIDAC_A or CY_CSDIDAC_B. */
+    const cy_stc_csdidac_pin_t * ptrPins;   /**< The pointer to the array of the scanned pins. */
+    uint32_t pinCount;                      /**< The number of the scanned pins. */
+} cy_stc_csdidac_scan_config_t;
+
+/** The CSDIDAC pin scan structure, that contains the scan state. */
+typedef struct
+{
+    cy_stc_csdidac_scan_config_t cfgCopy;   /**< A configuration structure copy. */
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    uint32_t idacRegValue[CY_CSDIDAC_SCAN_MAX_PINS]; /**< The IDAC register values of the scanned pins. */
+    uint32_t driveMode[CY_CSDIDAC_SCAN_MAX_PINS]; /**< The drive modes of the scanned pins saved by Cy_CSDIDAC_ScanStart(). */
+    uint32_t index;                         /**< The index of the connected pin. */
+    bool active;                            /**< The scan is started. */
+} cy_stc_csdidac_scan_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_ScanInit(
+                const cy_stc_csdidac_scan_config_t * config,
+                cy_stc_csdidac_scan_t * scan,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_ScanSetCurrent(
+                uint32_t index,
+                int32_t current,
+                cy_stc_csdidac_scan_t * scan);
+cy_en_csdidac_status_t Cy_CSDIDAC_ScanStart(
+                cy_stc_csdidac_scan_t * scan);
+cy_en_csdidac_status_t Cy_CSDIDAC_ScanSelect(
+                uint32_t index,
+                cy_stc_csdidac_scan_t * scan);
+void Cy_CSDIDAC_ScanNext(
+                cy_stc_csdidac_scan_t * scan);
+cy_en_csdidac_status_t Cy_CSDIDAC_ScanStop(
+                cy_stc_csdidac_scan_t * scan);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_SCAN_H */
+
+
+/* [] END OF FILE */
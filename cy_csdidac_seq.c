@@ -0,0 +1,596 @@
+/***************************************************************************//**
+* \file cy_csdidac_seq.c
+* \version 2.20
+*
+* \brief
+* This file provides the current profile sequencer implementation of
+* the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_seq.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static cy_en_csdidac_status_t Cy_CSDIDAC_SeqCheckInstruction(
+                uint32_t instruction,
+                const uint32_t * ptrBuffer);
+static void Cy_CSDIDAC_SeqRampStep(cy_stc_csdidac_seq_t * seq);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+/* The IDAC register bits allowed in the operand of the SET_RAW instruction */
+#define CY_CSDIDAC_SEQ_RAW_MSK                  (CY_CSDIDAC_MAX_CODE | \
+                                                 ((uint32_t)CY_CSDIDAC_SINK << CY_CSDIDAC_POLARITY_POS) | \
+                                                 CY_CSDIDAC_RANGE_MASK)
+
+/* The sign bit of the SET_CURRENT instruction operand */
+#define CY_CSDIDAC_SEQ_OPERAND_SIGN             (0x08000000uL)
+
+/* The maximum sequence duration in ticks */
+#define CY_CSDIDAC_SEQ_MAX_DURATION             (0xFFFFFFFFuL)
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SeqInit
+****************************************************************************//**
+*
+* Initializes the sequencer of the specified channel.
+*
+* The sequencer executes a timed current profile composed of the sequence
+* instructions by the macros of the Sequence Assembler section, e.g.:
+* \code
+* static const uint32_t biasSeq[] =
+* {
+*     CY_CSDIDAC_SEQ_SET_CURRENT(20000),
+*     CY_CSDIDAC_SEQ_WAIT(100u),
+*     CY_CSDIDAC_SEQ_LOOP(3u),
+*         CY_CSDIDAC_SEQ_SET_RAW(CY_CSDIDAC_SINK, CY_CSDIDAC_LSB_2400_IDX, 10u),
+*         CY_CSDIDAC_SEQ_RAMP(100u, 50u),
+*         CY_CSDIDAC_SEQ_WAIT(20u),
+*     CY_CSDIDAC_SEQ_LOOP_END,
+*     CY_CSDIDAC_SEQ_DISABLE,
+*     CY_CSDIDAC_SEQ_END,
+* };
+* \endcode
+*
+* The CSDIDAC middleware must be initialized by Cy_CSDIDAC_Init() prior
+* to calling this function.
+*
+* \param ch
+* The output channel: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param seq
+* The pointer to the sequence structure \ref cy_stc_csdidac_seq_t allocated
+* by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_SeqInit(
+                cy_en_csdidac_choice_t ch,
+                cy_stc_csdidac_seq_t * seq,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((NULL != seq) && (NULL != context))
+    {
+        if (((CY_CSDIDAC_A == ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configA)) ||
+            ((CY_CSDIDAC_B == ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configB)))
+        {
+            seq->ptrCsdidacCxt = context;
+            seq->ptrProgram = NULL;
+            seq->duration = 0u;
+            seq->ch = ch;
+            seq->busy = false;
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SeqLoad
+****************************************************************************//**
+*
+* Verifies the sequence and loads it to the sequencer.
+*
+* The function verifies the operands of all the instructions, the loop
+* nesting, and that the END instruction is the last one, so
+* Cy_CSDIDAC_SeqTick() executes the sequence without any checks. A loop
+* body without a WAIT or RAMP instruction is rejected, because it would
+* execute all its iterations within one Cy_CSDIDAC_SeqTick() call. The
+* function also calculates the sequence duration returned by
+* Cy_CSDIDAC_SeqGetDuration(), so a sequence can be validated and timed
+* on the host.
+*
+* The SET_CURRENT instructions are resolved to the SET_RAW instructions in
+* the ptrBuffer array. If the sequence has no SET_CURRENT instructions, the
+* ptrBuffer parameter can be NULL and the sequence is executed directly from
+* the program array, that can be placed in the flash.
+*
+* \param program
+* The pointer to the sequence instructions.
+*
+* \param length
+* The number of the sequence instructions.
+*
+* \param ptrBuffer
+* The pointer to the array of length instructions for the resolved sequence
+* or NULL. The array can be the same as the program array.
+*
+* \param seq
+* The pointer to the sequence structure \ref cy_stc_csdidac_seq_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL, the sequence is
+*                           invalid, or the sequencer is running.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_SeqLoad(
+                const uint32_t * program,
+                uint32_t length,
+                uint32_t * ptrBuffer,
+                cy_stc_csdidac_seq_t * seq)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint64_t duration[CY_CSDIDAC_SEQ_LOOP_DEPTH + 1u];
+    uint32_t count[CY_CSDIDAC_SEQ_LOOP_DEPTH + 1u];
+    uint32_t level = 0u;
+    uint32_t i;
+    uint32_t instruction;
+    uint32_t operand;
+    int32_t current;
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t code;
+
+    if ((NULL != program) && (NULL != seq) && (0u != length))
+    {
+        if ((false == seq->busy) &&
+            (CY_CSDIDAC_SEQ_END == program[length - 1u]))
+        {
+            retVal = CY_CSDIDAC_SUCCESS;
+            duration[0u] = 0u;
+        }
+    }
+
+    /* Verifies the instructions and calculates the duration */
+    for (i = 0u; (CY_CSDIDAC_SUCCESS == retVal) && (i < (length - 1u)); i++)
+    {
+        instruction = program[i];
+        operand = instruction & CY_CSDIDAC_SEQ_OPERAND_MSK;
+        retVal = Cy_CSDIDAC_SeqCheckInstruction(instruction, ptrBuffer);
+
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            switch (instruction >> CY_CSDIDAC_SEQ_OPCODE_POS)
+            {
+                case CY_CSDIDAC_SEQ_OP_WAIT:
+                    duration[level] += operand;
+                    break;
+                case CY_CSDIDAC_SEQ_OP_RAMP:
+                    duration[level] += operand >> CY_CSDIDAC_SEQ_RAMP_TICKS_POS;
+                    break;
+                case CY_CSDIDAC_SEQ_OP_LOOP:
+                    if (CY_CSDIDAC_SEQ_LOOP_DEPTH > level)
+                    {
+                        level++;
+                        duration[level] = 0u;
+                        count[level] = operand;
+                    }
+                    else
+                    {
+                        retVal = CY_CSDIDAC_BAD_PARAM;
+                    }
+                    break;
+                case CY_CSDIDAC_SEQ_OP_LOOP_END:
+                    /* The loop body must take at least one tick */
+                    if ((0u != level) && (0u != duration[level]))
+                    {
+                        duration[level - 1u] += duration[level] * count[level];
+                        level--;
+                    }
+                    else
+                    {
+                        retVal = CY_CSDIDAC_BAD_PARAM;
+                    }
+                    break;
+                default:
+                    /* The other instructions take no time */
+                    break;
+            }
+            /* Saturates the duration, so the loop multiplication never overflows */
+            if (duration[level] > CY_CSDIDAC_SEQ_MAX_DURATION)
+            {
+                duration[level] = CY_CSDIDAC_SEQ_MAX_DURATION;
+            }
+        }
+    }
+
+    if ((CY_CSDIDAC_SUCCESS == retVal) && (0u != level))
+    {
+        retVal = CY_CSDIDAC_BAD_PARAM;
+    }
+
+    if (CY_CSDIDAC_SUCCESS == retVal)
+    {
+        seq->ptrProgram = program;
+        if (NULL != ptrBuffer)
+        {
+            /* Resolves the SET_CURRENT instructions to the IDAC register values */
+            for (i = 0u; i < length; i++)
+            {
+                instruction = program[i];
+                if (CY_CSDIDAC_SEQ_OP_SET_CURRENT == (instruction >> CY_CSDIDAC_SEQ_OPCODE_POS))
+                {
+                    current = (int32_t)((instruction & CY_CSDIDAC_SEQ_OPERAND_MSK) ^ CY_CSDIDAC_SEQ_OPERAND_SIGN) -
+                              (int32_t)CY_CSDIDAC_SEQ_OPERAND_SIGN;
+                    Cy_CSDIDAC_ConvertCurrent(current, &polarity, &lsbIndex, &code);
+                    instruction = ((uint32_t)CY_CSDIDAC_SEQ_OP_SET_RAW << CY_CSDIDAC_SEQ_OPCODE_POS) |
+                                  Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, code);
+                }
+                ptrBuffer[i] = instruction;
+            }
+            seq->ptrProgram = ptrBuffer;
+        }
+        seq->duration = (uint32_t)duration[0u];
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SeqStart
+****************************************************************************//**
+*
+* Enables the channel output and starts the loaded sequence.
+*
+* The output is enabled with the zero current. The first instructions of the
+* sequence are executed by the next Cy_CSDIDAC_SeqTick() call.
+*
+* \param seq
+* The pointer to the sequence structure \ref cy_stc_csdidac_seq_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or no sequence
+*                           is loaded.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_SeqStart(
+                cy_stc_csdidac_seq_t * seq)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((NULL != seq) && (NULL != seq->ptrProgram))
+    {
+        seq->busy = false;
+        retVal = Cy_CSDIDAC_OutputEnableExt(seq->ch, CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u, seq->ptrCsdidacCxt);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            seq->idacRegValue = Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u);
+            seq->pc = 0u;
+            seq->holdCount = 0u;
+            seq->rampTicks = 0u;
+            seq->loopLevel = 0u;
+            seq->busy = true;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SeqTick
+****************************************************************************//**
+*
+* Executes the sequence for one tick.
+*
+* The function is intended to be called periodically, e.g. from a timer
+* interrupt. It executes the instructions of the sequence until
+* a WAIT or RAMP instruction, that takes the specified number of ticks,
+* or the END instruction. Each instruction costs a few cycles and at most
+* one IDAC register write, the IDAC register values are resolved by
+* Cy_CSDIDAC_SeqLoad(). Each loop body takes at least one tick, so one call
+* executes each instruction of the sequence at most once. The function
+* performs no verification. The IDAC register writes keep the register value
+* cached in the CSDIDAC context structure coherent with the output.
+*
+* \param seq
+* The pointer to the sequence structure \ref cy_stc_csdidac_seq_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_SeqTick(
+                cy_stc_csdidac_seq_t * seq)
+{
+    bool hold = (false == seq->busy);
+    uint32_t instruction;
+    uint32_t operand;
+    cy_stc_csdidac_seq_loop_t * ptrLoop;
+
+    if ((false == hold) && (0u != seq->holdCount))
+    {
+        seq->holdCount--;
+        if (0u != seq->rampTicks)
+        {
+            Cy_CSDIDAC_SeqRampStep(seq);
+        }
+        hold = true;
+    }
+
+    while (false == hold)
+    {
+        instruction = seq->ptrProgram[seq->pc];
+        operand = instruction & CY_CSDIDAC_SEQ_OPERAND_MSK;
+        seq->pc++;
+        seq->rampTicks = 0u;
+
+        switch (instruction >> CY_CSDIDAC_SEQ_OPCODE_POS)
+        {
+            case CY_CSDIDAC_SEQ_OP_SET_RAW:
+                seq->idacRegValue = operand;
+                Cy_CSDIDAC_WriteIdacReg(seq->ch, operand, seq->ptrCsdidacCxt);
+                break;
+            case CY_CSDIDAC_SEQ_OP_WAIT:
+                seq->holdCount = operand - 1u;
+                hold = true;
+                break;
+            case CY_CSDIDAC_SEQ_OP_RAMP:
+                seq->rampTicks = operand >> CY_CSDIDAC_SEQ_RAMP_TICKS_POS;
+                seq->holdCount = seq->rampTicks - 1u;
+                seq->rampError = 0u;
+                operand &= CY_CSDIDAC_MAX_CODE;
+                seq->rampDown = (operand < (seq->idacRegValue & CY_CSDIDAC_MAX_CODE));
+                seq->rampDelta = (true == seq->rampDown) ?
+                                 ((seq->idacRegValue & CY_CSDIDAC_MAX_CODE) - operand) :
+                                 (operand - (seq->idacRegValue & CY_CSDIDAC_MAX_CODE));
+                Cy_CSDIDAC_SeqRampStep(seq);
+                hold = true;
+                break;
+            case CY_CSDIDAC_SEQ_OP_LOOP:
+                ptrLoop = &seq->loop[seq->loopLevel];
+                ptrLoop->pc = seq->pc;
+                ptrLoop->count = operand;
+                seq->loopLevel++;
+                break;
+            case CY_CSDIDAC_SEQ_OP_LOOP_END:
+                ptrLoop = &seq->loop[seq->loopLevel - 1u];
+                ptrLoop->count--;
+                if (0u != ptrLoop->count)
+                {
+                    seq->pc = ptrLoop->pc;
+                }
+                else
+                {
+                    seq->loopLevel--;
+                }
+                break;
+            case CY_CSDIDAC_SEQ_OP_DISABLE:
+                seq->idacRegValue = 0u;
+                Cy_CSDIDAC_WriteIdacReg(seq->ch, 0u, seq->ptrCsdidacCxt);
+                break;
+            default:
+                /* CY_CSDIDAC_SEQ_OP_END */
+                seq->busy = false;
+                hold = true;
+                break;
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SeqIsBusy
+****************************************************************************//**
+*
+* Returns the sequencer state.
+*
+* \param seq
+* The pointer to the sequence structure \ref cy_stc_csdidac_seq_t.
+*
+* \return
+* True if the sequence is running, false if the END instruction is reached
+* or the sequence is not started.
+*
+*******************************************************************************/
+bool Cy_CSDIDAC_SeqIsBusy(
+                const cy_stc_csdidac_seq_t * seq)
+{
+    return (seq->busy);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SeqGetDuration
+****************************************************************************//**
+*
+* Returns the duration of the loaded sequence.
+*
+* \param seq
+* The pointer to the sequence structure \ref cy_stc_csdidac_seq_t.
+*
+* \return
+* The total number of ticks taken by the WAIT and RAMP instructions including
+* the loop iterations. The END instruction is executed by the next
+* Cy_CSDIDAC_SeqTick() call after this number of calls. The value is
+* saturated at 0xFFFFFFFF.
+*
+*******************************************************************************/
+uint32_t Cy_CSDIDAC_SeqGetDuration(
+                const cy_stc_csdidac_seq_t * seq)
+{
+    return (seq->duration);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SeqStop
+****************************************************************************//**
+*
+* Stops the sequence and disables the channel output.
+*
+* \param seq
+* The pointer to the sequence structure \ref cy_stc_csdidac_seq_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_SeqStop(
+                cy_stc_csdidac_seq_t * seq)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != seq)
+    {
+        seq->busy = false;
+        retVal = Cy_CSDIDAC_OutputDisable(seq->ch, seq->ptrCsdidacCxt);
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SeqCheckInstruction
+****************************************************************************//**
+*
+* Verifies the opcode and operand of the sequence instruction, except the
+* loop nesting and the END instruction position.
+*
+* \param instruction
+* The sequence instruction.
+*
+* \param ptrBuffer
+* The pointer to the resolved sequence buffer.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The instruction is valid.
+* * CY_CSDIDAC_BAD_PARAM  - The instruction is invalid.
+*
+*******************************************************************************/
+static cy_en_csdidac_status_t Cy_CSDIDAC_SeqCheckInstruction(
+                uint32_t instruction,
+                const uint32_t * ptrBuffer)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t operand = instruction & CY_CSDIDAC_SEQ_OPERAND_MSK;
+    uint32_t absCurrent;
+
+    switch (instruction >> CY_CSDIDAC_SEQ_OPCODE_POS)
+    {
+        case CY_CSDIDAC_SEQ_OP_SET_RAW:
+            if ((0u == (operand & ~CY_CSDIDAC_SEQ_RAW_MSK)) && (0u != (operand & CY_CSDIDAC_LEG1_EN_MASK)))
+            {
+                retVal = CY_CSDIDAC_SUCCESS;
+            }
+            break;
+        case CY_CSDIDAC_SEQ_OP_SET_CURRENT:
+            absCurrent = (0u != (operand & CY_CSDIDAC_SEQ_OPERAND_SIGN)) ?
+                         ((CY_CSDIDAC_SEQ_OPERAND_MSK + 1u) - operand) : operand;
+            if ((NULL != ptrBuffer) && (CY_CSDIDAC_MAX_CURRENT_NA >= absCurrent))
+            {
+                retVal = CY_CSDIDAC_SUCCESS;
+            }
+            break;
+        case CY_CSDIDAC_SEQ_OP_WAIT:
+        case CY_CSDIDAC_SEQ_OP_LOOP:
+            if (0u != operand)
+            {
+                retVal = CY_CSDIDAC_SUCCESS;
+            }
+            break;
+        case CY_CSDIDAC_SEQ_OP_RAMP:
+            if (0u != (operand >> CY_CSDIDAC_SEQ_RAMP_TICKS_POS))
+            {
+                retVal = CY_CSDIDAC_SUCCESS;
+            }
+            break;
+        case CY_CSDIDAC_SEQ_OP_LOOP_END:
+        case CY_CSDIDAC_SEQ_OP_DISABLE:
+            if (0u == operand)
+            {
+                retVal = CY_CSDIDAC_SUCCESS;
+            }
+            break;
+        default:
+            /* The END instruction is allowed only as the last one */
+            break;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SeqRampStep
+****************************************************************************//**
+*
+* Performs one tick of the active RAMP instruction. The code is changed by
+* the Bresenham algorithm, so the target code is reached exactly at the last
+* tick without a division.
+*
+* \param seq
+* The pointer to the sequence structure \ref cy_stc_csdidac_seq_t.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_SeqRampStep(cy_stc_csdidac_seq_t * seq)
+{
+    uint32_t idacRegValue = seq->idacRegValue;
+
+    seq->rampError += seq->rampDelta;
+    while (seq->rampError >= seq->rampTicks)
+    {
+        seq->rampError -= seq->rampTicks;
+        idacRegValue = (true == seq->rampDown) ? (idacRegValue - 1u) : (idacRegValue + 1u);
+    }
+    seq->idacRegValue = idacRegValue;
+    Cy_CSDIDAC_WriteIdacReg(seq->ch, idacRegValue, seq->ptrCsdidacCxt);
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,203 @@
+/***************************************************************************//**
+* \file cy_csdidac_seq.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the current profile sequencer of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_SEQ_H)
+#define CY_CSDIDAC_SEQ_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+#if !defined(CY_CSDIDAC_SEQ_LOOP_DEPTH)
+/**
+* The maximum nesting depth of the sequence loops. The macro can be
+* redefined by the user to trade off the RAM size of the
+* \ref cy_stc_csdidac_seq_t structure against the nesting depth.
+*/
+#define CY_CSDIDAC_SEQ_LOOP_DEPTH               (4u)
+#endif
+
+#if ((CY_CSDIDAC_SEQ_LOOP_DEPTH < 1u) || (CY_CSDIDAC_SEQ_LOOP_DEPTH > 16u))
+    #error "CY_CSDIDAC_SEQ_LOOP_DEPTH is out of the 1..16 range"
+#endif
+
+/**
+* \name Sequence Instruction Format
+* Each sequence instruction is a 32-bit word with the opcode in the bits 31:28
+* and the operand in the bits 27:0.
+* \{
+*/
+#define CY_CSDIDAC_SEQ_OPCODE_POS               (28u)           /**< The opcode position */
+#define CY_CSDIDAC_SEQ_OPERAND_MSK              (0x0FFFFFFFuL)  /**< The operand mask */
+#define CY_CSDIDAC_SEQ_MAX_TICKS                (0x0FFFFFFFuL)  /**< The maximum number of ticks of the WAIT instruction */
+#define CY_CSDIDAC_SEQ_MAX_RAMP_TICKS           (0x001FFFFFuL)  /**< The maximum number of ticks of the RAMP instruction */
+#define CY_CSDIDAC_SEQ_RAMP_TICKS_POS           (7u)            /**< The position of the RAMP instruction ticks */
+
+#define CY_CSDIDAC_SEQ_OP_END                   (0u)    /**< Ends the sequence, the output current is kept */
+#define CY_CSDIDAC_SEQ_OP_SET_RAW               (1u)    /**< Writes the IDAC register value of the operand */
+#define CY_CSDIDAC_SEQ_OP_SET_CURRENT           (2u)    /**< Sets the current in nA, resolved by Cy_CSDIDAC_SeqLoad() */
+#define CY_CSDIDAC_SEQ_OP_WAIT                  (3u)    /**< Keeps the output for the number of ticks */
+#define CY_CSDIDAC_SEQ_OP_RAMP                  (4u)    /**< Ramps the code linearly to the target code */
+#define CY_CSDIDAC_SEQ_OP_LOOP                  (5u)    /**< Repeats the instructions up to the LOOP_END the number of times */
+#define CY_CSDIDAC_SEQ_OP_LOOP_END              (6u)    /**< Ends the loop body */
+#define CY_CSDIDAC_SEQ_OP_DISABLE               (7u)    /**< Sets the IDAC register to zero, the pin stays connected */
+/** \} */
+
+/**
+* \name Sequence Assembler
+* The macros compose the sequence instructions. All the macros are constant
+* expressions, so a sequence can be placed in the flash as a const array
+* of uint32_t and be verified by Cy_CSDIDAC_SeqLoad() on the target or
+* on the host.
+* \{
+*/
+/** Ends the sequence. The END instruction must be the last one. */
+#define CY_CSDIDAC_SEQ_END \
+                ((uint32_t)CY_CSDIDAC_SEQ_OP_END << CY_CSDIDAC_SEQ_OPCODE_POS)
+
+/** Sets the polarity (\ref cy_en_csdidac_polarity_t), LSB (\ref cy_en_csdidac_lsb_t), and code. */
+#define CY_CSDIDAC_SEQ_SET_RAW(polarity, lsbIndex, code) \
+                (((uint32_t)CY_CSDIDAC_SEQ_OP_SET_RAW << CY_CSDIDAC_SEQ_OPCODE_POS) | \
+                 ((uint32_t)(code) & CY_CSDIDAC_MAX_CODE) | \
+                 (((uint32_t)(polarity) & 1u) << CY_CSDIDAC_POLARITY_POS) | \
+                 (((uint32_t)(lsbIndex) >> 1u) << CY_CSDIDAC_LSB_POS) | \
+                 CY_CSDIDAC_LEG1_EN_MASK | \
+                 (((uint32_t)(lsbIndex) & 1u) << CY_CSDIDAC_LEG2_EN_POS))
+
+/** Sets the current in nA with a sign by the rules of Cy_CSDIDAC_OutputEnable(). */
+#define CY_CSDIDAC_SEQ_SET_CURRENT(current) \
+                (((uint32_t)CY_CSDIDAC_SEQ_OP_SET_CURRENT << CY_CSDIDAC_SEQ_OPCODE_POS) | \
+                 ((uint32_t)(current) & CY_CSDIDAC_SEQ_OPERAND_MSK))
+
+/** Keeps the output for the number of ticks from 1 to \ref CY_CSDIDAC_SEQ_MAX_TICKS. */
+#define CY_CSDIDAC_SEQ_WAIT(ticks) \
+                (((uint32_t)CY_CSDIDAC_SEQ_OP_WAIT << CY_CSDIDAC_SEQ_OPCODE_POS) | \
+                 ((uint32_t)(ticks) & CY_CSDIDAC_SEQ_OPERAND_MSK))
+
+/**
+* Ramps the code of the current polarity and LSB to the target code during
+* the number of ticks from 1 to \ref CY_CSDIDAC_SEQ_MAX_RAMP_TICKS.
+*/
+#define CY_CSDIDAC_SEQ_RAMP(code, ticks) \
+                (((uint32_t)CY_CSDIDAC_SEQ_OP_RAMP << CY_CSDIDAC_SEQ_OPCODE_POS) | \
+                 ((uint32_t)(code) & CY_CSDIDAC_MAX_CODE) | \
+                 (((uint32_t)(ticks) & CY_CSDIDAC_SEQ_MAX_RAMP_TICKS) << CY_CSDIDAC_SEQ_RAMP_TICKS_POS))
+
+/** Repeats the loop body the number of times from 1 to \ref CY_CSDIDAC_SEQ_OPERAND_MSK. */
+#define CY_CSDIDAC_SEQ_LOOP(count) \
+                (((uint32_t)CY_CSDIDAC_SEQ_OP_LOOP << CY_CSDIDAC_SEQ_OPCODE_POS) | \
+                 ((uint32_t)(count) & CY_CSDIDAC_SEQ_OPERAND_MSK))
+
+/** Ends the loop body. */
+#define CY_CSDIDAC_SEQ_LOOP_END \
+                ((uint32_t)CY_CSDIDAC_SEQ_OP_LOOP_END << CY_CSDIDAC_SEQ_OPCODE_POS)
+
+/** Sets the IDAC register to zero. The output is restored by the next SET instruction. */
+#define CY_CSDIDAC_SEQ_DISABLE \
+                ((uint32_t)CY_CSDIDAC_SEQ_OP_DISABLE << CY_CSDIDAC_SEQ_OPCODE_POS)
+/** \} */
+
+/** \} group_csdidac_macros */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/** The CSDIDAC sequence loop structure */
+typedef struct
+{
+    uint32_t pc;                            /**< The index of the first instruction of the loop body. */
+    uint32_t count;                         /**< The number of the remaining loop iterations. */
+} cy_stc_csdidac_seq_loop_t;
+
+/** The CSDIDAC sequence structure, that contains the sequencer state. */
+typedef struct
+{
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    const uint32_t * ptrProgram;            /**< The pointer to the loaded sequence. */
+    uint32_t duration;                      /**< The sequence duration in ticks. */
+    uint32_t pc;                            /**< The index of the next instruction. */
+    uint32_t idacRegValue;                  /**< The IDAC register value of the output. */
+    uint32_t holdCount;                     /**< The remaining ticks of the WAIT or RAMP instruction. */
+    uint32_t rampTicks;                     /**< The ticks of the active RAMP instruction, zero if no ramp. */
+    uint32_t rampDelta;                     /**< The code change of the active RAMP instruction. */
+    uint32_t rampError;                     /**< The error accumulator of the active RAMP instruction. */
+    bool rampDown;                          /**< The active RAMP instruction decreases the code. */
+    uint32_t loopLevel;                     /**< The number of the active loops. */
+    cy_stc_csdidac_seq_loop_t loop[CY_CSDIDAC_SEQ_LOOP_DEPTH]; /**< The loop stack. */
+    cy_en_csdidac_choice_t ch;              /**< The output channel: CY_CSDIDAC_A or CY_CSDIDAC_B. */
+    bool busy;                              /**< The sequence is running. */
+} cy_stc_csdidac_seq_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_SeqInit(
+                cy_en_csdidac_choice_t ch,
+                cy_stc_csdidac_seq_t * seq,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_SeqLoad(
+                const uint32_t * program,
+                uint32_t length,
+                uint32_t * ptrBuffer,
+                cy_stc_csdidac_seq_t * seq);
+cy_en_csdidac_status_t Cy_CSDIDAC_SeqStart(
+                cy_stc_csdidac_seq_t * seq);
+void Cy_CSDIDAC_SeqTick(
+                cy_stc_csdidac_seq_t * seq);
+bool Cy_CSDIDAC_SeqIsBusy(
+                const cy_stc_csdidac_seq_t * seq);
+uint32_t Cy_CSDIDAC_SeqGetDuration(
+                const cy_stc_csdidac_seq_t * seq);
+cy_en_csdidac_status_t Cy_CSDIDAC_SeqStop(
+                cy_stc_csdidac_seq_t * seq);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_SEQ_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,247 @@
+/***************************************************************************//**
+* \file cy_csdidac_setpoint.c
+* \version 2.20
+*
+* \brief
+* This file provides the prepared setpoint API implementation of the CSDIDAC
+* middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_setpoint.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static cy_en_csdidac_status_t Cy_CSDIDAC_SetpointSetChoice(
+                cy_en_csdidac_choice_t ch,
+                cy_stc_csdidac_setpoint_t * setpoint,
+                cy_stc_csdidac_context_t * context);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SetpointPrepare
+****************************************************************************//**
+*
+* Verifies the specified output current and converts it into a prepared
+* setpoint that can be applied by Cy_CSDIDAC_SetpointCommit().
+*
+* The function performs all the verifications and calculations of
+* Cy_CSDIDAC_OutputEnable() once, so a table of setpoints can be prepared
+* at the startup and applied later without any checks. The conversion rules
+* are the same as for Cy_CSDIDAC_OutputEnable().
+*
+* A prepared setpoint is valid until the CSDIDAC middleware configuration
+* is changed by Cy_CSDIDAC_WriteConfig() or Cy_CSDIDAC_DeInit().
+*
+* \param ch
+* The channel(s) the setpoint is applied to.
+*
+* \param current
+* The current value in nA with a sign. The absolute value must not exceed
+* \ref CY_CSDIDAC_MAX_CURRENT_NA.
+*
+* \param setpoint
+* The pointer to the setpoint structure \ref cy_stc_csdidac_setpoint_t
+* allocated by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_SetpointPrepare(
+                cy_en_csdidac_choice_t ch,
+                int32_t current,
+                cy_stc_csdidac_setpoint_t * setpoint,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t absCurrent = (0 > current) ? (uint32_t)(-current) : (uint32_t)current;
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t code;
+
+    if ((NULL != setpoint) && (NULL != context) && (CY_CSDIDAC_MAX_CURRENT_NA >= absCurrent))
+    {
+        retVal = Cy_CSDIDAC_SetpointSetChoice(ch, setpoint, context);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            Cy_CSDIDAC_ConvertCurrent(current, &polarity, &lsbIndex, &code);
+            setpoint->idacRegValue = Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, code);
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SetpointPrepareExt
+****************************************************************************//**
+*
+* Verifies the specified polarity, LSB, and IDAC code and converts them into
+* a prepared setpoint that can be applied by Cy_CSDIDAC_SetpointCommit().
+*
+* The function performs all the verifications of Cy_CSDIDAC_OutputEnableExt()
+* once. A prepared setpoint is valid until the CSDIDAC middleware
+* configuration is changed by Cy_CSDIDAC_WriteConfig() or Cy_CSDIDAC_DeInit().
+*
+* \param ch
+* The channel(s) the setpoint is applied to.
+*
+* \param polarity
+* The polarity to be set for the specified IDAC.
+*
+* \param lsbIndex
+* The LSB to be set for the specified IDAC.
+*
+* \param idacCode
+* The code value for the specified IDAC in the range from 0 u
+* to \ref CY_CSDIDAC_MAX_CODE.
+*
+* \param setpoint
+* The pointer to the setpoint structure \ref cy_stc_csdidac_setpoint_t
+* allocated by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_SetpointPrepareExt(
+                cy_en_csdidac_choice_t ch,
+                cy_en_csdidac_polarity_t polarity,
+                cy_en_csdidac_lsb_t lsbIndex,
+                uint32_t idacCode,
+                cy_stc_csdidac_setpoint_t * setpoint,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((NULL != setpoint) && (NULL != context) && (CY_CSDIDAC_MAX_CODE >= idacCode))
+    {
+        if ((true == Cy_CSDIDAC_IsIdacPolarityValid(polarity)) &&
+            (true == Cy_CSDIDAC_IsIdacLsbValid(lsbIndex)))
+        {
+            retVal = Cy_CSDIDAC_SetpointSetChoice(ch, setpoint, context);
+            if (CY_CSDIDAC_SUCCESS == retVal)
+            {
+                setpoint->idacRegValue = Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, idacCode);
+            }
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SetpointCommit
+****************************************************************************//**
+*
+* Applies the prepared setpoint to the IDAC register(s).
+*
+* The function performs no verification and writes only the IDAC register of
+* each channel of the setpoint. The output must be enabled by
+* Cy_CSDIDAC_OutputEnable() or Cy_CSDIDAC_OutputEnableExt() prior to calling
+* this function. The register write keeps the polarity, LSB, and code fields
+* of the CSDIDAC context structure coherent with the output.
+*
+* \param setpoint
+* The pointer to the setpoint structure \ref cy_stc_csdidac_setpoint_t
+* prepared by Cy_CSDIDAC_SetpointPrepare() or Cy_CSDIDAC_SetpointPrepareExt().
+*
+*******************************************************************************/
+void Cy_CSDIDAC_SetpointCommit(
+                const cy_stc_csdidac_setpoint_t * setpoint)
+{
+    if (CY_CSDIDAC_B != setpoint->ch)
+    {
+        Cy_CSDIDAC_WriteIdacReg(CY_CSDIDAC_A, setpoint->idacRegValue, setpoint->ptrCsdidacCxt);
+    }
+    if (CY_CSDIDAC_A != setpoint->ch)
+    {
+        Cy_CSDIDAC_WriteIdacReg(CY_CSDIDAC_B, setpoint->idacRegValue, setpoint->ptrCsdidacCxt);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SetpointSetChoice
+****************************************************************************//**
+*
+* Verifies the channel choice against the CSDIDAC configuration and stores
+* it in the setpoint. Unlike Cy_CSDIDAC_OutputEnableExt(), a disabled channel
+* is rejected at once, so the commit never writes an unused IDAC.
+*
+* \param ch
+* The channel(s) the setpoint is applied to.
+*
+* \param setpoint
+* The pointer to the setpoint structure \ref cy_stc_csdidac_setpoint_t.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The channel choice is invalid.
+*
+*******************************************************************************/
+static cy_en_csdidac_status_t Cy_CSDIDAC_SetpointSetChoice(
+                cy_en_csdidac_choice_t ch,
+                cy_stc_csdidac_setpoint_t * setpoint,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((true == Cy_CSDIDAC_IsIdacChoiceValid(ch, context->cfgCopy.configA, context->cfgCopy.configB)) &&
+        ((CY_CSDIDAC_A != ch) || (CY_CSDIDAC_DISABLED != context->cfgCopy.configA)) &&
+        ((CY_CSDIDAC_B != ch) || (CY_CSDIDAC_DISABLED != context->cfgCopy.configB)))
+    {
+        setpoint->ch = ch;
+        setpoint->ptrCsdidacCxt = context;
+        retVal = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
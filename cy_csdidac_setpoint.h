@@ -0,0 +1,88 @@
+/***************************************************************************//**
+* \file cy_csdidac_setpoint.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the prepared setpoint API of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_SETPOINT_H)
+#define CY_CSDIDAC_SETPOINT_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/**
+* The CSDIDAC prepared setpoint structure. The structure is filled by
+* Cy_CSDIDAC_SetpointPrepare() or Cy_CSDIDAC_SetpointPrepareExt() and should
+* not be modified by the user.
+*/
+typedef struct
+{
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    uint32_t idacRegValue;                  /**< The precomputed IDAC register value. */
+    cy_en_csdidac_choice_t ch;              /**< The validated output channel(s). */
+} cy_stc_csdidac_setpoint_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_SetpointPrepare(
+                cy_en_csdidac_choice_t ch,
+                int32_t current,
+                cy_stc_csdidac_setpoint_t * setpoint,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_SetpointPrepareExt(
+                cy_en_csdidac_choice_t ch,
+                cy_en_csdidac_polarity_t polarity,
+                cy_en_csdidac_lsb_t lsbIndex,
+                uint32_t idacCode,
+                cy_stc_csdidac_setpoint_t * setpoint,
+                cy_stc_csdidac_context_t * context);
+void Cy_CSDIDAC_SetpointCommit(
+                const cy_stc_csdidac_setpoint_t * setpoint);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_SETPOINT_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,474 @@
+/***************************************************************************//**
+* \file cy_csdidac_sweep.c
+* \version 2.20
+*
+* \brief
+* This file provides the code-space sweep and characterization mode
+* implementation of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_sweep.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static uint32_t Cy_CSDIDAC_SweepGetResultIndex(
+                const cy_stc_csdidac_sweep_t * sweep);
+static uint32_t Cy_CSDIDAC_SweepGetPointReg(
+                const cy_stc_csdidac_sweep_t * sweep);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+#define CY_CSDIDAC_SWEEP_CODE_POS               (7u)
+#define CY_CSDIDAC_SWEEP_CODE_MSK               (CY_CSDIDAC_SWEEP_RANGE_POINTS - 1u)
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SweepInit
+****************************************************************************//**
+*
+* Initializes the code-space sweep of the specified channel.
+*
+* The sweep steps the channel through all the codes of the selected LSB ranges
+* in the configured order. After each step, the sweep waits for the
+* configured number of Cy_CSDIDAC_SweepProcess() calls to let the output
+* settle, calls the measurement function, and stores the result in the
+* result buffer. The buffer layout does not depend on the sweep order:
+* the swept ranges follow in the ascending LSB index order, and each range
+* contains \ref CY_CSDIDAC_SWEEP_RANGE_POINTS results in the ascending
+* code order.
+*
+* The CSDIDAC middleware must be initialized by Cy_CSDIDAC_Init() prior
+* to calling this function.
+*
+* \param config
+* The pointer to the sweep configuration structure
+* \ref cy_stc_csdidac_sweep_config_t. The result buffer must contain
+* \ref CY_CSDIDAC_SWEEP_RANGE_POINTS entries per each swept range.
+*
+* \param sweep
+* The pointer to the sweep structure \ref cy_stc_csdidac_sweep_t allocated
+* by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or an invalid parameter
+*                           is passed.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_SweepInit(
+                const cy_stc_csdidac_sweep_config_t * config,
+                cy_stc_csdidac_sweep_t * sweep,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t rangeNum = 0u;
+    uint32_t i;
+
+    if ((NULL != config) && (NULL != sweep) && (NULL != context))
+    {
+        if ((NULL != config->ptrMeasureFunc) && (NULL != config->ptrResults) &&
+            (0u != config->lsbMask) && (0u == (config->lsbMask & ~CY_CSDIDAC_SWEEP_ALL_RANGES)) &&
+            (true == Cy_CSDIDAC_IsIdacPolarityValid(config->polarity)) &&
+            ((CY_CSDIDAC_SWEEP_ASCENDING == config->order) || (CY_CSDIDAC_SWEEP_DESCENDING == config->order)) &&
+            (((CY_CSDIDAC_A == config->ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configA)) ||
+             ((CY_CSDIDAC_B == config->ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configB))))
+        {
+            for (i = 0u; i < CY_CSDIDAC_LSB_NUM; i++)
+            {
+                if (0u != (config->lsbMask & (1u << i)))
+                {
+                    sweep->rangeLsb[rangeNum] = (uint8_t)i;
+                    rangeNum++;
+                }
+            }
+            sweep->cfgCopy = *config;
+            sweep->ptrCsdidacCxt = context;
+            sweep->pointNum = rangeNum * CY_CSDIDAC_SWEEP_RANGE_POINTS;
+            sweep->point = 0u;
+            sweep->dwellCount = 0u;
+            sweep->busy = false;
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SweepStart
+****************************************************************************//**
+*
+* Starts the sweep from the first point and enables the channel output.
+*
+* \param sweep
+* The pointer to the sweep structure \ref cy_stc_csdidac_sweep_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or the sweep is already
+*                           in progress.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_SweepStart(
+                cy_stc_csdidac_sweep_t * sweep)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if ((NULL != sweep) && (false == sweep->busy))
+    {
+        sweep->point = 0u;
+        sweep->dwellCount = sweep->cfgCopy.dwellTicks;
+        retVal = Cy_CSDIDAC_OutputEnableReg(sweep->cfgCopy.ch, Cy_CSDIDAC_SweepGetPointReg(sweep),
+                                            true, sweep->ptrCsdidacCxt);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            sweep->busy = true;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SweepProcess
+****************************************************************************//**
+*
+* Performs one tick of the sweep.
+*
+* The function is intended to be called periodically, e.g. from the fixture
+* main loop or a timer interrupt. It counts down the dwell of the current
+* point, then measures the output, stores the result, and steps to the next
+* point. After the last point the channel output is disabled.
+*
+* \param sweep
+* The pointer to the sweep structure \ref cy_stc_csdidac_sweep_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL or the sweep is not
+*                           in progress.
+* * Other                 - The status returned by the measurement function.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_SweepProcess(
+                cy_stc_csdidac_sweep_t * sweep)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    int32_t current;
+
+    if ((NULL != sweep) && (true == sweep->busy))
+    {
+        retVal = CY_CSDIDAC_SUCCESS;
+        if (0u != sweep->dwellCount)
+        {
+            sweep->dwellCount--;
+        }
+        else
+        {
+            retVal = sweep->cfgCopy.ptrMeasureFunc(&current, sweep->cfgCopy.measureParam);
+            if (CY_CSDIDAC_SUCCESS == retVal)
+            {
+                sweep->cfgCopy.ptrResults[Cy_CSDIDAC_SweepGetResultIndex(sweep)] = current;
+                sweep->point++;
+                if (sweep->point < sweep->pointNum)
+                {
+                    Cy_CSDIDAC_WriteIdacReg(sweep->cfgCopy.ch, Cy_CSDIDAC_SweepGetPointReg(sweep),
+                                            sweep->ptrCsdidacCxt);
+                    sweep->dwellCount = sweep->cfgCopy.dwellTicks;
+                }
+                else
+                {
+                    sweep->busy = false;
+                    retVal = Cy_CSDIDAC_OutputDisable(sweep->cfgCopy.ch, sweep->ptrCsdidacCxt);
+                }
+            }
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SweepIsBusy
+****************************************************************************//**
+*
+* Reports whether the sweep is in progress.
+*
+* \param sweep
+* The pointer to the sweep structure \ref cy_stc_csdidac_sweep_t.
+*
+* \return
+* Returns true if the sweep is started and not complete, otherwise false.
+*
+*******************************************************************************/
+bool Cy_CSDIDAC_SweepIsBusy(
+                const cy_stc_csdidac_sweep_t * sweep)
+{
+    return ((NULL != sweep) && (true == sweep->busy));
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SweepStop
+****************************************************************************//**
+*
+* Aborts the sweep and disables the channel output.
+*
+* \param sweep
+* The pointer to the sweep structure \ref cy_stc_csdidac_sweep_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_SweepStop(
+                cy_stc_csdidac_sweep_t * sweep)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != sweep)
+    {
+        sweep->busy = false;
+        retVal = Cy_CSDIDAC_OutputDisable(sweep->cfgCopy.ch, sweep->ptrCsdidacCxt);
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SweepGetCalibration
+****************************************************************************//**
+*
+* Calculates the calibration of all the LSB ranges from the results of
+* the complete sweep.
+*
+* Each swept range is calculated by Cy_CSDIDAC_CalculateRangeCalibration().
+* The ranges that are not swept get the nominal calibration: the unity gain,
+* and zero offset, INL, and DNL.
+*
+* \param sweep
+* The pointer to the completed sweep structure \ref cy_stc_csdidac_sweep_t.
+*
+* \param cal
+* The pointer to the array of \ref CY_CSDIDAC_LSB_NUM calibration structures
+* \ref cy_stc_csdidac_range_cal_t indexed by the LSB index.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL, the sweep is not
+*                           complete, or a range has no measured span.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_SweepGetCalibration(
+                const cy_stc_csdidac_sweep_t * sweep,
+                cy_stc_csdidac_range_cal_t * cal)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t range = 0u;
+    uint32_t i;
+
+    if ((NULL != sweep) && (NULL != cal))
+    {
+        if ((false == sweep->busy) && (sweep->point == sweep->pointNum))
+        {
+            retVal = CY_CSDIDAC_SUCCESS;
+            for (i = 0u; i < CY_CSDIDAC_LSB_NUM; i++)
+            {
+                if (0u != (sweep->cfgCopy.lsbMask & (1u << i)))
+                {
+                    if (CY_CSDIDAC_SUCCESS != Cy_CSDIDAC_CalculateRangeCalibration(
+                            &sweep->cfgCopy.ptrResults[range * CY_CSDIDAC_SWEEP_RANGE_POINTS],
+                            (cy_en_csdidac_lsb_t)i, &cal[i]))
+                    {
+                        retVal = CY_CSDIDAC_BAD_PARAM;
+                    }
+                    range++;
+                }
+                else
+                {
+                    cal[i].gain = 1u << CY_CSDIDAC_CAL_GAIN_SHIFT;
+                    cal[i].offset = 0;
+                    cal[i].inl = 0;
+                    cal[i].dnl = 0;
+                }
+            }
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_CalculateRangeCalibration
+****************************************************************************//**
+*
+* Calculates the gain, offset, INL, and DNL of one LSB range.
+*
+* The calculation uses the integer math only. The straight line passes through
+* the measurements at the codes 0 and \ref CY_CSDIDAC_MAX_CODE (endpoint fit),
+* and its slope is the measured LSB. The INL of a code is the deviation of
+* the measurement from the line, and the DNL of a code is the deviation of
+* the step from the previous code from the measured LSB. Both are reported
+* as the signed value of the largest magnitude in the measured LSBs.
+*
+* \param measurements
+* The pointer to \ref CY_CSDIDAC_SWEEP_RANGE_POINTS measurements of the range
+* in pA in the ascending code order.
+*
+* \param lsbIndex
+* The LSB index of the range.
+*
+* \param cal
+* The pointer to the calibration structure \ref cy_stc_csdidac_range_cal_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL, an invalid parameter
+*                           is passed, or the measured span is zero.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_CalculateRangeCalibration(
+                const int32_t * measurements,
+                cy_en_csdidac_lsb_t lsbIndex,
+                cy_stc_csdidac_range_cal_t * cal)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    int64_t span;
+    int64_t absSpan;
+    int64_t deviation;
+    int32_t inl = 0;
+    int32_t dnl = 0;
+    int32_t value;
+    uint32_t code;
+
+    if ((NULL != measurements) && (NULL != cal) && (true == Cy_CSDIDAC_IsIdacLsbValid(lsbIndex)))
+    {
+        span = (int64_t)measurements[CY_CSDIDAC_MAX_CODE] - (int64_t)measurements[0u];
+        if (0 != span)
+        {
+            absSpan = (0 > span) ? -span : span;
+            for (code = 1u; code <= CY_CSDIDAC_MAX_CODE; code++)
+            {
+                /* INL(code) = (m[code] - m[0] - code * span / MAX_CODE) / (span / MAX_CODE) */
+                deviation = (((int64_t)measurements[code] - (int64_t)measurements[0u]) * (int64_t)CY_CSDIDAC_MAX_CODE) -
+                            ((int64_t)code * span);
+                value = (int32_t)((deviation * (int64_t)(1u << CY_CSDIDAC_CAL_LINEARITY_SHIFT)) / span);
+                if (((0 > value) ? -value : value) > ((0 > inl) ? -inl : inl))
+                {
+                    inl = value;
+                }
+
+                /* DNL(code) = (m[code] - m[code - 1]) / (span / MAX_CODE) - 1 */
+                deviation = (((int64_t)measurements[code] - (int64_t)measurements[code - 1u]) * (int64_t)CY_CSDIDAC_MAX_CODE) -
+                            span;
+                value = (int32_t)((deviation * (int64_t)(1u << CY_CSDIDAC_CAL_LINEARITY_SHIFT)) / span);
+                if (((0 > value) ? -value : value) > ((0 > dnl) ? -dnl : dnl))
+                {
+                    dnl = value;
+                }
+            }
+            cal->gain = (uint32_t)((absSpan << CY_CSDIDAC_CAL_GAIN_SHIFT) /
+                                   ((int64_t)CY_CSDIDAC_MAX_CODE * (int64_t)cy_csdidac_lsbPa[lsbIndex]));
+            cal->offset = measurements[0u];
+            cal->inl = inl;
+            cal->dnl = dnl;
+            retVal = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SweepGetResultIndex
+****************************************************************************//**
+*
+* Returns the result buffer index of the current sweep point.
+*
+* \param sweep
+* The pointer to the sweep structure \ref cy_stc_csdidac_sweep_t.
+*
+* \return
+* The result buffer index.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDIDAC_SweepGetResultIndex(
+                const cy_stc_csdidac_sweep_t * sweep)
+{
+    uint32_t index = sweep->point;
+
+    if (CY_CSDIDAC_SWEEP_DESCENDING == sweep->cfgCopy.order)
+    {
+        index = sweep->pointNum - 1u - index;
+    }
+
+    return (index);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_SweepGetPointReg
+****************************************************************************//**
+*
+* Returns the IDAC register value of the current sweep point.
+*
+* \param sweep
+* The pointer to the sweep structure \ref cy_stc_csdidac_sweep_t.
+*
+* \return
+* The IDAC register value.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDIDAC_SweepGetPointReg(
+                const cy_stc_csdidac_sweep_t * sweep)
+{
+    uint32_t index = Cy_CSDIDAC_SweepGetResultIndex(sweep);
+    cy_en_csdidac_lsb_t lsbIndex = (cy_en_csdidac_lsb_t)sweep->rangeLsb[index >> CY_CSDIDAC_SWEEP_CODE_POS];
+
+    return (Cy_CSDIDAC_GetIdacRegValue(sweep->cfgCopy.polarity, lsbIndex, index & CY_CSDIDAC_SWEEP_CODE_MSK));
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
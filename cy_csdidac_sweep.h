@@ -0,0 +1,176 @@
+/***************************************************************************//**
+* \file cy_csdidac_sweep.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the code-space sweep and characterization mode of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_SWEEP_H)
+#define CY_CSDIDAC_SWEEP_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+/** The number of the sweep points of one LSB range. */
+#define CY_CSDIDAC_SWEEP_RANGE_POINTS           (CY_CSDIDAC_MAX_CODE + 1u)
+
+/** The mask of all the LSB ranges for the lsbMask field of \ref cy_stc_csdidac_sweep_config_t. */
+#define CY_CSDIDAC_SWEEP_ALL_RANGES             ((1u << CY_CSDIDAC_LSB_NUM) - 1u)
+
+/**
+* The number of fractional bits of the gain field of
+* \ref cy_stc_csdidac_range_cal_t. The nominal gain is
+* (1 << CY_CSDIDAC_CAL_GAIN_SHIFT).
+*/
+#define CY_CSDIDAC_CAL_GAIN_SHIFT               (16u)
+
+/**
+* The number of fractional bits of the inl and dnl fields of
+* \ref cy_stc_csdidac_range_cal_t, which are specified in the measured LSBs.
+*/
+#define CY_CSDIDAC_CAL_LINEARITY_SHIFT          (8u)
+
+/** \} group_csdidac_macros */
+
+
+/***************************************
+* Enumerated Types and Parameters
+***************************************/
+/**
+* \addtogroup group_csdidac_enums
+* \{
+*/
+
+/** The CSDIDAC sweep order enumeration type. */
+typedef enum
+{
+    CY_CSDIDAC_SWEEP_ASCENDING  = 0u,       /**< From the smallest LSB and code to the largest ones */
+    CY_CSDIDAC_SWEEP_DESCENDING = 1u,       /**< From the largest LSB and code to the smallest ones */
+} cy_en_csdidac_sweep_order_t;
+
+/** \} group_csdidac_enums */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/**
+* Provides the measurement of the output current at the current sweep point.
+*
+* The function is called by Cy_CSDIDAC_SweepProcess() after the dwell and
+* returns the measured current in pA with a sign: positive for sourcing
+* current, negative for sinking current. Any status other than
+* CY_CSDIDAC_SUCCESS keeps the sweep at the current point, so the measurement
+* is repeated on the next call.
+*/
+typedef cy_en_csdidac_status_t (*cy_csdidac_sweep_measure_t)(int32_t * current, void * param);
+
+/** The CSDIDAC sweep configuration structure */
+typedef struct
+{
+    cy_en_csdidac_choice_t ch;              /**< The swept channel: CY_CSDIDAC_A or CY_CSDIDAC_B. */
+    cy_en_csdidac_polarity_t polarity;      /**< The polarity of the swept current. */
+    cy_en_csdidac_sweep_order_t order;      /**< The sweep order. */
+    uint32_t lsbMask;                       /**< The swept LSB ranges: bit N corresponds to the LSB index N. */
+    uint32_t dwellTicks;                    /**< The number of Cy_CSDIDAC_SweepProcess() calls skipped after each step. */
+    cy_csdidac_sweep_measure_t ptrMeasureFunc; /**< The measurement source. */
+    void * measureParam;                    /**< The parameter passed to the measurement source. */
+    int32_t * ptrResults;                   /**< The result buffer of \ref CY_CSDIDAC_SWEEP_RANGE_POINTS entries per swept range. */
+} cy_stc_csdidac_sweep_config_t;
+
+/** The CSDIDAC sweep structure, that contains the sweep state. */
+typedef struct
+{
+    cy_stc_csdidac_sweep_config_t cfgCopy;  /**< A configuration structure copy. */
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    uint32_t pointNum;                      /**< The total number of the sweep points. */
+    uint32_t point;                         /**< The current sweep point. */
+    uint32_t dwellCount;                    /**< The remaining dwell of the current point. */
+    uint8_t rangeLsb[CY_CSDIDAC_LSB_NUM];   /**< The LSB index of each swept range. */
+    bool busy;                              /**< The sweep is in progress. */
+} cy_stc_csdidac_sweep_t;
+
+/**
+* The CSDIDAC LSB range calibration structure.
+*
+* The values are calculated by the endpoint fit of the measured range: the
+* straight line passes through the measurements at the codes 0 and
+* \ref CY_CSDIDAC_MAX_CODE.
+*/
+typedef struct
+{
+    uint32_t gain;                          /**< The ratio of the measured LSB to the nominal LSB, see \ref CY_CSDIDAC_CAL_GAIN_SHIFT. */
+    int32_t offset;                         /**< The measured current at the zero code in pA. */
+    int32_t inl;                            /**< The worst integral nonlinearity, see \ref CY_CSDIDAC_CAL_LINEARITY_SHIFT. */
+    int32_t dnl;                            /**< The worst differential nonlinearity, see \ref CY_CSDIDAC_CAL_LINEARITY_SHIFT. */
+} cy_stc_csdidac_range_cal_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_SweepInit(
+                const cy_stc_csdidac_sweep_config_t * config,
+                cy_stc_csdidac_sweep_t * sweep,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_SweepStart(
+                cy_stc_csdidac_sweep_t * sweep);
+cy_en_csdidac_status_t Cy_CSDIDAC_SweepProcess(
+                cy_stc_csdidac_sweep_t * sweep);
+bool Cy_CSDIDAC_SweepIsBusy(
+                const cy_stc_csdidac_sweep_t * sweep);
+cy_en_csdidac_status_t Cy_CSDIDAC_SweepStop(
+                cy_stc_csdidac_sweep_t * sweep);
+cy_en_csdidac_status_t Cy_CSDIDAC_SweepGetCalibration(
+                const cy_stc_csdidac_sweep_t * sweep,
+                cy_stc_csdidac_range_cal_t * cal);
+cy_en_csdidac_status_t Cy_CSDIDAC_CalculateRangeCalibration(
+                const int32_t * measurements,
+                cy_en_csdidac_lsb_t lsbIndex,
+                cy_stc_csdidac_range_cal_t * cal);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_SWEEP_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,581 @@
+/***************************************************************************//**
+* \file cy_csdidac_transition.c
+* \version 2.20
+*
+* \brief
+* This file provides the glitch-free LSB range transition implementation
+* of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_transition.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static void Cy_CSDIDAC_TransitionDirect(
+                cy_en_csdidac_choice_t ch,
+                uint32_t oldRegValue,
+                cy_en_csdidac_polarity_t polarity,
+                cy_en_csdidac_lsb_t lsbIndex,
+                uint32_t idacCode,
+                cy_stc_csdidac_context_t * context);
+static void Cy_CSDIDAC_TransitionBridged(
+                cy_en_csdidac_choice_t ch,
+                uint32_t oldRegValue,
+                cy_en_csdidac_polarity_t polarity,
+                cy_en_csdidac_lsb_t lsbIndex,
+                uint32_t idacCode,
+                cy_stc_csdidac_context_t * context);
+static void Cy_CSDIDAC_TransitionWrite(
+                cy_en_csdidac_choice_t ch,
+                uint32_t idacRegValue,
+                uint32_t * lastRegValue,
+                cy_stc_csdidac_context_t * context);
+static uint32_t Cy_CSDIDAC_TransitionChunk(
+                uint32_t sum,
+                uint32_t lo,
+                uint32_t hi,
+                uint32_t unit,
+                uint32_t dip,
+                bool * breakFirst);
+static void Cy_CSDIDAC_TransitionPair(
+                cy_en_csdidac_choice_t ch,
+                uint32_t outRegValue,
+                uint32_t partnerRegValue,
+                bool outFirst,
+                bool masked,
+                cy_stc_csdidac_context_t * context);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+/* The IDAC register fields that are changed at the zero code only */
+#define CY_CSDIDAC_TRANSITION_RANGE_MSK         (CY_CSDIDAC_POLARITY_MASK | CY_CSDIDAC_RANGE_MASK)
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_OutputTransition
+****************************************************************************//**
+*
+* Changes the output current of an enabled channel without a transient
+* caused by the simultaneous change of the LSB range and the code.
+*
+* The current is converted with the same rules as in Cy_CSDIDAC_OutputEnable().
+* If the LSB range and the polarity are not changed, the function writes
+* the new code only. Otherwise, the change is sequenced by the specified mode:
+*
+* * CY_CSDIDAC_TRANSITION_DIRECT - the output IDAC approaches the target
+*   in the old range, switches the range at the closest possible current,
+*   and then sets the target code. Each intermediate current lies between
+*   the old and the new output currents, so the output changes monotonically
+*   and never overshoots. The polarity is changed at the zero code.
+*
+* * CY_CSDIDAC_TRANSITION_BRIDGED - the IDAC of the other channel carries
+*   the output while the output IDAC changes the range at the zero code.
+*   Neither IDAC changes the range while carrying current. The current is
+*   handed over by the largest steps, that keep the output in bounds: a step
+*   is taken by one IDAC before it is released by the other one if the larger
+*   of the old and the new currents leaves room for it, otherwise it is
+*   released first with interrupts disabled for the two register writes.
+*   So the output never exceeds the larger current and drops below
+*   the smaller one by at most one LSB of the coarser range for the time
+*   of one register write. The step is limited by the distance between
+*   the old and the new currents plus one coarser LSB, so a transition
+*   between close currents near a range boundary takes up to 64 steps
+*   of each IDAC, while the direct mode takes three writes. The polarity
+*   is changed at the zero code of the output IDAC. Both IDACs drive the same output
+*   only in the joined configuration: the output channel must be configured
+*   as CY_CSDIDAC_JOIN, and the other channel as CY_CSDIDAC_GPIO or
+*   CY_CSDIDAC_AMUX, which provides the output, and must be disabled.
+*
+* If the channel is disabled, the function enables it by
+* Cy_CSDIDAC_OutputEnable().
+*
+* \param ch
+* The output channel: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param current
+* The current value in nA with a sign. The absolute value must not exceed
+* \ref CY_CSDIDAC_MAX_CURRENT_NA.
+*
+* \param mode
+* The transition mode.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL, an invalid parameter
+*                           is passed, or the bridged mode is requested for
+*                           a channel, that is not joined, or while the other
+*                           channel is enabled.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_OutputTransition(
+                cy_en_csdidac_choice_t ch,
+                int32_t current,
+                cy_en_csdidac_transition_t mode,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t code;
+    uint32_t oldRegValue;
+    cy_en_csdidac_channel_config_t channelConfig;
+    cy_en_csdidac_channel_config_t partnerConfig;
+    cy_en_csdidac_state_t channelState;
+    cy_en_csdidac_state_t partnerState;
+
+    if ((NULL != context) && ((CY_CSDIDAC_A == ch) || (CY_CSDIDAC_B == ch)) &&
+        ((int32_t)CY_CSDIDAC_MAX_CURRENT_NA >= current) && (-(int32_t)CY_CSDIDAC_MAX_CURRENT_NA <= current))
+    {
+        channelConfig = (CY_CSDIDAC_A == ch) ? context->cfgCopy.configA : context->cfgCopy.configB;
+        partnerConfig = (CY_CSDIDAC_A == ch) ? context->cfgCopy.configB : context->cfgCopy.configA;
+        channelState = (CY_CSDIDAC_A == ch) ? context->channelStateA : context->channelStateB;
+        partnerState = (CY_CSDIDAC_A == ch) ? context->channelStateB : context->channelStateA;
+
+        /* The bridging IDAC is the idle channel, that provides the output of the joined channel */
+        if ((CY_CSDIDAC_DISABLED != channelConfig) &&
+            ((CY_CSDIDAC_TRANSITION_DIRECT == mode) ||
+             ((CY_CSDIDAC_TRANSITION_BRIDGED == mode) && (CY_CSDIDAC_JOIN == channelConfig) &&
+              (CY_CSDIDAC_JOIN != partnerConfig) && (CY_CSDIDAC_DISABLED != partnerConfig) &&
+              (CY_CSDIDAC_ENABLE != partnerState))))
+        {
+            if (CY_CSDIDAC_ENABLE != channelState)
+            {
+                retVal = Cy_CSDIDAC_OutputEnable(ch, current, context);
+            }
+            else
+            {
+                Cy_CSDIDAC_ConvertCurrent(current, &polarity, &lsbIndex, &code);
+                oldRegValue = (CY_CSDIDAC_A == ch) ? context->idacRegValueA : context->idacRegValueB;
+
+                if (CY_CSDIDAC_TRANSITION_DIRECT == mode)
+                {
+                    Cy_CSDIDAC_TransitionDirect(ch, oldRegValue, polarity, lsbIndex, code, context);
+                }
+                else
+                {
+                    Cy_CSDIDAC_TransitionBridged(ch, oldRegValue, polarity, lsbIndex, code, context);
+                }
+                /* The IDAC register writes keep the context structure coherent with the output */
+                retVal = CY_CSDIDAC_SUCCESS;
+            }
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_TransitionDirect
+****************************************************************************//**
+*
+* Performs the monotonic transition on the output IDAC.
+*
+* For the increasing current, the old range code is raised to the largest
+* current not exceeding the target, and the new range code is the smallest
+* one not below that current. For the decreasing current, the old range code
+* is lowered to the smallest current not below the target, and the new range
+* code is the largest one not exceeding that current. The LSB values are
+* multiples of each other, so the range change step is smaller than the
+* larger LSB.
+*
+* \param ch
+* The output channel: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param oldRegValue
+* The current IDAC register value of the channel.
+*
+* \param polarity
+* The target polarity.
+*
+* \param lsbIndex
+* The target LSB.
+*
+* \param idacCode
+* The target code.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_TransitionDirect(
+                cy_en_csdidac_choice_t ch,
+                uint32_t oldRegValue,
+                cy_en_csdidac_polarity_t polarity,
+                cy_en_csdidac_lsb_t lsbIndex,
+                uint32_t idacCode,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_polarity_t oldPolarity = Cy_CSDIDAC_GetIdacRegPolarity(oldRegValue);
+    cy_en_csdidac_lsb_t oldLsbIndex = (cy_en_csdidac_lsb_t)Cy_CSDIDAC_GetIdacRegLsb(oldRegValue);
+    uint32_t oldLsb = cy_csdidac_lsbPa[oldLsbIndex];
+    uint32_t newLsb = cy_csdidac_lsbPa[lsbIndex];
+    uint32_t oldCurrent = (oldRegValue & CY_CSDIDAC_MAX_CODE) * oldLsb;
+    uint32_t newCurrent = idacCode * newLsb;
+    uint32_t lastRegValue = oldRegValue;
+    uint32_t step;
+
+    if (oldPolarity != polarity)
+    {
+        /* The polarity is changed at the zero current */
+        Cy_CSDIDAC_TransitionWrite(ch, Cy_CSDIDAC_GetIdacRegValue(oldPolarity, oldLsbIndex, 0u), &lastRegValue, context);
+        Cy_CSDIDAC_TransitionWrite(ch, Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, 0u), &lastRegValue, context);
+    }
+    else if (oldLsbIndex != lsbIndex)
+    {
+        if (newCurrent > oldCurrent)
+        {
+            step = newCurrent / oldLsb;
+            if (step > CY_CSDIDAC_MAX_CODE)
+            {
+                step = CY_CSDIDAC_MAX_CODE;
+            }
+            Cy_CSDIDAC_TransitionWrite(ch, Cy_CSDIDAC_GetIdacRegValue(polarity, oldLsbIndex, step), &lastRegValue, context);
+            step = ((step * oldLsb) + newLsb - 1u) / newLsb;
+            Cy_CSDIDAC_TransitionWrite(ch, Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, step), &lastRegValue, context);
+        }
+        else
+        {
+            step = (newCurrent + oldLsb - 1u) / oldLsb;
+            Cy_CSDIDAC_TransitionWrite(ch, Cy_CSDIDAC_GetIdacRegValue(polarity, oldLsbIndex, step), &lastRegValue, context);
+            step = (step * oldLsb) / newLsb;
+            if (step > CY_CSDIDAC_MAX_CODE)
+            {
+                step = CY_CSDIDAC_MAX_CODE;
+            }
+            Cy_CSDIDAC_TransitionWrite(ch, Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, step), &lastRegValue, context);
+        }
+    }
+    else
+    {
+        /* Only the code is changed */
+    }
+    Cy_CSDIDAC_TransitionWrite(ch, Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, idacCode), &lastRegValue, context);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_TransitionBridged
+****************************************************************************//**
+*
+* Performs the bridged transition through the IDAC of the other channel.
+*
+* The output IDAC approaches the target in the old range as in
+* Cy_CSDIDAC_TransitionDirect(), so the summed current stays between
+* the old and the new currents. The idle IDAC is prepared in the old range
+* at the zero code and takes over the output by the steps chosen by
+* Cy_CSDIDAC_TransitionChunk(). The output IDAC changes the range at the zero
+* code and takes the output back by the steps of one coarser LSB multiple,
+* that is the same current in both ranges, and then sets the target code.
+* The idle IDAC is written directly, so its context and its charge
+* accounting are not changed, and its register is left cleared.
+*
+* \param ch
+* The output channel: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param oldRegValue
+* The current IDAC register value of the channel.
+*
+* \param polarity
+* The target polarity.
+*
+* \param lsbIndex
+* The target LSB.
+*
+* \param idacCode
+* The target code.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_TransitionBridged(
+                cy_en_csdidac_choice_t ch,
+                uint32_t oldRegValue,
+                cy_en_csdidac_polarity_t polarity,
+                cy_en_csdidac_lsb_t lsbIndex,
+                uint32_t idacCode,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_polarity_t oldPolarity = Cy_CSDIDAC_GetIdacRegPolarity(oldRegValue);
+    cy_en_csdidac_lsb_t oldLsbIndex = (cy_en_csdidac_lsb_t)Cy_CSDIDAC_GetIdacRegLsb(oldRegValue);
+    uint32_t oldLsb = cy_csdidac_lsbPa[oldLsbIndex];
+    uint32_t newLsb = cy_csdidac_lsbPa[lsbIndex];
+    uint32_t stepLsb = (oldLsb > newLsb) ? oldLsb : newLsb;
+    uint32_t oldCurrent = (oldRegValue & CY_CSDIDAC_MAX_CODE) * oldLsb;
+    uint32_t newCurrent = idacCode * newLsb;
+    uint32_t lo = (oldCurrent < newCurrent) ? oldCurrent : newCurrent;
+    uint32_t hi = (oldCurrent > newCurrent) ? oldCurrent : newCurrent;
+    uint32_t newRegValue = Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, idacCode);
+    uint32_t partnerZero = Cy_CSDIDAC_GetIdacRegValue(polarity, oldLsbIndex, 0u);
+    uint32_t partnerOffset = (CY_CSDIDAC_A == ch) ? CY_CSD_REG_OFFSET_IDACB : CY_CSD_REG_OFFSET_IDACA;
+    uint32_t lastRegValue = oldRegValue;
+    uint32_t outCode;
+    uint32_t bridgeCode = 0u;
+    uint32_t chunk;
+    uint32_t step;
+    uint32_t sum;
+    bool breakFirst;
+
+    if (((oldRegValue & CY_CSDIDAC_TRANSITION_RANGE_MSK) == (newRegValue & CY_CSDIDAC_TRANSITION_RANGE_MSK)) ||
+        (oldPolarity != polarity))
+    {
+        /* Only the code is changed, or the output passes the zero current */
+        Cy_CSDIDAC_TransitionDirect(ch, oldRegValue, polarity, lsbIndex, idacCode, context);
+    }
+    else
+    {
+        /* Approaches the target in the old range */
+        if (newCurrent > oldCurrent)
+        {
+            outCode = newCurrent / oldLsb;
+            if (outCode > CY_CSDIDAC_MAX_CODE)
+            {
+                outCode = CY_CSDIDAC_MAX_CODE;
+            }
+        }
+        else
+        {
+            outCode = (newCurrent + oldLsb - 1u) / oldLsb;
+        }
+        Cy_CSDIDAC_TransitionWrite(ch, Cy_CSDIDAC_GetIdacRegValue(polarity, oldLsbIndex, outCode), &lastRegValue, context);
+        sum = outCode * oldLsb;
+
+        /* Prepares the idle IDAC in the old range at the zero code */
+        CY_CSDIDAC_CSD_WRITE_REG(context, partnerOffset, partnerZero);
+
+        /* The idle IDAC takes over the output, the summed current is restored after each step */
+        chunk = Cy_CSDIDAC_TransitionChunk(sum, lo, hi, oldLsb, stepLsb, &breakFirst);
+        while (0u != outCode)
+        {
+            step = (chunk < outCode) ? chunk : outCode;
+            bridgeCode += step;
+            outCode -= step;
+            Cy_CSDIDAC_TransitionPair(ch, Cy_CSDIDAC_GetIdacRegValue(polarity, oldLsbIndex, outCode),
+                                      Cy_CSDIDAC_GetIdacRegValue(polarity, oldLsbIndex, bridgeCode),
+                                      breakFirst, breakFirst, context);
+        }
+
+        /* Changes the output IDAC range at the zero code */
+        Cy_CSDIDAC_WriteIdacReg(ch, Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, 0u), context);
+
+        /* The output IDAC takes the output back by the multiples of the coarser LSB */
+        chunk = Cy_CSDIDAC_TransitionChunk(sum, lo, hi, stepLsb, stepLsb, &breakFirst);
+        step = chunk;
+        while (0u != step)
+        {
+            step = bridgeCode / (stepLsb / oldLsb);
+            step = (chunk < step) ? chunk : step;
+            if (step > ((CY_CSDIDAC_MAX_CODE - outCode) / (stepLsb / newLsb)))
+            {
+                step = (CY_CSDIDAC_MAX_CODE - outCode) / (stepLsb / newLsb);
+            }
+            if (0u != step)
+            {
+                outCode += step * (stepLsb / newLsb);
+                bridgeCode -= step * (stepLsb / oldLsb);
+                Cy_CSDIDAC_TransitionPair(ch, Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, outCode),
+                                          Cy_CSDIDAC_GetIdacRegValue(polarity, oldLsbIndex, bridgeCode),
+                                          !breakFirst, breakFirst, context);
+            }
+        }
+
+        /* Sets the target code and releases the rest of the idle IDAC, first if it does not fit */
+        breakFirst = ((newCurrent + (bridgeCode * oldLsb)) > hi);
+        Cy_CSDIDAC_TransitionPair(ch, newRegValue, partnerZero, !breakFirst, breakFirst, context);
+
+        /* Clears the idle IDAC register at the zero code */
+        if (0u != partnerZero)
+        {
+            CY_CSDIDAC_CSD_WRITE_REG(context, partnerOffset, 0u);
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_TransitionChunk
+****************************************************************************//**
+*
+* Returns the largest handover step of the bridged transition, that keeps
+* the summed current of both IDACs between the bounds.
+*
+* The summed current is the same before and after each step. A step taken
+* before it is released raises the sum, so it must not exceed the larger
+* current. A step released before it is taken lowers the sum, that must not
+* drop below the smaller current by more than the specified dip. The function
+* chooses the order, that allows the larger step, and returns at least one
+* unit, as the dip is not smaller than the unit.
+*
+* \param sum
+* The summed current of both IDACs in pA.
+*
+* \param lo
+* The smaller of the old and the new currents in pA.
+*
+* \param hi
+* The larger of the old and the new currents in pA.
+*
+* \param unit
+* The current of one step unit in pA.
+*
+* \param dip
+* The allowed drop below the smaller current in pA.
+*
+* \param breakFirst
+* The pointer to the order: true if the step is released first.
+*
+* \return
+* The step in units.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDIDAC_TransitionChunk(
+                uint32_t sum,
+                uint32_t lo,
+                uint32_t hi,
+                uint32_t unit,
+                uint32_t dip,
+                bool * breakFirst)
+{
+    uint32_t makeRoom = (hi - sum) / unit;
+    uint32_t breakRoom = ((sum + dip) - lo) / unit;
+
+    *breakFirst = (breakRoom > makeRoom);
+
+    return ((true == *breakFirst) ? breakRoom : makeRoom);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_TransitionPair
+****************************************************************************//**
+*
+* Writes the output IDAC register and the idle IDAC register of the bridged
+* transition in the specified order.
+*
+* The output IDAC is written by Cy_CSDIDAC_WriteIdacRegMasked() and its
+* verification mismatch is reported after the two writes. The idle IDAC
+* belongs to the disabled channel, so it is written directly and its context
+* is not changed. The step released before it is taken lowers the output,
+* so the two writes are performed with interrupts disabled.
+*
+* \param ch
+* The output channel: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param outRegValue
+* The output IDAC register value.
+*
+* \param partnerRegValue
+* The idle IDAC register value.
+*
+* \param outFirst
+* Writes the output IDAC first if true.
+*
+* \param masked
+* Disables interrupts for the two writes if true.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_TransitionPair(
+                cy_en_csdidac_choice_t ch,
+                uint32_t outRegValue,
+                uint32_t partnerRegValue,
+                bool outFirst,
+                bool masked,
+                cy_stc_csdidac_context_t * context)
+{
+    uint32_t partnerOffset = (CY_CSDIDAC_A == ch) ? CY_CSD_REG_OFFSET_IDACB : CY_CSD_REG_OFFSET_IDACA;
+    uint32_t outRegOld = (CY_CSDIDAC_A == ch) ? context->idacRegValueA : context->idacRegValueB;
+    uint32_t interruptState = 0u;
+
+    if (true == masked)
+    {
+        interruptState = CY_CSDIDAC_ENTER_CRITICAL_SECTION(context);
+    }
+    if ((true == outFirst) && (outRegOld != outRegValue))
+    {
+        Cy_CSDIDAC_WriteIdacRegMasked(ch, outRegValue, context);
+    }
+    CY_CSDIDAC_CSD_WRITE_REG(context, partnerOffset, partnerRegValue);
+    if ((false == outFirst) && (outRegOld != outRegValue))
+    {
+        Cy_CSDIDAC_WriteIdacRegMasked(ch, outRegValue, context);
+    }
+    if (true == masked)
+    {
+        CY_CSDIDAC_EXIT_CRITICAL_SECTION(context, interruptState);
+    }
+    CY_CSDIDAC_VERIFY_NOTIFY(context)
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_TransitionWrite
+****************************************************************************//**
+*
+* Writes the IDAC register value if it differs from the last written one.
+*
+* \param ch
+* The output channel: CY_CSDIDAC_A or CY_CSDIDAC_B.
+*
+* \param idacRegValue
+* The IDAC register value.
+*
+* \param lastRegValue
+* The pointer to the last written IDAC register value.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+*******************************************************************************/
+static void Cy_CSDIDAC_TransitionWrite(
+                cy_en_csdidac_choice_t ch,
+                uint32_t idacRegValue,
+                uint32_t * lastRegValue,
+                cy_stc_csdidac_context_t * context)
+{
+    if (idacRegValue != *lastRegValue)
+    {
+        Cy_CSDIDAC_WriteIdacReg(ch, idacRegValue, context);
+        *lastRegValue = idacRegValue;
+    }
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
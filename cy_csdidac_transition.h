@@ -0,0 +1,74 @@
+/***************************************************************************//**
+* \file cy_csdidac_transition.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the glitch-free LSB range transitions of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_TRANSITION_H)
+#define CY_CSDIDAC_TRANSITION_H
+
+#include "cy_csdidac.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/***************************************
+* Enumerated Types and Parameters
+***************************************/
+/**
+* \addtogroup group_csdidac_enums
+* \{
+*/
+
+/** The CSDIDAC LSB range transition mode enumeration type. */
+typedef enum
+{
+    CY_CSDIDAC_TRANSITION_DIRECT  = 0u,     /**< The range is changed on the output IDAC by monotonic steps */
+    CY_CSDIDAC_TRANSITION_BRIDGED = 1u,     /**< The range is changed at the zero code while the idle IDAC of the other channel carries the output */
+} cy_en_csdidac_transition_t;
+
+/** \} group_csdidac_enums */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_OutputTransition(
+                cy_en_csdidac_choice_t ch,
+                int32_t current,
+                cy_en_csdidac_transition_t mode,
+                cy_stc_csdidac_context_t * context);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_TRANSITION_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,315 @@
+/***************************************************************************//**
+* \file cy_csdidac_wave.c
+* \version 2.20
+*
+* \brief
+* This file provides the compressed waveform player implementation of
+* the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_device_headers.h"
+#include "cy_csdidac.h"
+#include "cy_csdidac_wave.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+
+/*******************************************************************************
+* Function Prototypes - Internal Functions
+*******************************************************************************/
+/**
+* \cond SECTION_CSDIDAC_INTERNAL
+* \addtogroup group_csdidac_internal
+* \{
+*/
+static uint32_t Cy_CSDIDAC_WaveGetAbsRegValue(uint32_t token, uint32_t code);
+/** \}
+* \endcond */
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_WaveInit
+****************************************************************************//**
+*
+* Verifies the compressed waveform and initializes the waveform player.
+*
+* The compressed waveform stores the samples as the byte tokens described in
+* the Compressed Waveform Format section, that are decoded one token per
+* Cy_CSDIDAC_WaveTick() call. A slowly changing waveform takes one byte
+* per sample, a constant section takes one byte per 64 samples, instead of
+* four bytes per sample of the IDAC register values. The waveform can be
+* prepared by Cy_CSDIDAC_WaveEncode() on the host or on the target.
+*
+* The function verifies the whole waveform by Cy_CSDIDAC_WaveDecode(), so
+* Cy_CSDIDAC_WaveTick() decodes it without any checks.
+*
+* The CSDIDAC middleware must be initialized by Cy_CSDIDAC_Init() prior
+* to calling this function.
+*
+* \param config
+* The pointer to the waveform configuration structure
+* \ref cy_stc_csdidac_wave_config_t.
+*
+* \param wave
+* The pointer to the waveform structure \ref cy_stc_csdidac_wave_t allocated
+* by the user.
+*
+* \param context
+* The pointer to the CSDIDAC middleware context
+* structure \ref cy_stc_csdidac_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL, an invalid parameter
+*                           is passed, or the waveform is invalid.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_WaveInit(
+                const cy_stc_csdidac_wave_config_t * config,
+                cy_stc_csdidac_wave_t * wave,
+                cy_stc_csdidac_context_t * context)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+    uint32_t sampleCount = 0u;
+
+    if ((NULL != config) && (NULL != wave) && (NULL != context))
+    {
+        if (((CY_CSDIDAC_A == config->ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configA)) ||
+            ((CY_CSDIDAC_B == config->ch) && (CY_CSDIDAC_DISABLED != context->cfgCopy.configB)))
+        {
+            sampleCount = Cy_CSDIDAC_WaveDecode(config->ptrData, config->size, NULL, 0u);
+            if (0u != sampleCount)
+            {
+                retVal = CY_CSDIDAC_SUCCESS;
+            }
+        }
+    }
+
+    if (CY_CSDIDAC_SUCCESS == retVal)
+    {
+        wave->cfgCopy = *config;
+        wave->ptrCsdidacCxt = context;
+        wave->sampleCount = sampleCount;
+        wave->busy = false;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_WaveStart
+****************************************************************************//**
+*
+* Enables the channel output and starts the waveform playback.
+*
+* The output is enabled with the zero current. The first sample is set by
+* the next Cy_CSDIDAC_WaveTick() call.
+*
+* \param wave
+* The pointer to the waveform structure \ref cy_stc_csdidac_wave_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_WaveStart(
+                cy_stc_csdidac_wave_t * wave)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != wave)
+    {
+        wave->busy = false;
+        retVal = Cy_CSDIDAC_OutputEnableExt(wave->cfgCopy.ch, CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u, wave->ptrCsdidacCxt);
+        if (CY_CSDIDAC_SUCCESS == retVal)
+        {
+            wave->position = 0u;
+            wave->repeatCount = 0u;
+            wave->busy = true;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_WaveTick
+****************************************************************************//**
+*
+* Outputs the next sample of the waveform.
+*
+* The function is intended to be called periodically, e.g. from a timer
+* interrupt. It decodes at most one token and writes the IDAC register only
+* if the sample is changed, so the cost per sample is bounded. After the last
+* sample, the END token either restarts the waveform in the same call or
+* stops the playback with the last sample kept at the output. The function
+* performs no verification. The IDAC register writes keep the polarity, LSB,
+* and code fields of the CSDIDAC context structure coherent with the output.
+*
+* \param wave
+* The pointer to the waveform structure \ref cy_stc_csdidac_wave_t.
+*
+*******************************************************************************/
+void Cy_CSDIDAC_WaveTick(
+                cy_stc_csdidac_wave_t * wave)
+{
+    const uint8_t * ptrData = wave->cfgCopy.ptrData;
+    uint32_t token;
+
+    if (true == wave->busy)
+    {
+        if (0u != wave->repeatCount)
+        {
+            wave->repeatCount--;
+        }
+        else
+        {
+            token = ptrData[wave->position];
+            if (CY_CSDIDAC_WAVE_TOKEN_END == token)
+            {
+                /* The first token is always the absolute sample */
+                wave->position = 0u;
+                token = ptrData[0u];
+                wave->busy = wave->cfgCopy.loop;
+            }
+
+            if (true == wave->busy)
+            {
+                wave->position++;
+                if (CY_CSDIDAC_WAVE_TOKEN_REPEAT > token)
+                {
+                    /* The 7-bit delta is added modulo 128, the result is verified to be in the code range */
+                    wave->idacRegValue = (wave->idacRegValue & ~CY_CSDIDAC_MAX_CODE) |
+                                         ((wave->idacRegValue + token) & CY_CSDIDAC_MAX_CODE);
+                    Cy_CSDIDAC_WriteIdacReg(wave->cfgCopy.ch, wave->idacRegValue, wave->ptrCsdidacCxt);
+                }
+                else if (CY_CSDIDAC_WAVE_TOKEN_ABS > token)
+                {
+                    /* The current tick is the first repeat */
+                    wave->repeatCount = token & CY_CSDIDAC_WAVE_TOKEN_REPEAT_MSK;
+                }
+                else
+                {
+                    wave->idacRegValue = Cy_CSDIDAC_WaveGetAbsRegValue(token, ptrData[wave->position]);
+                    wave->position++;
+                    Cy_CSDIDAC_WriteIdacReg(wave->cfgCopy.ch, wave->idacRegValue, wave->ptrCsdidacCxt);
+                }
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_WaveIsBusy
+****************************************************************************//**
+*
+* Returns the waveform player state.
+*
+* \param wave
+* The pointer to the waveform structure \ref cy_stc_csdidac_wave_t.
+*
+* \return
+* True if the waveform is playing, false if the END token is reached with
+* the loop disabled or the playback is not started.
+*
+*******************************************************************************/
+bool Cy_CSDIDAC_WaveIsBusy(
+                const cy_stc_csdidac_wave_t * wave)
+{
+    return (wave->busy);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_WaveGetSampleCount
+****************************************************************************//**
+*
+* Returns the number of the waveform samples.
+*
+* \param wave
+* The pointer to the waveform structure \ref cy_stc_csdidac_wave_t.
+*
+* \return
+* The number of the Cy_CSDIDAC_WaveTick() calls that output the waveform
+* samples. With the loop disabled, the END token is reached by the next call.
+*
+*******************************************************************************/
+uint32_t Cy_CSDIDAC_WaveGetSampleCount(
+                const cy_stc_csdidac_wave_t * wave)
+{
+    return (wave->sampleCount);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_WaveStop
+****************************************************************************//**
+*
+* Stops the waveform playback and disables the channel output.
+*
+* \param wave
+* The pointer to the waveform structure \ref cy_stc_csdidac_wave_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDIDAC_SUCCESS    - The operation is performed successfully.
+* * CY_CSDIDAC_BAD_PARAM  - The input pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdidac_status_t Cy_CSDIDAC_WaveStop(
+                cy_stc_csdidac_wave_t * wave)
+{
+    cy_en_csdidac_status_t retVal = CY_CSDIDAC_BAD_PARAM;
+
+    if (NULL != wave)
+    {
+        wave->busy = false;
+        retVal = Cy_CSDIDAC_OutputDisable(wave->cfgCopy.ch, wave->ptrCsdidacCxt);
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_WaveGetAbsRegValue
+****************************************************************************//**
+*
+* Composes the IDAC register value of the absolute sample token.
+*
+* \param token
+* The absolute sample token.
+*
+* \param code
+* The code byte that follows the token.
+*
+* \return
+* The IDAC register value.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDIDAC_WaveGetAbsRegValue(uint32_t token, uint32_t code)
+{
+    return (Cy_CSDIDAC_GetIdacRegValue(
+                (cy_en_csdidac_polarity_t)((token >> CY_CSDIDAC_WAVE_TOKEN_ABS_POLARITY_POS) & 1u),
+                (cy_en_csdidac_lsb_t)(token & CY_CSDIDAC_WAVE_TOKEN_ABS_LSB_MSK),
+                code));
+}
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,98 @@
+/***************************************************************************//**
+* \file cy_csdidac_wave.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants specific
+* to the compressed waveform player of the CSDIDAC middleware.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_WAVE_H)
+#define CY_CSDIDAC_WAVE_H
+
+#include "cy_csdidac.h"
+#include "cy_csdidac_wave_codec.h"
+
+#if (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2))
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/***************************************
+* Data Structure Definitions
+***************************************/
+/**
+* \addtogroup group_csdidac_data_structures
+* \{
+*/
+
+/** The CSDIDAC compressed waveform configuration structure */
+typedef struct
+{
+    cy_en_csdidac_choice_t ch;              /**< The output channel: CY_CSDIDAC_A or CY_CSDIDAC_B. */
+    const uint8_t * ptrData;                /**< The pointer to the compressed waveform, e.g. in the flash. */
+    uint32_t size;                          /**< The size of the compressed waveform in bytes. */
+    bool loop;                              /**< The waveform is repeated from the start after the END token. */
+} cy_stc_csdidac_wave_config_t;
+
+/** The CSDIDAC compressed waveform structure, that contains the player state. */
+typedef struct
+{
+    cy_stc_csdidac_wave_config_t cfgCopy;   /**< A configuration structure copy. */
+    cy_stc_csdidac_context_t * ptrCsdidacCxt; /**< The pointer to the CSDIDAC context structure. */
+    uint32_t sampleCount;                   /**< The number of the waveform samples. */
+    uint32_t position;                      /**< The offset of the next token. */
+    uint32_t repeatCount;                   /**< The remaining repeats of the current sample. */
+    uint32_t idacRegValue;                  /**< The IDAC register value of the current sample. */
+    bool busy;                              /**< The waveform is playing. */
+} cy_stc_csdidac_wave_t;
+
+/** \} group_csdidac_data_structures */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+cy_en_csdidac_status_t Cy_CSDIDAC_WaveInit(
+                const cy_stc_csdidac_wave_config_t * config,
+                cy_stc_csdidac_wave_t * wave,
+                cy_stc_csdidac_context_t * context);
+cy_en_csdidac_status_t Cy_CSDIDAC_WaveStart(
+                cy_stc_csdidac_wave_t * wave);
+void Cy_CSDIDAC_WaveTick(
+                cy_stc_csdidac_wave_t * wave);
+bool Cy_CSDIDAC_WaveIsBusy(
+                const cy_stc_csdidac_wave_t * wave);
+uint32_t Cy_CSDIDAC_WaveGetSampleCount(
+                const cy_stc_csdidac_wave_t * wave);
+cy_en_csdidac_status_t Cy_CSDIDAC_WaveStop(
+                cy_stc_csdidac_wave_t * wave);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
+
+#endif /* CY_CSDIDAC_WAVE_H */
+
+
+/* [] END OF FILE */
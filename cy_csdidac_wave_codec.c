@@ -0,0 +1,308 @@
+/***************************************************************************//**
+* \file cy_csdidac_wave_codec.c
+* \version 2.20
+*
+* \brief
+* This file provides the compressed waveform codec implementation of
+* the CSDIDAC middleware. The file does not depend on the device headers
+* and the PDL.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+
+#include "cy_csdidac_wave_codec.h"
+
+
+/*******************************************************************************
+* Local Definition
+*******************************************************************************/
+/* The reserved bits of the absolute sample token */
+#define CY_CSDIDAC_WAVE_TOKEN_ABS_RSVD_MSK      (0x30u)
+
+/* The sign bit of the DELTA token */
+#define CY_CSDIDAC_WAVE_TOKEN_DELTA_SIGN        (0x40u)
+
+/* The largest LSB index of the absolute sample token */
+#define CY_CSDIDAC_WAVE_LSB_MAX                 (5u)
+
+/* The sample bits allowed in the encoded samples: the code, the sink polarity, and the range */
+#define CY_CSDIDAC_WAVE_SAMPLE_MSK              (CY_CSDIDAC_WAVE_SAMPLE_CODE_MSK | \
+                                                 (1uL << CY_CSDIDAC_WAVE_SAMPLE_POLARITY_POS) | \
+                                                 CY_CSDIDAC_WAVE_SAMPLE_LSB_MSK | \
+                                                 CY_CSDIDAC_WAVE_SAMPLE_LEG1_MSK | \
+                                                 CY_CSDIDAC_WAVE_SAMPLE_LEG2_MSK)
+
+/* The maximum code changes of the DELTA token */
+#define CY_CSDIDAC_WAVE_DELTA_MAX               (63)
+#define CY_CSDIDAC_WAVE_DELTA_MIN               (-64)
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_WaveEncode
+****************************************************************************//**
+*
+* Encodes the IDAC register values to the compressed waveform.
+*
+* The function uses the REPEAT token for the repeated samples, the DELTA
+* token for the code changes from -64 to 63 with the same polarity and LSB,
+* and the absolute sample token otherwise. The function is built without
+* the device headers, so the waveforms can be prepared on the host for
+* the flash as well as on the target.
+*
+* \param ptrRegValues
+* The pointer to the array of the IDAC register values, e.g. composed by
+* Cy_CSDIDAC_GetIdacRegValue(). The value must have the leg1 enabled and
+* no bits other than the code, polarity, and range bits.
+*
+* \param sampleCount
+* The number of the samples.
+*
+* \param ptrData
+* The pointer to the buffer for the compressed waveform.
+*
+* \param size
+* The size of the buffer in bytes.
+*
+* \return
+* The size of the compressed waveform in bytes including the END token, or
+* zero if the input pointer is NULL, an invalid sample is passed, or
+* the buffer is too small.
+*
+*******************************************************************************/
+uint32_t Cy_CSDIDAC_WaveEncode(
+                const uint32_t * ptrRegValues,
+                uint32_t sampleCount,
+                uint8_t * ptrData,
+                uint32_t size)
+{
+    uint32_t length = 0u;
+    uint32_t i = 0u;
+    uint32_t repeat;
+    uint32_t sample;
+    uint32_t prevSample = 0u;
+    uint32_t lsbIndex;
+    int32_t delta;
+    uint32_t valid = 0u;
+
+    if ((NULL != ptrRegValues) && (NULL != ptrData) && (0u != sampleCount))
+    {
+        valid = 1u;
+    }
+
+    while ((0u != valid) && (i < sampleCount))
+    {
+        sample = ptrRegValues[i];
+        delta = (int32_t)(sample & CY_CSDIDAC_WAVE_SAMPLE_CODE_MSK) - (int32_t)(prevSample & CY_CSDIDAC_WAVE_SAMPLE_CODE_MSK);
+
+        if ((0u != (sample & ~CY_CSDIDAC_WAVE_SAMPLE_MSK)) || (0u == (sample & CY_CSDIDAC_WAVE_SAMPLE_LEG1_MSK)) ||
+            (CY_CSDIDAC_WAVE_SAMPLE_LSB_MSK == (sample & CY_CSDIDAC_WAVE_SAMPLE_LSB_MSK)))
+        {
+            valid = 0u;
+        }
+        else if ((0u != i) && (sample == prevSample))
+        {
+            repeat = 1u;
+            while (((i + repeat) < sampleCount) && (CY_CSDIDAC_WAVE_MAX_REPEAT > repeat) &&
+                   (ptrRegValues[i + repeat] == prevSample))
+            {
+                repeat++;
+            }
+            if (length < size)
+            {
+                ptrData[length] = (uint8_t)(CY_CSDIDAC_WAVE_TOKEN_REPEAT | (repeat - 1u));
+                length++;
+                i += repeat;
+            }
+            else
+            {
+                valid = 0u;
+            }
+        }
+        else if ((0u != i) &&
+                 ((sample & ~CY_CSDIDAC_WAVE_SAMPLE_CODE_MSK) == (prevSample & ~CY_CSDIDAC_WAVE_SAMPLE_CODE_MSK)) &&
+                 (CY_CSDIDAC_WAVE_DELTA_MAX >= delta) && (CY_CSDIDAC_WAVE_DELTA_MIN <= delta))
+        {
+            if (length < size)
+            {
+                ptrData[length] = (uint8_t)((uint32_t)delta & CY_CSDIDAC_WAVE_TOKEN_DELTA_MSK);
+                length++;
+                prevSample = sample;
+                i++;
+            }
+            else
+            {
+                valid = 0u;
+            }
+        }
+        else
+        {
+            if ((length + 1u) < size)
+            {
+                /* The LSB index is the LSB field multiplied by 2 plus the leg2 enabling bit */
+                lsbIndex = (((sample & CY_CSDIDAC_WAVE_SAMPLE_LSB_MSK) >> CY_CSDIDAC_WAVE_SAMPLE_LSB_POS) << 1u) |
+                           ((sample & CY_CSDIDAC_WAVE_SAMPLE_LEG2_MSK) >> CY_CSDIDAC_WAVE_SAMPLE_LEG2_POS);
+                ptrData[length] = (uint8_t)(CY_CSDIDAC_WAVE_TOKEN_ABS | lsbIndex |
+                                  (((sample >> CY_CSDIDAC_WAVE_SAMPLE_POLARITY_POS) & 1u) <<
+                                   CY_CSDIDAC_WAVE_TOKEN_ABS_POLARITY_POS));
+                ptrData[length + 1u] = (uint8_t)(sample & CY_CSDIDAC_WAVE_SAMPLE_CODE_MSK);
+                length += 2u;
+                prevSample = sample;
+                i++;
+            }
+            else
+            {
+                valid = 0u;
+            }
+        }
+    }
+
+    if ((0u != valid) && (length < size))
+    {
+        ptrData[length] = CY_CSDIDAC_WAVE_TOKEN_END;
+        length++;
+    }
+    else
+    {
+        length = 0u;
+    }
+
+    return (length);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDIDAC_WaveDecode
+****************************************************************************//**
+*
+* Verifies the compressed waveform and optionally decodes its samples.
+*
+* The function is used by Cy_CSDIDAC_WaveInit() to verify the waveform
+* before the playback, and on the host to check the encoded waveforms.
+*
+* \param ptrData
+* The pointer to the compressed waveform.
+*
+* \param size
+* The size of the compressed waveform in bytes.
+*
+* \param ptrRegValues
+* The pointer to the array for the decoded IDAC register values, or NULL
+* to verify the waveform only.
+*
+* \param maxCount
+* The number of the ptrRegValues array elements. Ignored if ptrRegValues
+* is NULL.
+*
+* \return
+* The number of the waveform samples, or zero if the waveform is invalid,
+* has no samples, or has more samples than maxCount.
+*
+*******************************************************************************/
+uint32_t Cy_CSDIDAC_WaveDecode(
+                const uint8_t * ptrData,
+                uint32_t size,
+                uint32_t * ptrRegValues,
+                uint32_t maxCount)
+{
+    uint32_t position = 0u;
+    uint32_t sampleCount = 0u;
+    uint32_t sample = 0u;
+    uint32_t repeat;
+    uint32_t token;
+    int32_t code = 0;
+    uint32_t valid = 0u;
+    uint32_t endFound = 0u;
+
+    /* The first token must be the absolute sample */
+    if ((NULL != ptrData) && (0u != size))
+    {
+        if (CY_CSDIDAC_WAVE_TOKEN_ABS == (ptrData[0u] & CY_CSDIDAC_WAVE_TOKEN_ABS))
+        {
+            valid = 1u;
+        }
+    }
+
+    while ((0u != valid) && (0u == endFound))
+    {
+        repeat = 1u;
+        if (position >= size)
+        {
+            /* The END token is missing */
+            valid = 0u;
+        }
+        else
+        {
+            token = ptrData[position];
+            position++;
+
+            if (CY_CSDIDAC_WAVE_TOKEN_REPEAT > token)
+            {
+                code += (int32_t)(token ^ CY_CSDIDAC_WAVE_TOKEN_DELTA_SIGN) - (int32_t)CY_CSDIDAC_WAVE_TOKEN_DELTA_SIGN;
+                if ((0 > code) || ((int32_t)CY_CSDIDAC_WAVE_SAMPLE_CODE_MSK < code))
+                {
+                    valid = 0u;
+                }
+                sample = (sample & ~CY_CSDIDAC_WAVE_SAMPLE_CODE_MSK) | ((uint32_t)code & CY_CSDIDAC_WAVE_SAMPLE_CODE_MSK);
+            }
+            else if (CY_CSDIDAC_WAVE_TOKEN_ABS > token)
+            {
+                repeat = (token & CY_CSDIDAC_WAVE_TOKEN_REPEAT_MSK) + 1u;
+            }
+            else if (CY_CSDIDAC_WAVE_TOKEN_END == token)
+            {
+                endFound = 1u;
+                repeat = 0u;
+            }
+            else if ((0u == (token & CY_CSDIDAC_WAVE_TOKEN_ABS_RSVD_MSK)) &&
+                     (CY_CSDIDAC_WAVE_LSB_MAX >= (token & CY_CSDIDAC_WAVE_TOKEN_ABS_LSB_MSK)) &&
+                     (position < size) && (CY_CSDIDAC_WAVE_SAMPLE_CODE_MSK >= ptrData[position]))
+            {
+                code = (int32_t)ptrData[position];
+                position++;
+                /* The LSB field is the LSB index divided by 2 and the leg2 enabling bit is the index parity */
+                sample = (uint32_t)code | CY_CSDIDAC_WAVE_SAMPLE_LEG1_MSK |
+                         (((token >> CY_CSDIDAC_WAVE_TOKEN_ABS_POLARITY_POS) & 1u) << CY_CSDIDAC_WAVE_SAMPLE_POLARITY_POS) |
+                         (((token & CY_CSDIDAC_WAVE_TOKEN_ABS_LSB_MSK) >> 1u) << CY_CSDIDAC_WAVE_SAMPLE_LSB_POS) |
+                         ((token & 1u) << CY_CSDIDAC_WAVE_SAMPLE_LEG2_POS);
+            }
+            else
+            {
+                valid = 0u;
+            }
+        }
+
+        if ((0u != valid) && (NULL != ptrRegValues))
+        {
+            if ((maxCount - sampleCount) < repeat)
+            {
+                valid = 0u;
+            }
+            else
+            {
+                while (0u != repeat)
+                {
+                    ptrRegValues[sampleCount] = sample;
+                    sampleCount++;
+                    repeat--;
+                }
+            }
+        }
+        sampleCount += repeat;
+    }
+
+    if (0u == valid)
+    {
+        sampleCount = 0u;
+    }
+
+    return (sampleCount);
+}
+
+
+/* [] END OF FILE */
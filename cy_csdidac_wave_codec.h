@@ -0,0 +1,107 @@
+/***************************************************************************//**
+* \file cy_csdidac_wave_codec.h
+* \version 2.20
+*
+* \brief
+* This file provides the function prototypes and constants of the compressed
+* waveform codec of the CSDIDAC middleware. The codec does not depend on
+* the device headers and the PDL, so it is built for the host as well as
+* for the target.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_WAVE_CODEC_H)
+#define CY_CSDIDAC_WAVE_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* The C binding of definitions to build with the C++ compiler. */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/**
+* \addtogroup group_csdidac_macros
+* \{
+*/
+
+/**
+* \name Compressed Waveform Format
+* The waveform is a byte stream of the following tokens, each token produces
+* one or more samples:
+* * 0b0ddddddd - The code of the previous sample is changed by the 7-bit
+*   two's complement delta ddddddd (from -64 to 63).
+* * 0b10nnnnnn - The previous sample is repeated nnnnnn + 1 times.
+* * 0b1100pfff, 0b0ccccccc - The sample of the polarity p
+*   (\ref cy_en_csdidac_polarity_t), LSB fff (\ref cy_en_csdidac_lsb_t), and
+*   code ccccccc. The first token of a waveform must be of this type.
+* * 0b11111111 - The end of the waveform.
+* \{
+*/
+#define CY_CSDIDAC_WAVE_TOKEN_DELTA_MSK         (0x7Fu)     /**< The delta of the DELTA token */
+#define CY_CSDIDAC_WAVE_TOKEN_REPEAT            (0x80u)     /**< The REPEAT token */
+#define CY_CSDIDAC_WAVE_TOKEN_REPEAT_MSK        (0x3Fu)     /**< The repeat count minus one of the REPEAT token */
+#define CY_CSDIDAC_WAVE_TOKEN_ABS               (0xC0u)     /**< The absolute sample token */
+#define CY_CSDIDAC_WAVE_TOKEN_ABS_POLARITY_POS  (3u)        /**< The polarity position of the absolute sample token */
+#define CY_CSDIDAC_WAVE_TOKEN_ABS_LSB_MSK       (0x07u)     /**< The LSB of the absolute sample token */
+#define CY_CSDIDAC_WAVE_TOKEN_END               (0xFFu)     /**< The END token */
+#define CY_CSDIDAC_WAVE_MAX_REPEAT              (64u)       /**< The maximum number of samples of the REPEAT token */
+/** \} */
+
+/**
+* \name Compressed Waveform Samples
+* The samples are the IDACA / IDACB register values composed by
+* Cy_CSDIDAC_GetIdacRegValue(). The fields repeat the IDAC register layout,
+* so the codec is built without the device headers.
+* \{
+*/
+#define CY_CSDIDAC_WAVE_SAMPLE_CODE_MSK         (0x7Fu)     /**< The code field of the sample */
+#define CY_CSDIDAC_WAVE_SAMPLE_POLARITY_POS     (8u)        /**< The polarity field position of the sample */
+#define CY_CSDIDAC_WAVE_SAMPLE_LSB_POS          (22u)       /**< The LSB field position of the sample */
+#define CY_CSDIDAC_WAVE_SAMPLE_LSB_MSK          (3uL << CY_CSDIDAC_WAVE_SAMPLE_LSB_POS)     /**< The LSB field of the sample */
+#define CY_CSDIDAC_WAVE_SAMPLE_LEG1_MSK         (1uL << 24u)                                /**< The leg1 enabling bit of the sample */
+#define CY_CSDIDAC_WAVE_SAMPLE_LEG2_POS         (25u)       /**< The leg2 enabling bit position of the sample */
+#define CY_CSDIDAC_WAVE_SAMPLE_LEG2_MSK         (1uL << CY_CSDIDAC_WAVE_SAMPLE_LEG2_POS)    /**< The leg2 enabling bit of the sample */
+/** \} */
+
+/** \} group_csdidac_macros */
+
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/**
+* \addtogroup group_csdidac_functions
+* \{
+*/
+uint32_t Cy_CSDIDAC_WaveEncode(
+                const uint32_t * ptrRegValues,
+                uint32_t sampleCount,
+                uint8_t * ptrData,
+                uint32_t size);
+uint32_t Cy_CSDIDAC_WaveDecode(
+                const uint8_t * ptrData,
+                uint32_t size,
+                uint32_t * ptrRegValues,
+                uint32_t maxCount);
+
+/** \} group_csdidac_functions */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CY_CSDIDAC_WAVE_CODEC_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,198 @@
+/***************************************************************************//**
+* \file fuzz_csdidac.c
+*
+* \brief
+* The fuzz harness of the CSDIDAC middleware core API. The input is
+* the channel configurations followed by the operation tokens. Each
+* operation is applied to the middleware and to the reference model, then
+* the status, the IDAC registers, the bypass switches, the pin HSIOM,
+* the CSD lock, the channel states, and the context coherence are compared.
+*
+* Build with libFuzzer: make fuzz (requires clang)
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "cy_gpio.h"
+#include "cy_csdidac_setpoint.h"
+#include "fuzz_model.h"
+#include "fuzz_csdidac.h"
+
+/* The range of the fuzzed current covers the valid and the out-of-range values */
+#define FUZZ_CURRENT_RANGE                      (1000000)
+
+CSD_Type fuzz_csd;
+static cy_stc_csd_context_t fuzz_csdContext;
+static GPIO_PRT_Type fuzz_port;
+static const cy_stc_csdidac_pin_t fuzz_pinA = {&fuzz_port, 1u};
+static const cy_stc_csdidac_pin_t fuzz_pinB = {&fuzz_port, 2u};
+static cy_stc_csdidac_config_t fuzz_config;
+static cy_stc_csdidac_context_t fuzz_context;
+static fuzz_model_t fuzz_model;
+
+static cy_en_csdidac_status_t fuzz_init(uint32_t configA, uint32_t configB)
+{
+    fuzz_config.base = &fuzz_csd;
+    fuzz_config.csdCxtPtr = &fuzz_csdContext;
+    fuzz_config.configA = (cy_en_csdidac_channel_config_t)configA;
+    fuzz_config.configB = (cy_en_csdidac_channel_config_t)configB;
+    fuzz_config.ptrPinA = &fuzz_pinA;
+    fuzz_config.ptrPinB = &fuzz_pinB;
+    fuzz_config.cpuClk = 48000000u;
+    fuzz_config.csdInitTime = 10u;
+
+    return (Cy_CSDIDAC_Init(&fuzz_config, &fuzz_context));
+}
+
+/* The decoded output settings of each channel describe its IDAC register */
+static bool fuzz_isCoherent(uint32_t regValue, cy_en_csdidac_choice_t ch)
+{
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t code;
+
+    return ((CY_CSDIDAC_SUCCESS == Cy_CSDIDAC_GetOutputSettings(ch, &polarity, &lsbIndex, &code, &fuzz_context)) &&
+            (code == (regValue & CY_CSDIDAC_MAX_CODE)) &&
+            ((0u == regValue) || (regValue == fuzz_modelRegValue((uint32_t)polarity, (uint32_t)lsbIndex, code))));
+}
+
+bool fuzz_csdidacCheck(void)
+{
+    const uint32_t regA = fuzz_csd.reg[CY_CSD_REG_OFFSET_IDACA >> 2u];
+    const uint32_t regB = fuzz_csd.reg[CY_CSD_REG_OFFSET_IDACB >> 2u];
+
+    return ((fuzz_model.idac[0u] == regA) && (fuzz_model.idac[1u] == regB) &&
+            (fuzz_model.bypass == (fuzz_csd.reg[CY_CSD_REG_OFFSET_SW_BYP_SEL >> 2u] & (FUZZ_MODEL_BYPA | FUZZ_MODEL_BYPB))) &&
+            (fuzz_model.hsiom[0u] == (uint32_t)Cy_GPIO_GetHSIOM(&fuzz_port, fuzz_pinA.pin)) &&
+            (fuzz_model.hsiom[1u] == (uint32_t)Cy_GPIO_GetHSIOM(&fuzz_port, fuzz_pinB.pin)) &&
+            (fuzz_model.locked == (CY_CSD_IDAC_KEY == fuzz_csdContext.lockKey)) &&
+            (fuzz_model.enabled[0u] == (CY_CSDIDAC_ENABLE == fuzz_context.channelStateA)) &&
+            (fuzz_model.enabled[1u] == (CY_CSDIDAC_ENABLE == fuzz_context.channelStateB)) &&
+            (fuzz_model.config[0u] == fuzz_context.cfgCopy.configA) &&
+            (fuzz_model.config[1u] == fuzz_context.cfgCopy.configB) &&
+            (true == fuzz_isCoherent(regA, CY_CSDIDAC_A)) &&
+            (true == fuzz_isCoherent(regB, CY_CSDIDAC_B)));
+}
+
+/* Applies the input and returns the number of the operations, that mismatch the model */
+uint32_t fuzz_csdidacRun(const uint8_t * data, size_t size, uint32_t * ptrOps)
+{
+    cy_stc_csdidac_setpoint_t setpoint;
+    cy_en_csdidac_status_t status;
+    cy_en_csdidac_status_t expected;
+    uint32_t mismatches = 0u;
+    uint32_t payload;
+    uint32_t ch;
+    uint32_t op;
+    uint32_t ops = 0u;
+    int32_t current;
+    size_t position = 1u;
+
+    (void)memset((void *)&fuzz_csd, 0, sizeof(fuzz_csd));
+    (void)memset(&fuzz_csdContext, 0, sizeof(fuzz_csdContext));
+    (void)memset((void *)&fuzz_port, 0, sizeof(fuzz_port));
+    (void)memset(&fuzz_config, 0, sizeof(fuzz_config));
+    (void)memset(&fuzz_context, 0, sizeof(fuzz_context));
+    fuzz_modelReset(&fuzz_model);
+
+    if (0u != size)
+    {
+        /* The first byte is the initial configuration of both channels */
+        expected = fuzz_modelInit(&fuzz_model, data[0u] & 3u, (data[0u] >> 2u) & 3u);
+        status = fuzz_init(data[0u] & 3u, (data[0u] >> 2u) & 3u);
+        ops++;
+        if ((expected != status) || (false == fuzz_csdidacCheck()))
+        {
+            mismatches++;
+        }
+    }
+
+    while ((position + FUZZ_OP_SIZE) <= size)
+    {
+        ch = ((uint32_t)data[position] >> FUZZ_OP_CH_POS) & 3u;
+        payload = (uint32_t)data[position + 1u] | ((uint32_t)data[position + 2u] << 8u) |
+                  ((uint32_t)data[position + 3u] << 16u) | ((uint32_t)data[position + 4u] << 24u);
+        current = (int32_t)payload % FUZZ_CURRENT_RANGE;
+        op = (uint32_t)data[position] % FUZZ_OP_NUM;
+        position += FUZZ_OP_SIZE;
+
+        /* The middleware must be initialized prior to calling any other function */
+        if ((FUZZ_OP_INIT != op) && (NULL == fuzz_context.cfgCopy.base))
+        {
+            continue;
+        }
+
+        switch (op)
+        {
+            case FUZZ_OP_INIT:
+                expected = fuzz_modelInit(&fuzz_model, payload & 3u, (payload >> 2u) & 3u);
+                status = fuzz_init(payload & 3u, (payload >> 2u) & 3u);
+                break;
+            case FUZZ_OP_ENABLE:
+                expected = ((int32_t)CY_CSDIDAC_MAX_CURRENT_NA < abs(current)) ? CY_CSDIDAC_BAD_PARAM :
+                           fuzz_modelEnable(&fuzz_model, ch, fuzz_modelConvert(current));
+                status = Cy_CSDIDAC_OutputEnable((cy_en_csdidac_choice_t)ch, current, &fuzz_context);
+                break;
+            case FUZZ_OP_ENABLE_EXT:
+                /* The polarity of 2 bits, the LSB of 3 bits, and the code of 8 bits include the invalid values */
+                expected = (((payload & 3u) > 1u) || (((payload >> 2u) & 7u) > 5u) || (((payload >> 5u) & 0xFFu) > 127u)) ?
+                           CY_CSDIDAC_BAD_PARAM :
+                           fuzz_modelEnable(&fuzz_model, ch, fuzz_modelRegValue(payload & 3u, (payload >> 2u) & 7u,
+                                                                                 (payload >> 5u) & 0xFFu));
+                status = Cy_CSDIDAC_OutputEnableExt((cy_en_csdidac_choice_t)ch, (cy_en_csdidac_polarity_t)(payload & 3u),
+                                                    (cy_en_csdidac_lsb_t)((payload >> 2u) & 7u), (payload >> 5u) & 0xFFu,
+                                                    &fuzz_context);
+                break;
+            case FUZZ_OP_DISABLE:
+                expected = fuzz_modelDisable(&fuzz_model, ch);
+                status = Cy_CSDIDAC_OutputDisable((cy_en_csdidac_choice_t)ch, &fuzz_context);
+                break;
+            case FUZZ_OP_DEINIT:
+                expected = fuzz_modelDeInit(&fuzz_model);
+                status = Cy_CSDIDAC_DeInit(&fuzz_context);
+                break;
+            default:
+                /* The setpoint module writes the IDAC registers only */
+                expected = ((int32_t)CY_CSDIDAC_MAX_CURRENT_NA < abs(current)) ? CY_CSDIDAC_BAD_PARAM :
+                           fuzz_modelSetpoint(&fuzz_model, ch, fuzz_modelConvert(current));
+                status = Cy_CSDIDAC_SetpointPrepare((cy_en_csdidac_choice_t)ch, current, &setpoint, &fuzz_context);
+                if (CY_CSDIDAC_SUCCESS == status)
+                {
+                    Cy_CSDIDAC_SetpointCommit(&setpoint);
+                }
+                break;
+        }
+        ops++;
+        if ((expected != status) || (false == fuzz_csdidacCheck()))
+        {
+            mismatches++;
+        }
+    }
+
+    if (NULL != ptrOps)
+    {
+        *ptrOps = ops;
+    }
+
+    return (mismatches);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t * data, size_t size)
+{
+    if (0u != fuzz_csdidacRun(data, size, NULL))
+    {
+        abort();
+    }
+
+    return (0);
+}
+
+
+/* [] END OF FILE */
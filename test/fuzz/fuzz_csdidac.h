@@ -0,0 +1,44 @@
+/***************************************************************************//**
+* \file fuzz_csdidac.h
+*
+* \brief
+* The fuzz harness of the CSDIDAC middleware core API: the libFuzzer entry
+* point and the functions used by the deterministic driver of the host
+* tests.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(FUZZ_CSDIDAC_H)
+#define FUZZ_CSDIDAC_H
+
+#include <stddef.h>
+#include "cy_csdidac.h"
+
+/* The operation tokens of the fuzz input: the op byte, that selects the op and the channel, and 4 payload bytes */
+#define FUZZ_OP_INIT                            (0u)
+#define FUZZ_OP_ENABLE                          (1u)
+#define FUZZ_OP_ENABLE_EXT                      (2u)
+#define FUZZ_OP_DISABLE                         (3u)
+#define FUZZ_OP_DEINIT                          (4u)
+#define FUZZ_OP_SETPOINT                        (5u)
+#define FUZZ_OP_NUM                             (6u)
+#define FUZZ_OP_CH_POS                          (4u)
+#define FUZZ_OP_SIZE                            (5u)
+
+/* The simulated CSD HW block of the harness */
+extern CSD_Type fuzz_csd;
+
+uint32_t fuzz_csdidacRun(const uint8_t * data, size_t size, uint32_t * ptrOps);
+bool fuzz_csdidacCheck(void);
+int LLVMFuzzerTestOneInput(const uint8_t * data, size_t size);
+
+#endif /* FUZZ_CSDIDAC_H */
+
+
+/* [] END OF FILE */
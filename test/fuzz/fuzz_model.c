@@ -0,0 +1,204 @@
+/***************************************************************************//**
+* \file fuzz_model.c
+*
+* \brief
+* The reference model of the CSDIDAC middleware core API. The model is
+* written from the API documentation and does not call the middleware:
+* the current conversion, the register composition, the channel routing,
+* and the parameter validation are implemented independently.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include <string.h>
+#include "fuzz_model.h"
+
+#define FUZZ_MODEL_A                            (0u)
+#define FUZZ_MODEL_B                            (1u)
+#define FUZZ_MODEL_AB                           (2u)
+#define FUZZ_MODEL_CODE_MAX                     (127u)
+#define FUZZ_MODEL_LSB_NUM                      (6u)
+#define FUZZ_MODEL_CURRENT_MAX                  (609600)
+
+/* The LSB of each range in pA */
+static const uint32_t fuzz_modelLsbPa[FUZZ_MODEL_LSB_NUM] = {37500u, 75000u, 300000u, 600000u, 2400000u, 4800000u};
+
+static const uint32_t fuzz_modelBypass[2u] = {FUZZ_MODEL_BYPA, FUZZ_MODEL_BYPB};
+static const uint32_t fuzz_modelAmux[2u] = {(uint32_t)HSIOM_SEL_AMUXA, (uint32_t)HSIOM_SEL_AMUXB};
+
+void fuzz_modelReset(fuzz_model_t * model)
+{
+    (void)memset(model, 0, sizeof(*model));
+}
+
+/* The IDAC register: the code in bits 0-6, the sink in bit 8, the LSB / 2 in bits 22-23, the legs in bits 24-25 */
+uint32_t fuzz_modelRegValue(uint32_t polarity, uint32_t lsbIndex, uint32_t code)
+{
+    return (code | (polarity << 8u) | ((lsbIndex / 2u) << 22u) | (1uL << 24u) | ((lsbIndex % 2u) << 25u));
+}
+
+/* The smallest range, which full scale exceeds the current, and the code rounded down */
+uint32_t fuzz_modelConvert(int32_t current)
+{
+    uint64_t absPa = (uint64_t)((0 > current) ? -(int64_t)current : (int64_t)current) * 1000u;
+    uint32_t i = 0u;
+
+    while (((i + 1u) < FUZZ_MODEL_LSB_NUM) && (absPa >= ((uint64_t)FUZZ_MODEL_CODE_MAX * fuzz_modelLsbPa[i])))
+    {
+        i++;
+    }
+
+    return (fuzz_modelRegValue((0 > current) ? 1u : 0u, i, (uint32_t)(absPa / fuzz_modelLsbPa[i])));
+}
+
+static bool fuzz_modelIsChoiceValid(const fuzz_model_t * model, uint32_t ch)
+{
+    return ((FUZZ_MODEL_A == ch) || (FUZZ_MODEL_B == ch) ||
+            ((FUZZ_MODEL_AB == ch) && (CY_CSDIDAC_DISABLED != model->config[0u]) &&
+             (CY_CSDIDAC_DISABLED != model->config[1u])));
+}
+
+static void fuzz_modelDisconnect(fuzz_model_t * model, uint32_t i)
+{
+    model->enabled[i] = false;
+    model->idac[i] = 0u;
+    if ((CY_CSDIDAC_GPIO == model->config[i]) || (CY_CSDIDAC_AMUX == model->config[i]))
+    {
+        model->bypass &= ~fuzz_modelBypass[i];
+    }
+    if (CY_CSDIDAC_GPIO == model->config[i])
+    {
+        model->hsiom[i] = (uint32_t)HSIOM_SEL_GPIO;
+    }
+}
+
+cy_en_csdidac_status_t fuzz_modelInit(fuzz_model_t * model, uint32_t configA, uint32_t configB)
+{
+    cy_en_csdidac_status_t status = CY_CSDIDAC_BAD_CONFIGURATION;
+    bool joinA = (CY_CSDIDAC_JOIN == configA);
+    bool joinB = (CY_CSDIDAC_JOIN == configB);
+    bool offA = (CY_CSDIDAC_DISABLED == configA);
+    bool offB = (CY_CSDIDAC_DISABLED == configB);
+
+    /* A joined channel needs the enabled partner, that is not joined */
+    if ((CY_CSDIDAC_JOIN >= configA) && (CY_CSDIDAC_JOIN >= configB) && !(offA && offB) &&
+        !(joinA && (offB || joinB)) && !(joinB && offA))
+    {
+        /* The configuration is copied before the CSD HW block is captured */
+        model->config[0u] = (cy_en_csdidac_channel_config_t)configA;
+        model->config[1u] = (cy_en_csdidac_channel_config_t)configB;
+        status = CY_CSDIDAC_HW_LOCKED;
+        if (false == model->locked)
+        {
+            model->locked = true;
+            model->bypass = 0u;
+            fuzz_modelDisconnect(model, 0u);
+            fuzz_modelDisconnect(model, 1u);
+            status = CY_CSDIDAC_SUCCESS;
+        }
+    }
+
+    return (status);
+}
+
+cy_en_csdidac_status_t fuzz_modelDeInit(fuzz_model_t * model)
+{
+    cy_en_csdidac_status_t status = CY_CSDIDAC_HW_LOCKED;
+
+    if (true == model->locked)
+    {
+        fuzz_modelDisconnect(model, 0u);
+        fuzz_modelDisconnect(model, 1u);
+        model->locked = false;
+        status = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (status);
+}
+
+/* The output of a joined channel is the pin of its partner */
+cy_en_csdidac_status_t fuzz_modelEnable(fuzz_model_t * model, uint32_t ch, uint32_t regValue)
+{
+    cy_en_csdidac_status_t status = CY_CSDIDAC_BAD_PARAM;
+    bool enable[2u];
+    bool connect[2u];
+    uint32_t i;
+
+    if (true == fuzz_modelIsChoiceValid(model, ch))
+    {
+        enable[0u] = ((FUZZ_MODEL_B != ch) && (CY_CSDIDAC_DISABLED != model->config[0u]));
+        enable[1u] = ((FUZZ_MODEL_A != ch) && (CY_CSDIDAC_DISABLED != model->config[1u]));
+        connect[0u] = (enable[0u] || (enable[1u] && (CY_CSDIDAC_JOIN == model->config[1u])));
+        connect[1u] = (enable[1u] || (enable[0u] && (CY_CSDIDAC_JOIN == model->config[0u])));
+        for (i = 0u; i < 2u; i++)
+        {
+            if ((true == connect[i]) && ((CY_CSDIDAC_GPIO == model->config[i]) || (CY_CSDIDAC_AMUX == model->config[i])))
+            {
+                model->bypass |= fuzz_modelBypass[i];
+            }
+            if ((true == connect[i]) && (CY_CSDIDAC_GPIO == model->config[i]))
+            {
+                model->hsiom[i] = fuzz_modelAmux[i];
+            }
+            if (true == enable[i])
+            {
+                model->enabled[i] = true;
+                model->idac[i] = regValue;
+                status = CY_CSDIDAC_SUCCESS;
+            }
+        }
+    }
+
+    return (status);
+}
+
+cy_en_csdidac_status_t fuzz_modelDisable(fuzz_model_t * model, uint32_t ch)
+{
+    cy_en_csdidac_status_t status = CY_CSDIDAC_BAD_PARAM;
+
+    if (FUZZ_MODEL_AB >= ch)
+    {
+        if (FUZZ_MODEL_B != ch)
+        {
+            fuzz_modelDisconnect(model, 0u);
+        }
+        if (FUZZ_MODEL_A != ch)
+        {
+            fuzz_modelDisconnect(model, 1u);
+        }
+        status = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (status);
+}
+
+/* The prepared setpoint is committed to the IDAC registers only */
+cy_en_csdidac_status_t fuzz_modelSetpoint(fuzz_model_t * model, uint32_t ch, uint32_t regValue)
+{
+    cy_en_csdidac_status_t status = CY_CSDIDAC_BAD_PARAM;
+
+    if ((true == fuzz_modelIsChoiceValid(model, ch)) &&
+        ((FUZZ_MODEL_A != ch) || (CY_CSDIDAC_DISABLED != model->config[0u])) &&
+        ((FUZZ_MODEL_B != ch) || (CY_CSDIDAC_DISABLED != model->config[1u])))
+    {
+        if (FUZZ_MODEL_B != ch)
+        {
+            model->idac[0u] = regValue;
+        }
+        if (FUZZ_MODEL_A != ch)
+        {
+            model->idac[1u] = regValue;
+        }
+        status = CY_CSDIDAC_SUCCESS;
+    }
+
+    return (status);
+}
+
+
+/* [] END OF FILE */
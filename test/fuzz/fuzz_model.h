@@ -0,0 +1,52 @@
+/***************************************************************************//**
+* \file fuzz_model.h
+*
+* \brief
+* The reference model of the CSDIDAC middleware core API for the fuzz
+* harness: the expected status of each operation and the expected state of
+* the IDAC registers, the bypass switches, the output pin HSIOM, the CSD
+* lock, and the channel states.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(FUZZ_MODEL_H)
+#define FUZZ_MODEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_csdidac.h"
+
+/* The bypass switches of the SW_BYP_SEL register */
+#define FUZZ_MODEL_BYPA                         (0x00001000uL)
+#define FUZZ_MODEL_BYPB                         (0x00010000uL)
+
+/* The expected HW and context state */
+typedef struct
+{
+    cy_en_csdidac_channel_config_t config[2u];  /* The channel configurations of the context */
+    uint32_t idac[2u];                          /* The IDACA and IDACB register values */
+    uint32_t bypass;                            /* The bypass switches of the SW_BYP_SEL register */
+    uint32_t hsiom[2u];                         /* The HSIOM of the pins A and B */
+    bool enabled[2u];                           /* The channel states */
+    bool locked;                                /* The CSD HW block is locked by the CSDIDAC */
+} fuzz_model_t;
+
+void fuzz_modelReset(fuzz_model_t * model);
+uint32_t fuzz_modelRegValue(uint32_t polarity, uint32_t lsbIndex, uint32_t code);
+uint32_t fuzz_modelConvert(int32_t current);
+cy_en_csdidac_status_t fuzz_modelInit(fuzz_model_t * model, uint32_t configA, uint32_t configB);
+cy_en_csdidac_status_t fuzz_modelDeInit(fuzz_model_t * model);
+cy_en_csdidac_status_t fuzz_modelEnable(fuzz_model_t * model, uint32_t ch, uint32_t regValue);
+cy_en_csdidac_status_t fuzz_modelDisable(fuzz_model_t * model, uint32_t ch);
+cy_en_csdidac_status_t fuzz_modelSetpoint(fuzz_model_t * model, uint32_t ch, uint32_t regValue);
+
+#endif /* FUZZ_MODEL_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,75 @@
+/***************************************************************************//**
+* \file cy_csdidac_async_pthread.h
+*
+* \brief
+* The POSIX threads port of the CSDIDAC asynchronous API OS abstraction
+* layer: the queue lock is a mutex, and the worker blocks on a condition
+* variable associated with it.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSDIDAC_ASYNC_PTHREAD_H)
+#define CY_CSDIDAC_ASYNC_PTHREAD_H
+
+#include <pthread.h>
+#include "cy_csdidac_async.h"
+
+/* The OS objects passed to the OS abstraction layer functions as osParam */
+typedef struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+} cy_stc_csdidac_async_pthread_t;
+
+static inline void Cy_CSDIDAC_AsyncPthreadLock(void * osParam)
+{
+    (void)pthread_mutex_lock(&((cy_stc_csdidac_async_pthread_t *)osParam)->mutex);
+}
+
+static inline void Cy_CSDIDAC_AsyncPthreadUnlock(void * osParam)
+{
+    (void)pthread_mutex_unlock(&((cy_stc_csdidac_async_pthread_t *)osParam)->mutex);
+}
+
+static inline void Cy_CSDIDAC_AsyncPthreadSignal(void * osParam)
+{
+    (void)pthread_cond_signal(&((cy_stc_csdidac_async_pthread_t *)osParam)->cond);
+}
+
+/* Called with the mutex locked: unlocks it while blocked */
+static inline void Cy_CSDIDAC_AsyncPthreadWait(void * osParam)
+{
+    cy_stc_csdidac_async_pthread_t * ptrPthread = (cy_stc_csdidac_async_pthread_t *)osParam;
+
+    (void)pthread_cond_wait(&ptrPthread->cond, &ptrPthread->mutex);
+}
+
+/* Initializes the OS objects and fills the OS abstraction layer structure */
+static inline void Cy_CSDIDAC_AsyncPthreadInit(cy_stc_csdidac_async_pthread_t * ptrPthread,
+                                               cy_stc_csdidac_async_os_t * os)
+{
+    (void)pthread_mutex_init(&ptrPthread->mutex, NULL);
+    (void)pthread_cond_init(&ptrPthread->cond, NULL);
+    os->ptrLockFunc = &Cy_CSDIDAC_AsyncPthreadLock;
+    os->ptrUnlockFunc = &Cy_CSDIDAC_AsyncPthreadUnlock;
+    os->ptrSignalFunc = &Cy_CSDIDAC_AsyncPthreadSignal;
+    os->ptrWaitFunc = &Cy_CSDIDAC_AsyncPthreadWait;
+    os->osParam = ptrPthread;
+}
+
+static inline void Cy_CSDIDAC_AsyncPthreadDeInit(cy_stc_csdidac_async_pthread_t * ptrPthread)
+{
+    (void)pthread_cond_destroy(&ptrPthread->cond);
+    (void)pthread_mutex_destroy(&ptrPthread->mutex);
+}
+
+#endif /* CY_CSDIDAC_ASYNC_PTHREAD_H */
+
+
+/* [] END OF FILE */
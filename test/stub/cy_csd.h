@@ -0,0 +1,136 @@
+/***************************************************************************//**
+* \file cy_csd.h
+*
+* \brief
+* The host stub of the CSD driver. The CSD HW block is a register file with
+* the write counter and the write hook used by the host tests to observe
+* the intermediate register states.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_CSD_H)
+#define CY_CSD_H
+
+#include "cy_device_headers.h"
+#include "cy_syslib.h"
+#include "cy_syspm.h"
+
+typedef enum
+{
+    CY_CSD_NONE_KEY         = 0,
+    CY_CSD_USER_DEFINED_KEY = 1,
+    CY_CSD_CAPSENSE_KEY     = 2,
+    CY_CSD_ADC_KEY          = 3,
+    CY_CSD_IDAC_KEY         = 4,
+    CY_CSD_CMP_KEY          = 5,
+} cy_en_csd_key_t;
+
+typedef enum
+{
+    CY_CSD_SUCCESS   = 0,
+    CY_CSD_BAD_PARAM = 1,
+    CY_CSD_LOCKED    = 2,
+    CY_CSD_BUSY      = 3,
+} cy_en_csd_status_t;
+
+typedef struct
+{
+    cy_en_csd_key_t lockKey;
+} cy_stc_csd_context_t;
+
+typedef struct
+{
+    uint32_t config;
+    uint32_t spare;
+    uint32_t status;
+    uint32_t statSeq;
+    uint32_t statCnts;
+    uint32_t statHcnt;
+    uint32_t resultVal1;
+    uint32_t resultVal2;
+    uint32_t adcRes;
+    uint32_t intr;
+    uint32_t intrSet;
+    uint32_t intrMask;
+    uint32_t intrMasked;
+    uint32_t hscmp;
+    uint32_t ambuf;
+    uint32_t refgen;
+    uint32_t csdCmp;
+    uint32_t swRes;
+    uint32_t sensePeriod;
+    uint32_t senseDuty;
+    uint32_t swHsPosSel;
+    uint32_t swHsNegSel;
+    uint32_t swShieldSel;
+    uint32_t swAmuxbufSel;
+    uint32_t swBypSel;
+    uint32_t swCmpPosSel;
+    uint32_t swCmpNegSel;
+    uint32_t swRefgenSel;
+    uint32_t swFwModSel;
+    uint32_t swFwTankSel;
+    uint32_t swDsiSel;
+    uint32_t ioSel;
+    uint32_t seqTime;
+    uint32_t seqInitCnt;
+    uint32_t seqNormCnt;
+    uint32_t adcCtl;
+    uint32_t seqStart;
+    uint32_t idacA;
+    uint32_t idacB;
+} cy_stc_csd_config_t;
+
+#define CY_CSD_REG_OFFSET_CONFIG                (0x00u)
+#define CY_CSD_REG_OFFSET_INTR_MASK             (0x04u)
+#define CY_CSD_REG_OFFSET_SW_BYP_SEL            (0x08u)
+#define CY_CSD_REG_OFFSET_SW_REFGEN_SEL         (0x0Cu)
+#define CY_CSD_REG_OFFSET_SEQ_START             (0x10u)
+#define CY_CSD_REG_OFFSET_IDACA                 (0x14u)
+#define CY_CSD_REG_OFFSET_IDACB                 (0x18u)
+
+__STATIC_INLINE void Cy_CSD_WriteReg(CSD_Type * base, uint32_t offset, uint32_t value)
+{
+    base->reg[offset >> 2u] = value;
+    cy_stub_cycles++;
+    cy_stub_csdWrites++;
+    if (NULL != cy_stub_csdWriteHook)
+    {
+        cy_stub_csdWriteHook(base, offset, value);
+    }
+}
+
+__STATIC_INLINE uint32_t Cy_CSD_ReadReg(const CSD_Type * base, uint32_t offset)
+{
+    cy_stub_cycles++;
+    return (base->reg[offset >> 2u]);
+}
+
+__STATIC_INLINE void Cy_CSD_SetBits(CSD_Type * base, uint32_t offset, uint32_t mask)
+{
+    cy_stub_cycles++;
+    Cy_CSD_WriteReg(base, offset, base->reg[offset >> 2u] | mask);
+}
+
+__STATIC_INLINE void Cy_CSD_ClrBits(CSD_Type * base, uint32_t offset, uint32_t mask)
+{
+    cy_stub_cycles++;
+    Cy_CSD_WriteReg(base, offset, base->reg[offset >> 2u] & ~mask);
+}
+
+cy_en_csd_key_t Cy_CSD_GetLockStatus(const CSD_Type * base, const cy_stc_csd_context_t * context);
+cy_en_csd_status_t Cy_CSD_GetConversionStatus(const CSD_Type * base, const cy_stc_csd_context_t * context);
+cy_en_csd_status_t Cy_CSD_Init(CSD_Type * base, cy_stc_csd_config_t const * config, cy_en_csd_key_t key,
+                               cy_stc_csd_context_t * context);
+cy_en_csd_status_t Cy_CSD_DeInit(const CSD_Type * base, cy_en_csd_key_t key, cy_stc_csd_context_t * context);
+
+#endif /* CY_CSD_H */
+
+
+/* [] END OF FILE */
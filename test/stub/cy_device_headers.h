@@ -0,0 +1,77 @@
+/***************************************************************************//**
+* \file cy_device_headers.h
+*
+* \brief
+* The host stub of the device header for the CSDIDAC middleware host tests.
+* It defines the CSD HW block and the GPIO port as plain register files and
+* declares the counters of the simulated register accesses.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_DEVICE_HEADERS_H)
+#define CY_DEVICE_HEADERS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define CY_IP_M0S8CSDV2                         (1u)
+
+#define __STATIC_INLINE                         static inline
+
+#define CY_PDL_DRV_ID(id)                       ((uint32_t)((uint32_t)((id) & 0xFFFFUL) << 16U))
+#define CY_PDL_STATUS_ERROR                     (2UL << 24U)
+
+#define CY_ASSERT_L1(x)                         ((void)0)
+#define CY_ASSERT_L2(x)                         ((void)0)
+#define CY_ASSERT_L3(x)                         ((void)0)
+
+/* The CSD HW block register file */
+#define CY_STUB_CSD_REG_NUM                     (64u)
+typedef struct
+{
+    volatile uint32_t reg[CY_STUB_CSD_REG_NUM];
+} CSD_Type;
+
+/* The GPIO port: 4 bits of the drive mode and 4 bits of HSIOM per pin */
+typedef struct
+{
+    volatile uint32_t PC;
+    volatile uint32_t HSIOM;
+} GPIO_PRT_Type;
+
+typedef enum
+{
+    HSIOM_SEL_GPIO  = 0,
+    HSIOM_SEL_AMUXA = 6,
+    HSIOM_SEL_AMUXB = 7,
+} en_hsiom_sel_t;
+
+#define CY_GPIO_DM_ANALOG                       (0x00u)
+#define CY_GPIO_DM_HIGHZ                        (0x08u)
+#define CY_GPIO_DM_STRONG_IN_OFF                (0x06u)
+
+/* The simulated register access counters, the interrupt mask state, and the busy-wait delays */
+extern volatile uint32_t cy_stub_cycles;
+extern volatile uint32_t cy_stub_timestamp;
+extern uint32_t cy_stub_csdWrites;
+extern uint32_t cy_stub_gpioWrites;
+extern uint32_t cy_stub_gpioWritesUnmasked;
+extern bool cy_stub_intrMasked;
+extern uint32_t cy_stub_delayUs;
+extern uint32_t cy_stub_delays;
+extern void (*cy_stub_csdWriteHook)(const CSD_Type * base, uint32_t offset, uint32_t value);
+extern void (*cy_stub_gpioWriteHook)(void);
+
+void cy_stub_reset(void);
+
+#endif /* CY_DEVICE_HEADERS_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,65 @@
+/***************************************************************************//**
+* \file cy_gpio.h
+*
+* \brief
+* The host stub of the GPIO driver. The drive mode and HSIOM updates are
+* read-modify-writes of the port registers as on the device.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_GPIO_H)
+#define CY_GPIO_H
+
+#include "cy_device_headers.h"
+
+#define CY_STUB_GPIO_FIELD_POS(pinNum)          ((pinNum) * 4u)
+#define CY_STUB_GPIO_FIELD_MSK                  (0x0Fu)
+
+__STATIC_INLINE void Cy_STUB_GpioWrite(volatile uint32_t * reg, uint32_t pinNum, uint32_t value)
+{
+    *reg = (*reg & ~(CY_STUB_GPIO_FIELD_MSK << CY_STUB_GPIO_FIELD_POS(pinNum))) |
+           ((value & CY_STUB_GPIO_FIELD_MSK) << CY_STUB_GPIO_FIELD_POS(pinNum));
+    cy_stub_cycles += 3u;
+    cy_stub_gpioWrites++;
+    if (false == cy_stub_intrMasked)
+    {
+        cy_stub_gpioWritesUnmasked++;
+    }
+    if (NULL != cy_stub_gpioWriteHook)
+    {
+        cy_stub_gpioWriteHook();
+    }
+}
+
+__STATIC_INLINE void Cy_GPIO_SetDrivemode(GPIO_PRT_Type * base, uint32_t pinNum, uint32_t value)
+{
+    Cy_STUB_GpioWrite(&base->PC, pinNum, value);
+}
+
+__STATIC_INLINE uint32_t Cy_GPIO_GetDrivemode(GPIO_PRT_Type * base, uint32_t pinNum)
+{
+    cy_stub_cycles++;
+    return ((base->PC >> CY_STUB_GPIO_FIELD_POS(pinNum)) & CY_STUB_GPIO_FIELD_MSK);
+}
+
+__STATIC_INLINE void Cy_GPIO_SetHSIOM(GPIO_PRT_Type * base, uint32_t pinNum, en_hsiom_sel_t value)
+{
+    Cy_STUB_GpioWrite(&base->HSIOM, pinNum, (uint32_t)value);
+}
+
+__STATIC_INLINE en_hsiom_sel_t Cy_GPIO_GetHSIOM(GPIO_PRT_Type * base, uint32_t pinNum)
+{
+    cy_stub_cycles++;
+    return ((en_hsiom_sel_t)((base->HSIOM >> CY_STUB_GPIO_FIELD_POS(pinNum)) & CY_STUB_GPIO_FIELD_MSK));
+}
+
+#endif /* CY_GPIO_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,98 @@
+/***************************************************************************//**
+* \file cy_stub.c
+*
+* \brief
+* The host stub implementation of the CSD driver functions and the simulated
+* register access counters.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "cy_device_headers.h"
+#include "cy_csd.h"
+
+volatile uint32_t cy_stub_cycles;
+volatile uint32_t cy_stub_timestamp;
+uint32_t cy_stub_csdWrites;
+uint32_t cy_stub_gpioWrites;
+uint32_t cy_stub_gpioWritesUnmasked;
+bool cy_stub_intrMasked;
+uint32_t cy_stub_delayUs;
+uint32_t cy_stub_delays;
+void (*cy_stub_csdWriteHook)(const CSD_Type * base, uint32_t offset, uint32_t value);
+void (*cy_stub_gpioWriteHook)(void);
+
+
+void cy_stub_reset(void)
+{
+    cy_stub_cycles = 0u;
+    cy_stub_timestamp = 0u;
+    cy_stub_csdWrites = 0u;
+    cy_stub_gpioWrites = 0u;
+    cy_stub_gpioWritesUnmasked = 0u;
+    cy_stub_intrMasked = false;
+    cy_stub_delayUs = 0u;
+    cy_stub_delays = 0u;
+    cy_stub_csdWriteHook = NULL;
+    cy_stub_gpioWriteHook = NULL;
+}
+
+
+cy_en_csd_key_t Cy_CSD_GetLockStatus(const CSD_Type * base, const cy_stc_csd_context_t * context)
+{
+    (void)base;
+    return (context->lockKey);
+}
+
+
+cy_en_csd_status_t Cy_CSD_GetConversionStatus(const CSD_Type * base, const cy_stc_csd_context_t * context)
+{
+    (void)base;
+    (void)context;
+    return (CY_CSD_SUCCESS);
+}
+
+
+cy_en_csd_status_t Cy_CSD_Init(CSD_Type * base, cy_stc_csd_config_t const * config, cy_en_csd_key_t key,
+                               cy_stc_csd_context_t * context)
+{
+    cy_en_csd_status_t status = CY_CSD_LOCKED;
+
+    if (CY_CSD_NONE_KEY == context->lockKey)
+    {
+        context->lockKey = key;
+        Cy_CSD_WriteReg(base, CY_CSD_REG_OFFSET_CONFIG, config->config);
+        Cy_CSD_WriteReg(base, CY_CSD_REG_OFFSET_INTR_MASK, config->intrMask);
+        Cy_CSD_WriteReg(base, CY_CSD_REG_OFFSET_SW_BYP_SEL, config->swBypSel);
+        Cy_CSD_WriteReg(base, CY_CSD_REG_OFFSET_SW_REFGEN_SEL, config->swRefgenSel);
+        Cy_CSD_WriteReg(base, CY_CSD_REG_OFFSET_SEQ_START, config->seqStart);
+        Cy_CSD_WriteReg(base, CY_CSD_REG_OFFSET_IDACA, config->idacA);
+        Cy_CSD_WriteReg(base, CY_CSD_REG_OFFSET_IDACB, config->idacB);
+        status = CY_CSD_SUCCESS;
+    }
+
+    return (status);
+}
+
+
+cy_en_csd_status_t Cy_CSD_DeInit(const CSD_Type * base, cy_en_csd_key_t key, cy_stc_csd_context_t * context)
+{
+    cy_en_csd_status_t status = CY_CSD_LOCKED;
+
+    (void)base;
+    if (key == context->lockKey)
+    {
+        context->lockKey = CY_CSD_NONE_KEY;
+        status = CY_CSD_SUCCESS;
+    }
+
+    return (status);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,45 @@
+/***************************************************************************//**
+* \file cy_syslib.h
+*
+* \brief
+* The host stub of the system library. The critical section only records
+* the interrupt mask state.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_SYSLIB_H)
+#define CY_SYSLIB_H
+
+#include "cy_device_headers.h"
+
+__STATIC_INLINE uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    uint32_t savedIntrStatus = (true == cy_stub_intrMasked) ? 1u : 0u;
+
+    cy_stub_intrMasked = true;
+    cy_stub_cycles++;
+    return (savedIntrStatus);
+}
+
+__STATIC_INLINE void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus)
+{
+    cy_stub_cycles++;
+    cy_stub_intrMasked = (0u != savedIntrStatus);
+}
+
+__STATIC_INLINE void Cy_SysLib_DelayUs(uint16_t microseconds)
+{
+    cy_stub_delayUs += microseconds;
+    cy_stub_delays++;
+}
+
+#endif /* CY_SYSLIB_H */
+
+
+/* [] END OF FILE */
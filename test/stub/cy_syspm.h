@@ -0,0 +1,43 @@
+/***************************************************************************//**
+* \file cy_syspm.h
+*
+* \brief
+* The host stub of the power management driver.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(CY_SYSPM_H)
+#define CY_SYSPM_H
+
+#include "cy_device_headers.h"
+
+typedef enum
+{
+    CY_SYSPM_SUCCESS = 0,
+    CY_SYSPM_FAIL    = 1,
+} cy_en_syspm_status_t;
+
+typedef enum
+{
+    CY_SYSPM_CHECK_READY        = 0x01u,
+    CY_SYSPM_CHECK_FAIL         = 0x02u,
+    CY_SYSPM_BEFORE_TRANSITION  = 0x04u,
+    CY_SYSPM_AFTER_TRANSITION   = 0x08u,
+} cy_en_syspm_callback_mode_t;
+
+typedef struct
+{
+    void * base;
+    void * context;
+} cy_stc_syspm_callback_params_t;
+
+#endif /* CY_SYSPM_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,262 @@
+/***************************************************************************//**
+* \file test_arb.c
+*
+* \brief
+* The host test of the multi-client setpoint arbitration: the effective
+* setpoint of each policy against a brute-force reference over a random
+* request sequence, the IDAC register write on change only, and the requests
+* of the concurrent POSIX threads serialized by the critical section of
+* the hardware-access backend.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include <pthread.h>
+#include "test_common.h"
+#include "cy_csdidac_arb.h"
+
+#define TEST_SEQUENCE_LEN                       (300000u)
+#define TEST_THREAD_REQUESTS                    (200000u)
+#define TEST_POLICY_NUM                         (3u)
+
+/* The setpoint of one client as seen by its owner */
+typedef struct
+{
+    uint32_t client;
+    uint32_t seed;
+    int32_t current;
+    bool active;
+} test_client_t;
+
+static const char * const test_policyNames[TEST_POLICY_NUM] = {"priority", "max", "sum"};
+
+static cy_stc_csdidac_backend_t test_backend;
+static pthread_mutex_t test_mutex;
+static cy_stc_csdidac_arb_t test_arb;
+static test_client_t test_clients[CY_CSDIDAC_ARB_MAX_CLIENTS];
+
+/* The critical section of the threads: the recursive mutex */
+static uint32_t test_enterCriticalSection(void * param)
+{
+    (void)param;
+    (void)pthread_mutex_lock(&test_mutex);
+
+    return (0u);
+}
+
+static void test_exitCriticalSection(void * param, uint32_t savedIntrStatus)
+{
+    (void)param;
+    (void)savedIntrStatus;
+    (void)pthread_mutex_unlock(&test_mutex);
+}
+
+static uint32_t test_random(uint32_t * seed)
+{
+    *seed = (*seed * 1664525u) + 1013904223u;
+
+    return (*seed);
+}
+
+/* Requests or releases a random setpoint of the client */
+static void test_step(test_client_t * client)
+{
+    uint32_t r = test_random(&client->seed);
+    int32_t current = (int32_t)((r >> 8u) % (CY_CSDIDAC_MAX_CURRENT_NA + 1u));
+
+    if (0u == ((r >> 4u) % 5u))
+    {
+        TEST_CHECK_STATUS(Cy_CSDIDAC_ArbRelease(client->client, &test_arb));
+        client->current = 0;
+        client->active = false;
+    }
+    else
+    {
+        client->current = (0u != (r & 1u)) ? -current : current;
+        TEST_CHECK_STATUS(Cy_CSDIDAC_ArbRequest(client->client, client->current, &test_arb));
+        client->active = true;
+    }
+}
+
+/* The brute-force effective setpoint: ties of the magnitude are won by the higher priority */
+static int32_t test_reference(cy_en_csdidac_arb_policy_t policy)
+{
+    int64_t sum = 0;
+    int32_t effective = 0;
+    uint32_t maxMagnitude = 0u;
+    uint32_t magnitude;
+    uint32_t i;
+
+    for (i = 0u; i < CY_CSDIDAC_ARB_MAX_CLIENTS; i++)
+    {
+        if (true == test_clients[i].active)
+        {
+            magnitude = (uint32_t)abs(test_clients[i].current);
+            sum += test_clients[i].current;
+            if ((CY_CSDIDAC_ARB_PRIORITY == policy) || ((CY_CSDIDAC_ARB_MAX == policy) && (magnitude >= maxMagnitude)))
+            {
+                effective = test_clients[i].current;
+                maxMagnitude = magnitude;
+            }
+        }
+    }
+    if (CY_CSDIDAC_ARB_SUM == policy)
+    {
+        sum = ((int64_t)CY_CSDIDAC_MAX_CURRENT_NA < sum) ? (int64_t)CY_CSDIDAC_MAX_CURRENT_NA : sum;
+        sum = (-(int64_t)CY_CSDIDAC_MAX_CURRENT_NA > sum) ? -(int64_t)CY_CSDIDAC_MAX_CURRENT_NA : sum;
+        effective = (int32_t)sum;
+    }
+
+    return (effective);
+}
+
+/* Returns the IDAC register value of the current */
+static uint32_t test_regValue(int32_t current)
+{
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t code;
+
+    Cy_CSDIDAC_ConvertCurrent(current, &polarity, &lsbIndex, &code);
+
+    return (Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, code));
+}
+
+static void * test_clientThread(void * param)
+{
+    test_client_t * client = (test_client_t *)param;
+    uint32_t i;
+
+    for (i = 0u; i < TEST_THREAD_REQUESTS; i++)
+    {
+        test_step(client);
+    }
+
+    return (NULL);
+}
+
+static void test_policy(cy_en_csdidac_arb_policy_t policy)
+{
+    pthread_t threads[CY_CSDIDAC_ARB_MAX_CLIENTS];
+    uint32_t seed = (uint32_t)policy + 5u;
+    uint32_t writes;
+    uint64_t startNs;
+    uint64_t contendedNs;
+    uint64_t singleNs;
+    uint32_t i;
+
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ArbInit(CY_CSDIDAC_A, policy, &test_arb, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ArbRegister(CY_CSDIDAC_ARB_MAX_CLIENTS, &test_arb));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ArbRequest(1u, 5, &test_arb));
+    for (i = 0u; i < CY_CSDIDAC_ARB_MAX_CLIENTS; i++)
+    {
+        TEST_CHECK_STATUS(Cy_CSDIDAC_ArbRegister(i, &test_arb));
+        (void)memset(&test_clients[i], 0, sizeof(test_clients[i]));
+        test_clients[i].client = i;
+        test_clients[i].seed = (i * 7919u) + 1u;
+    }
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ArbRegister(3u, &test_arb));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ArbRequest(1u, (int32_t)CY_CSDIDAC_MAX_CURRENT_NA + 1, &test_arb));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ArbRequest(1u, INT32_MIN, &test_arb));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ArbStart(&test_arb));
+    TEST_CHECK(CY_CSDIDAC_ENABLE == test_context.channelStateA);
+
+    /* The random sequence of one thread: each effective setpoint and register against the reference */
+    for (i = 0u; i < TEST_SEQUENCE_LEN; i++)
+    {
+        test_step(&test_clients[(test_random(&seed) >> 28u) % CY_CSDIDAC_ARB_MAX_CLIENTS]);
+        TEST_CHECK(test_reference(policy) == Cy_CSDIDAC_ArbGetEffective(&test_arb));
+        TEST_CHECK(test_regValue(Cy_CSDIDAC_ArbGetEffective(&test_arb)) == TEST_IDACA);
+    }
+
+    /* The concurrent clients: the final state of the owners against the reference */
+    startNs = test_timeNs();
+    for (i = 0u; i < CY_CSDIDAC_ARB_MAX_CLIENTS; i++)
+    {
+        TEST_CHECK(0 == pthread_create(&threads[i], NULL, &test_clientThread, &test_clients[i]));
+    }
+    for (i = 0u; i < CY_CSDIDAC_ARB_MAX_CLIENTS; i++)
+    {
+        (void)pthread_join(threads[i], NULL);
+    }
+    contendedNs = test_timeNs() - startNs;
+    TEST_CHECK(test_reference(policy) == Cy_CSDIDAC_ArbGetEffective(&test_arb));
+    TEST_CHECK(test_regValue(Cy_CSDIDAC_ArbGetEffective(&test_arb)) == TEST_IDACA);
+    TEST_CHECK(TEST_IDACA == test_context.idacRegValueA);
+
+    /* The same setpoint again does not write the register */
+    writes = cy_stub_csdWrites;
+    for (i = 0u; i < CY_CSDIDAC_ARB_MAX_CLIENTS; i++)
+    {
+        if (true == test_clients[i].active)
+        {
+            TEST_CHECK_STATUS(Cy_CSDIDAC_ArbRequest(i, test_clients[i].current, &test_arb));
+        }
+        else
+        {
+            TEST_CHECK_STATUS(Cy_CSDIDAC_ArbRelease(i, &test_arb));
+        }
+    }
+    TEST_CHECK(writes == cy_stub_csdWrites);
+
+    /* The uncontended update cost */
+    startNs = test_timeNs();
+    for (i = 0u; i < TEST_THREAD_REQUESTS; i++)
+    {
+        test_step(&test_clients[i % CY_CSDIDAC_ARB_MAX_CLIENTS]);
+    }
+    singleNs = test_timeNs() - startNs;
+    (void)printf("%-8s %u threads: %6.1f ns per update, one thread: %6.1f ns per update\n",
+                 test_policyNames[policy], (unsigned)CY_CSDIDAC_ARB_MAX_CLIENTS,
+                 (double)contendedNs / (double)(CY_CSDIDAC_ARB_MAX_CLIENTS * TEST_THREAD_REQUESTS),
+                 (double)singleNs / (double)TEST_THREAD_REQUESTS);
+
+    /* The unregistered clients release the output */
+    for (i = 0u; i < CY_CSDIDAC_ARB_MAX_CLIENTS; i++)
+    {
+        TEST_CHECK_STATUS(Cy_CSDIDAC_ArbUnregister(i, &test_arb));
+    }
+    TEST_CHECK(0 == Cy_CSDIDAC_ArbGetEffective(&test_arb));
+    TEST_CHECK(0u == (TEST_IDACA & CY_CSDIDAC_MAX_CODE));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ArbRequest(0u, 1000, &test_arb));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ArbStop(&test_arb));
+    TEST_CHECK(CY_CSDIDAC_DISABLE == test_context.channelStateA);
+}
+
+int main(void)
+{
+    pthread_mutexattr_t attr;
+    uint32_t policy;
+
+    (void)pthread_mutexattr_init(&attr);
+    (void)pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    (void)pthread_mutex_init(&test_mutex, &attr);
+    test_backend = cy_csdidac_backendPdl;
+    test_backend.enterCriticalSection = &test_enterCriticalSection;
+    test_backend.exitCriticalSection = &test_exitCriticalSection;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_GPIO));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_DeInit(&test_context));
+    test_config.ptrBackend = &test_backend;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_Init(&test_config, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ArbInit(CY_CSDIDAC_AB, CY_CSDIDAC_ARB_SUM, &test_arb, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ArbInit(CY_CSDIDAC_A, (cy_en_csdidac_arb_policy_t)TEST_POLICY_NUM,
+                                                          &test_arb, &test_context));
+
+    for (policy = 0u; policy < TEST_POLICY_NUM; policy++)
+    {
+        test_policy((cy_en_csdidac_arb_policy_t)policy);
+    }
+    (void)pthread_mutex_destroy(&test_mutex);
+    (void)pthread_mutexattr_destroy(&attr);
+
+    return (TEST_RESULT("test_arb"));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,192 @@
+/***************************************************************************//**
+* \file test_async.c
+*
+* \brief
+* The host test of the asynchronous request API with the POSIX threads port:
+* the request validation, the asynchronous initialization, and
+* the producer/consumer benchmark of several submitting threads and one
+* worker. A lost wake-up stalls the worker and fails the test by timeout.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include <sched.h>
+#include "test_common.h"
+#include "cy_csdidac_async_pthread.h"
+
+#define TEST_PRODUCERS                          (4u)
+#define TEST_REQUESTS                           (50000u)
+#define TEST_TIMEOUT_NS                         (20000000000uLL)
+
+static cy_stc_csdidac_async_pthread_t test_pthread;
+static cy_stc_csdidac_async_t test_async;
+
+/* The completion counters updated by the worker */
+static pthread_mutex_t test_doneMutex = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t test_done;
+static uint32_t test_errors;
+
+/* The submit statistics of each producer */
+typedef struct
+{
+    uint32_t index;
+    uint32_t retries;
+    uint64_t submitNs;
+} test_producer_t;
+
+static void test_callback(cy_en_csdidac_status_t status, void * param)
+{
+    (void)param;
+    (void)pthread_mutex_lock(&test_doneMutex);
+    test_done++;
+    if (CY_CSDIDAC_SUCCESS != status)
+    {
+        test_errors++;
+    }
+    (void)pthread_mutex_unlock(&test_doneMutex);
+}
+
+static uint32_t test_getDone(void)
+{
+    uint32_t done;
+
+    (void)pthread_mutex_lock(&test_doneMutex);
+    done = test_done;
+    (void)pthread_mutex_unlock(&test_doneMutex);
+
+    return (done);
+}
+
+/* Waits for the completions and returns false on the timeout */
+static bool test_waitDone(uint32_t count)
+{
+    uint64_t start = test_timeNs();
+    struct timespec pause = {0, 100000};
+
+    while ((test_getDone() < count) && ((test_timeNs() - start) < TEST_TIMEOUT_NS))
+    {
+        (void)nanosleep(&pause, NULL);
+    }
+
+    return (test_getDone() >= count);
+}
+
+static void * test_worker(void * param)
+{
+    (void)param;
+    Cy_CSDIDAC_AsyncRun(&test_async);
+
+    return (NULL);
+}
+
+static void * test_producerThread(void * param)
+{
+    test_producer_t * producer = (test_producer_t *)param;
+    cy_stc_csdidac_async_request_t request;
+    cy_en_csdidac_status_t status;
+    uint64_t start;
+    uint32_t i;
+
+    (void)memset(&request, 0, sizeof(request));
+    request.op = CY_CSDIDAC_ASYNC_SET;
+    request.ch = (0u == (producer->index & 1u)) ? CY_CSDIDAC_A : CY_CSDIDAC_B;
+    request.ptrCallback = &test_callback;
+    for (i = 0u; i < TEST_REQUESTS; i++)
+    {
+        request.current = (int32_t)((i * 7919u) % CY_CSDIDAC_MAX_CURRENT_NA) - (int32_t)(CY_CSDIDAC_MAX_CURRENT_NA / 2u);
+        start = test_timeNs();
+        status = Cy_CSDIDAC_AsyncSubmit(&request, &test_async);
+        producer->submitNs += test_timeNs() - start;
+        while (CY_CSDIDAC_HW_BUSY == status)
+        {
+            producer->retries++;
+            (void)sched_yield();
+            status = Cy_CSDIDAC_AsyncSubmit(&request, &test_async);
+        }
+    }
+
+    return (NULL);
+}
+
+int main(void)
+{
+    cy_stc_csdidac_async_os_t os;
+    cy_stc_csdidac_async_request_t request;
+    test_producer_t producers[TEST_PRODUCERS];
+    pthread_t producerThreads[TEST_PRODUCERS];
+    pthread_t workerThread;
+    uint64_t submitNs = 0u;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t retries = 0u;
+    uint32_t i;
+
+    /* The middleware is initialized by the worker */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_GPIO));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_DeInit(&test_context));
+    Cy_CSDIDAC_AsyncPthreadInit(&test_pthread, &os);
+    TEST_CHECK_STATUS(Cy_CSDIDAC_AsyncInit(&os, &test_async, &test_context));
+
+    /* The request validation */
+    (void)memset(&request, 0, sizeof(request));
+    request.op = CY_CSDIDAC_ASYNC_SET;
+    request.ch = CY_CSDIDAC_A;
+    request.current = INT32_MIN;
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_AsyncSubmit(&request, &test_async));
+    request.current = -(int32_t)CY_CSDIDAC_MAX_CURRENT_NA - 1;
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_AsyncSubmit(&request, &test_async));
+    request.op = CY_CSDIDAC_ASYNC_INIT;
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_AsyncSubmit(&request, &test_async));
+    request.op = (cy_en_csdidac_async_op_t)(CY_CSDIDAC_ASYNC_INIT + 1u);
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_AsyncSubmit(&request, &test_async));
+
+    TEST_CHECK(0 == pthread_create(&workerThread, NULL, &test_worker, NULL));
+    request.op = CY_CSDIDAC_ASYNC_INIT;
+    request.ptrConfig = &test_config;
+    request.ptrCallback = &test_callback;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_AsyncSubmit(&request, &test_async));
+    TEST_CHECK(true == test_waitDone(1u));
+    TEST_CHECK(0u == test_errors);
+
+    /* The producer/consumer benchmark */
+    start = test_timeNs();
+    for (i = 0u; i < TEST_PRODUCERS; i++)
+    {
+        (void)memset(&producers[i], 0, sizeof(producers[i]));
+        producers[i].index = i;
+        TEST_CHECK(0 == pthread_create(&producerThreads[i], NULL, &test_producerThread, &producers[i]));
+    }
+    for (i = 0u; i < TEST_PRODUCERS; i++)
+    {
+        (void)pthread_join(producerThreads[i], NULL);
+        submitNs += producers[i].submitNs;
+        retries += producers[i].retries;
+    }
+    TEST_CHECK(true == test_waitDone(1u + (TEST_PRODUCERS * TEST_REQUESTS)));
+    elapsed = test_timeNs() - start;
+    TEST_CHECK(0u == test_errors);
+    (void)printf("%u producers x %u requests: %.0f requests/s, %.1f ns per submit, %u full-queue retries\n",
+                 (unsigned)TEST_PRODUCERS, (unsigned)TEST_REQUESTS,
+                 ((double)(TEST_PRODUCERS * TEST_REQUESTS) * 1e9) / (double)elapsed,
+                 (double)submitNs / (double)(TEST_PRODUCERS * TEST_REQUESTS), (unsigned)retries);
+
+    /* The stop returns the worker after the queued requests */
+    request.op = CY_CSDIDAC_ASYNC_RELEASE;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_AsyncSubmit(&request, &test_async));
+    Cy_CSDIDAC_AsyncStop(&test_async);
+    TEST_CHECK(true == test_waitDone(2u + (TEST_PRODUCERS * TEST_REQUESTS)));
+    if (0u == test_failures)
+    {
+        (void)pthread_join(workerThread, NULL);
+        TEST_CHECK(test_async.head == test_async.tail);
+        TEST_CHECK(CY_CSD_NONE_KEY == test_csdContext.lockKey);
+    }
+    Cy_CSDIDAC_AsyncPthreadDeInit(&test_pthread);
+
+    return (TEST_RESULT("test_async"));
+}
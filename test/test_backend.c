@@ -0,0 +1,215 @@
+/***************************************************************************//**
+* \file test_backend.c
+*
+* \brief
+* The host test of the pluggable hardware-access backend: the same operation
+* sequence run on the PDL backend over the register stubs and on the
+* in-memory backend must leave the same CSD HW block registers, pin
+* connections and lock owner after each step. The in-memory backend must not
+* touch the hardware, and must leave the critical sections balanced.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_gpio.h"
+#include "cy_csdidac_backend_mem.h"
+
+#define TEST_ROUNDS                             (100000u)
+
+/* The operations of the sequence */
+typedef enum
+{
+    TEST_OP_ENABLE,
+    TEST_OP_DISABLE,
+    TEST_OP_SAVE,
+    TEST_OP_RESTORE,
+} test_op_t;
+
+typedef struct
+{
+    test_op_t op;
+    cy_en_csdidac_choice_t ch;
+    int32_t current;
+} test_step_t;
+
+/* The observable hardware state after one step */
+typedef struct
+{
+    cy_en_csdidac_status_t status;
+    uint32_t idacA;
+    uint32_t idacB;
+    uint32_t swBypSel;
+    uint32_t swRefgenSel;
+    uint32_t hsiomA;
+    uint32_t hsiomB;
+    cy_en_csd_key_t lockKey;
+} test_state_t;
+
+static const test_step_t test_steps[] =
+{
+    {TEST_OP_ENABLE,  CY_CSDIDAC_A,  1000},
+    {TEST_OP_ENABLE,  CY_CSDIDAC_B,  -250000},
+    {TEST_OP_ENABLE,  CY_CSDIDAC_A,  -37},
+    {TEST_OP_ENABLE,  CY_CSDIDAC_AB, 600000},
+    {TEST_OP_DISABLE, CY_CSDIDAC_B,  0},
+    {TEST_OP_SAVE,    CY_CSDIDAC_A,  0},
+    {TEST_OP_ENABLE,  CY_CSDIDAC_A,  1000},
+    {TEST_OP_RESTORE, CY_CSDIDAC_A,  0},
+    {TEST_OP_RESTORE, CY_CSDIDAC_A,  0},
+    {TEST_OP_ENABLE,  CY_CSDIDAC_B,  9000},
+    {TEST_OP_DISABLE, CY_CSDIDAC_AB, 0},
+    {TEST_OP_ENABLE,  CY_CSDIDAC_A,  INT32_MIN},
+};
+
+#define TEST_STEP_NUM                           (sizeof(test_steps) / sizeof(test_steps[0u]))
+
+static cy_stc_csdidac_backend_mem_t test_mem;
+static test_state_t test_pdlStates[TEST_STEP_NUM];
+static test_state_t test_memStates[TEST_STEP_NUM];
+
+static cy_en_csdidac_status_t test_runStep(const test_step_t * step)
+{
+    cy_en_csdidac_status_t status;
+
+    switch (step->op)
+    {
+        case TEST_OP_ENABLE:
+            status = Cy_CSDIDAC_OutputEnable(step->ch, step->current, &test_context);
+            break;
+        case TEST_OP_DISABLE:
+            status = Cy_CSDIDAC_OutputDisable(step->ch, &test_context);
+            break;
+        case TEST_OP_SAVE:
+            status = Cy_CSDIDAC_Save(&test_context);
+            break;
+        default:
+            status = Cy_CSDIDAC_Restore(&test_context);
+            break;
+    }
+
+    return (status);
+}
+
+static uint32_t test_memHsiom(const cy_stc_csdidac_pin_t * pin)
+{
+    const cy_stc_csdidac_backend_mem_pin_t * ptrPin = Cy_CSDIDAC_BackendMemGetPin(pin->ioPcPtr, pin->pin, &test_mem);
+
+    return ((NULL != ptrPin) ? (uint32_t)ptrPin->hsiom : (uint32_t)HSIOM_SEL_GPIO);
+}
+
+/* Runs the sequence on the stubbed PDL */
+static void test_runPdl(cy_en_csdidac_channel_config_t configB)
+{
+    uint32_t i;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, configB));
+    TEST_CHECK(&cy_csdidac_backendPdl == test_context.cfgCopy.ptrBackend);
+    for (i = 0u; i < TEST_STEP_NUM; i++)
+    {
+        test_pdlStates[i].status = test_runStep(&test_steps[i]);
+        test_pdlStates[i].idacA = TEST_IDACA;
+        test_pdlStates[i].idacB = TEST_IDACB;
+        test_pdlStates[i].swBypSel = TEST_SW_BYP_SEL;
+        test_pdlStates[i].swRefgenSel = test_csd.reg[CY_CSD_REG_OFFSET_SW_REFGEN_SEL >> 2u];
+        test_pdlStates[i].hsiomA = (uint32_t)Cy_GPIO_GetHSIOM(test_pinA.ioPcPtr, test_pinA.pin);
+        test_pdlStates[i].hsiomB = (uint32_t)Cy_GPIO_GetHSIOM(test_pinB.ioPcPtr, test_pinB.pin);
+        test_pdlStates[i].lockKey = test_csdContext.lockKey;
+    }
+}
+
+/* Runs the sequence on the in-memory backend */
+static void test_runMem(cy_en_csdidac_channel_config_t configB)
+{
+    uint32_t i;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, configB));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_DeInit(&test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_BackendMemInit(NULL));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_BackendMemInit(&test_mem));
+    test_config.ptrBackend = &cy_csdidac_backendMem;
+    test_config.backendParam = &test_mem;
+    cy_stub_reset();
+    (void)memset((void *)&test_csd, 0, sizeof(test_csd));
+    (void)memset((void *)&test_port, 0, sizeof(test_port));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_Init(&test_config, &test_context));
+    for (i = 0u; i < TEST_STEP_NUM; i++)
+    {
+        test_memStates[i].status = test_runStep(&test_steps[i]);
+        test_memStates[i].idacA = Cy_CSDIDAC_BackendMemReadReg(CY_CSD_REG_OFFSET_IDACA, &test_mem);
+        test_memStates[i].idacB = Cy_CSDIDAC_BackendMemReadReg(CY_CSD_REG_OFFSET_IDACB, &test_mem);
+        test_memStates[i].swBypSel = Cy_CSDIDAC_BackendMemReadReg(CY_CSD_REG_OFFSET_SW_BYP_SEL, &test_mem);
+        test_memStates[i].swRefgenSel = Cy_CSDIDAC_BackendMemReadReg(CY_CSD_REG_OFFSET_SW_REFGEN_SEL, &test_mem);
+        test_memStates[i].hsiomA = test_memHsiom(&test_pinA);
+        test_memStates[i].hsiomB = test_memHsiom(&test_pinB);
+        test_memStates[i].lockKey = test_mem.lockKey;
+    }
+
+    /* The hardware is not accessed and the critical sections are balanced */
+    TEST_CHECK(0u == cy_stub_csdWrites);
+    TEST_CHECK(0u == cy_stub_gpioWrites);
+    TEST_CHECK(0u == test_port.HSIOM);
+    TEST_CHECK(CY_CSD_NONE_KEY == test_csdContext.lockKey);
+    TEST_CHECK(0u == test_mem.criticalDepth);
+    TEST_CHECK(0u != test_mem.writeCount);
+}
+
+static void test_compare(cy_en_csdidac_channel_config_t configB)
+{
+    uint32_t i;
+
+    test_runPdl(configB);
+    test_runMem(configB);
+    for (i = 0u; i < TEST_STEP_NUM; i++)
+    {
+        TEST_CHECK(test_pdlStates[i].status == test_memStates[i].status);
+        TEST_CHECK(test_pdlStates[i].idacA == test_memStates[i].idacA);
+        TEST_CHECK(test_pdlStates[i].idacB == test_memStates[i].idacB);
+        TEST_CHECK(test_pdlStates[i].swBypSel == test_memStates[i].swBypSel);
+        TEST_CHECK(test_pdlStates[i].swRefgenSel == test_memStates[i].swRefgenSel);
+        TEST_CHECK(test_pdlStates[i].hsiomA == test_memStates[i].hsiomA);
+        TEST_CHECK(test_pdlStates[i].hsiomB == test_memStates[i].hsiomB);
+        TEST_CHECK(test_pdlStates[i].lockKey == test_memStates[i].lockKey);
+    }
+    TEST_CHECK_STATUS(Cy_CSDIDAC_DeInit(&test_context));
+    TEST_CHECK(CY_CSD_NONE_KEY == test_mem.lockKey);
+}
+
+/* Returns the host time of one output enable in ns */
+static double test_enableNs(void)
+{
+    uint64_t startNs = test_timeNs();
+    uint32_t i;
+
+    for (i = 0u; i < TEST_ROUNDS; i++)
+    {
+        (void)Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, (int32_t)(i & 0xFFFFu), &test_context);
+    }
+
+    return ((double)(test_timeNs() - startNs) / (double)TEST_ROUNDS);
+}
+
+int main(void)
+{
+    double pdlNs;
+    double memNs;
+
+    test_compare(CY_CSDIDAC_AMUX);
+    test_compare(CY_CSDIDAC_JOIN);
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    pdlNs = test_enableNs();
+    test_runMem(CY_CSDIDAC_DISABLED);
+    memNs = test_enableNs();
+    (void)printf("OutputEnable: %.1f ns on the PDL backend, %.1f ns on the in-memory backend\n", pdlNs, memNs);
+
+    return (TEST_RESULT("test_backend"));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,145 @@
+/***************************************************************************//**
+* \file test_charge.c
+*
+* \brief
+* The host test of the per-channel charge accounting against an exact
+* 128-bit reference integrated from the IDAC register writes: random
+* output updates and disables over a timestamp wrap, the charge, the
+* on-time and the average current of the report, and the reset.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+
+#define TEST_UPDATES                            (100000u)
+#define TEST_START_TIMESTAMP                    (0xFFF00000u)
+
+/* The reference state of one channel: the charge in pA by ticks */
+typedef struct
+{
+    __int128 charge;
+    uint64_t onTime;
+    uint32_t regValue;
+    uint32_t timestamp;
+} test_reference_t;
+
+static test_reference_t test_refs[2u];
+static uint32_t test_seed = 0x1234567u;
+
+static uint32_t test_random(void)
+{
+    test_seed ^= test_seed << 13u;
+    test_seed ^= test_seed >> 17u;
+    test_seed ^= test_seed << 5u;
+    return (test_seed);
+}
+
+static void test_integrate(test_reference_t * ref)
+{
+    uint32_t elapsed = cy_stub_timestamp - ref->timestamp;
+
+    ref->charge += (__int128)test_regCurrentPa(ref->regValue) * (__int128)elapsed;
+    if (0u != (ref->regValue & CY_CSDIDAC_LEG1_EN_MASK))
+    {
+        ref->onTime += elapsed;
+    }
+    ref->timestamp = cy_stub_timestamp;
+}
+
+static void test_csdWriteHook(const CSD_Type * base, uint32_t offset, uint32_t value)
+{
+    (void)base;
+    if ((CY_CSD_REG_OFFSET_IDACA == offset) || (CY_CSD_REG_OFFSET_IDACB == offset))
+    {
+        test_reference_t * ref = &test_refs[(CY_CSD_REG_OFFSET_IDACA == offset) ? 0u : 1u];
+
+        test_integrate(ref);
+        ref->regValue = value;
+    }
+}
+
+static void test_resetReference(void)
+{
+    uint32_t i;
+
+    for (i = 0u; i < 2u; i++)
+    {
+        test_refs[i].charge = 0;
+        test_refs[i].onTime = 0u;
+        test_refs[i].timestamp = cy_stub_timestamp;
+    }
+    test_refs[0u].regValue = TEST_IDACA;
+    test_refs[1u].regValue = TEST_IDACB;
+}
+
+int main(void)
+{
+    cy_stc_csdidac_charge_report_t report;
+    cy_en_csdidac_choice_t ch;
+    test_reference_t * ref;
+    uint32_t random;
+    uint32_t i;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_AMUX));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_GetChargeReport(CY_CSDIDAC_AB, &report, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_GetChargeReport(CY_CSDIDAC_A, NULL, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ResetCharge(CY_CSDIDAC_A, NULL));
+
+    /* The accounting starts shortly before the timestamp wrap */
+    cy_stub_timestamp = TEST_START_TIMESTAMP;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ResetCharge(CY_CSDIDAC_AB, &test_context));
+    test_resetReference();
+    cy_stub_csdWriteHook = &test_csdWriteHook;
+    for (i = 0u; i < TEST_UPDATES; i++)
+    {
+        random = test_random();
+        ch = (0u == (random & 1u)) ? CY_CSDIDAC_A : CY_CSDIDAC_B;
+        cy_stub_timestamp += (random >> 12u) & 0xFFFu;
+        if (0u == ((random >> 1u) & 7u))
+        {
+            TEST_CHECK_STATUS(Cy_CSDIDAC_OutputDisable(ch, &test_context));
+        }
+        else
+        {
+            TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(ch, (int32_t)(test_random() % (2u * CY_CSDIDAC_MAX_CURRENT_NA)) -
+                                                          (int32_t)CY_CSDIDAC_MAX_CURRENT_NA, &test_context));
+        }
+    }
+    cy_stub_timestamp += 1000u;
+    cy_stub_csdWriteHook = NULL;
+    TEST_CHECK(cy_stub_timestamp < TEST_START_TIMESTAMP);
+
+    /* The report closes the open interval and equals the reference exactly */
+    for (i = 0u; i < 2u; i++)
+    {
+        ref = &test_refs[i];
+        test_integrate(ref);
+        TEST_CHECK_STATUS(Cy_CSDIDAC_GetChargeReport((0u == i) ? CY_CSDIDAC_A : CY_CSDIDAC_B, &report, &test_context));
+        TEST_CHECK(ref->charge == ((__int128)report.charge * (__int128)CY_CSDIDAC_CHARGE_UNIT_PA));
+        TEST_CHECK(ref->onTime == report.onTime);
+        TEST_CHECK((0u != report.onTime) && ((int32_t)(ref->charge / (__int128)ref->onTime) == report.averageCurrent));
+        (void)printf("channel %c: %.3e pA*ticks, on-time %llu ticks, average %d pA\n", (0u == i) ? 'A' : 'B',
+                     (double)report.charge * (double)CY_CSDIDAC_CHARGE_UNIT_PA,
+                     (unsigned long long)report.onTime, (int)report.averageCurrent);
+    }
+
+    /* The reset of one channel */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ResetCharge(CY_CSDIDAC_A, &test_context));
+    cy_stub_timestamp += 10u;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_GetChargeReport(CY_CSDIDAC_A, &report, &test_context));
+    TEST_CHECK(((0u != (TEST_IDACA & CY_CSDIDAC_LEG1_EN_MASK)) ? 10u : 0u) == report.onTime);
+    TEST_CHECK((test_regCurrentPa(TEST_IDACA) * 10) == ((int64_t)report.charge * (int64_t)CY_CSDIDAC_CHARGE_UNIT_PA));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_GetChargeReport(CY_CSDIDAC_B, &report, &test_context));
+    TEST_CHECK(0u != report.onTime);
+
+    return (TEST_RESULT("test_charge"));
+}
+
+
+/* [] END OF FILE */
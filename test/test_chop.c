@@ -0,0 +1,143 @@
+/***************************************************************************//**
+* \file test_chop.c
+*
+* \brief
+* The host test of the periodic polarity chopping: the phase timing with and
+* without the dead time, the zero average current over each period, the
+* fixed LSB range across the polarity changes, the alternating sync
+* callbacks, the parameter validation, and the cost per tick.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_csdidac_chop.h"
+
+#define TEST_PERIODS                            (8u)
+#define TEST_BENCH_TICKS                        (1000000u)
+
+static uint32_t test_syncs;
+static cy_en_csdidac_polarity_t test_lastPolarity;
+static bool test_alternates;
+
+static void test_syncCallback(cy_en_csdidac_polarity_t polarity, void * param)
+{
+    (void)param;
+    if ((0u != test_syncs) && (polarity == test_lastPolarity))
+    {
+        test_alternates = false;
+    }
+    test_lastPolarity = polarity;
+    test_syncs++;
+}
+
+/* Runs the chopping for the periods and checks the output of each tick against the phase timing */
+static void test_chop(cy_en_csdidac_choice_t ch, uint32_t current, uint32_t halfPeriod, uint32_t deadTime)
+{
+    cy_stc_csdidac_chop_config_t chopConfig = {ch, current, halfPeriod, deadTime, &test_syncCallback, NULL};
+    cy_stc_csdidac_chop_t chop;
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t code;
+    uint32_t period = 2u * (halfPeriod + deadTime);
+    uint32_t position;
+    uint32_t idacRegValue;
+    int64_t expected;
+    int64_t charge = 0;
+    uint32_t tick;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_GPIO));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ChopInit(&chopConfig, &chop, &test_context));
+    test_syncs = 0u;
+    test_alternates = true;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ChopStart(&chop));
+    Cy_CSDIDAC_ConvertCurrent((int32_t)current, &polarity, &lsbIndex, &code);
+
+    for (tick = 0u; tick < (TEST_PERIODS * period); tick++)
+    {
+        position = tick % period;
+        if (position < halfPeriod)
+        {
+            expected = (int64_t)code * (int64_t)cy_csdidac_lsbPa[lsbIndex];
+        }
+        else if ((position >= (halfPeriod + deadTime)) && (position < ((2u * halfPeriod) + deadTime)))
+        {
+            expected = -(int64_t)code * (int64_t)cy_csdidac_lsbPa[lsbIndex];
+        }
+        else
+        {
+            expected = 0;
+        }
+        idacRegValue = (CY_CSDIDAC_B == ch) ? TEST_IDACB : TEST_IDACA;
+        TEST_CHECK(expected == test_regCurrentPa(idacRegValue));
+        TEST_CHECK((uint32_t)lsbIndex == Cy_CSDIDAC_GetIdacRegLsb(idacRegValue));
+        if (CY_CSDIDAC_AB == ch)
+        {
+            TEST_CHECK(TEST_IDACA == TEST_IDACB);
+        }
+        charge += test_regCurrentPa(idacRegValue);
+        Cy_CSDIDAC_ChopTick(&chop);
+    }
+    TEST_CHECK(0 == charge);
+    TEST_CHECK((2u * TEST_PERIODS) + 1u == test_syncs);
+    TEST_CHECK(true == test_alternates);
+    TEST_CHECK(CY_CSDIDAC_SOURCE == test_lastPolarity);
+
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ChopStop(&chop));
+    TEST_CHECK(0u == (TEST_IDACA & CY_CSDIDAC_MAX_CODE));
+    TEST_CHECK(0u == (TEST_IDACB & CY_CSDIDAC_MAX_CODE));
+    Cy_CSDIDAC_ChopTick(&chop);
+    TEST_CHECK(0u == (TEST_IDACA & CY_CSDIDAC_MAX_CODE));
+}
+
+int main(void)
+{
+    cy_stc_csdidac_chop_config_t chopConfig = {CY_CSDIDAC_A, 5000u, 1u, 0u, NULL, NULL};
+    cy_stc_csdidac_chop_t chop;
+    uint64_t startNs;
+    uint32_t i;
+
+    test_chop(CY_CSDIDAC_A, 5000u, 3u, 0u);
+    test_chop(CY_CSDIDAC_B, 609600u, 1u, 0u);
+    test_chop(CY_CSDIDAC_AB, 5000u, 3u, 1u);
+    test_chop(CY_CSDIDAC_A, 37u, 5u, 2u);
+
+    /* The parameter validation */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ChopInit(NULL, &chop, &test_context));
+    chopConfig.halfPeriod = 0u;
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ChopInit(&chopConfig, &chop, &test_context));
+    chopConfig.halfPeriod = 1u;
+    chopConfig.current = CY_CSDIDAC_MAX_CURRENT_NA + 1u;
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ChopInit(&chopConfig, &chop, &test_context));
+    chopConfig.current = 5000u;
+    chopConfig.ch = CY_CSDIDAC_AB;
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ChopInit(&chopConfig, &chop, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ChopStart(NULL));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ChopStop(NULL));
+
+    /* The cost per tick of the fastest chopping */
+    chopConfig.ch = CY_CSDIDAC_A;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ChopInit(&chopConfig, &chop, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ChopStart(&chop));
+    cy_stub_reset();
+    startNs = test_timeNs();
+    for (i = 0u; i < TEST_BENCH_TICKS; i++)
+    {
+        Cy_CSDIDAC_ChopTick(&chop);
+    }
+    (void)printf("half period of one tick: %.1f ns, %.2f cycles, %.2f IDAC writes per tick\n",
+                 (double)(test_timeNs() - startNs) / (double)TEST_BENCH_TICKS,
+                 (double)cy_stub_cycles / (double)TEST_BENCH_TICKS, (double)cy_stub_csdWrites / (double)TEST_BENCH_TICKS);
+    TEST_CHECK(TEST_BENCH_TICKS == cy_stub_csdWrites);
+
+    return (TEST_RESULT("test_chop"));
+}
+
+
+/* [] END OF FILE */
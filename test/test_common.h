@@ -0,0 +1,99 @@
+/***************************************************************************//**
+* \file test_common.h
+*
+* \brief
+* The common definitions of the CSDIDAC middleware host tests: the check
+* macros, the host timer, and the CSDIDAC instance on the simulated CSD HW
+* block with one GPIO port.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#if !defined(TEST_COMMON_H)
+#define TEST_COMMON_H
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include "cy_csdidac.h"
+
+static uint32_t test_failures;
+
+#define TEST_CHECK(cond) \
+    do { \
+        if (!(cond)) \
+        { \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            test_failures++; \
+        } \
+    } while (0)
+
+#define TEST_CHECK_STATUS(expr) TEST_CHECK(CY_CSDIDAC_SUCCESS == (expr))
+
+/* Prints the test result and returns the exit status of main() */
+#define TEST_RESULT(name) \
+    ((void)printf("%s: %s\n", (name), (0u == test_failures) ? "PASS" : "FAIL"), (0u == test_failures) ? 0 : 1)
+
+/* The simulated CSD HW block and the GPIO port of the IDAC pins */
+static CSD_Type test_csd;
+static cy_stc_csd_context_t test_csdContext;
+static GPIO_PRT_Type test_port;
+static const cy_stc_csdidac_pin_t test_pinA = {&test_port, 1u};
+static const cy_stc_csdidac_pin_t test_pinB = {&test_port, 2u};
+static cy_stc_csdidac_config_t test_config;
+static cy_stc_csdidac_context_t test_context;
+
+#define TEST_IDACA                              (test_csd.reg[CY_CSD_REG_OFFSET_IDACA >> 2u])
+#define TEST_IDACB                              (test_csd.reg[CY_CSD_REG_OFFSET_IDACB >> 2u])
+#define TEST_SW_BYP_SEL                         (test_csd.reg[CY_CSD_REG_OFFSET_SW_BYP_SEL >> 2u])
+
+/* Initializes the CSDIDAC instance with the specified channel configurations */
+static inline cy_en_csdidac_status_t test_init(cy_en_csdidac_channel_config_t configA,
+                                               cy_en_csdidac_channel_config_t configB)
+{
+    cy_stub_reset();
+    (void)memset((void *)&test_csd, 0, sizeof(test_csd));
+    (void)memset(&test_csdContext, 0, sizeof(test_csdContext));
+    (void)memset((void *)&test_port, 0, sizeof(test_port));
+    (void)memset(&test_config, 0, sizeof(test_config));
+    (void)memset(&test_context, 0, sizeof(test_context));
+    test_config.base = &test_csd;
+    test_config.csdCxtPtr = &test_csdContext;
+    test_config.configA = configA;
+    test_config.configB = configB;
+    test_config.ptrPinA = &test_pinA;
+    test_config.ptrPinB = &test_pinB;
+    test_config.cpuClk = 48000000u;
+    test_config.csdInitTime = 10u;
+    return (Cy_CSDIDAC_Init(&test_config, &test_context));
+}
+
+/* Returns the current of the IDAC register value in pA with a sign */
+static inline int64_t test_regCurrentPa(uint32_t idacRegValue)
+{
+    uint32_t lsbIndex = ((idacRegValue & CY_CSDIDAC_LSB_MASK) >> (CY_CSDIDAC_LSB_POS - 1u)) |
+                        ((idacRegValue & CY_CSDIDAC_LEG2_EN_MASK) >> CY_CSDIDAC_LEG2_EN_POS);
+    int64_t current = (int64_t)(idacRegValue & CY_CSDIDAC_MAX_CODE) * (int64_t)cy_csdidac_lsbPa[lsbIndex];
+
+    return ((0u != (idacRegValue & CY_CSDIDAC_POLARITY_MASK)) ? -current : current);
+}
+
+/* Returns the monotonic host time in ns */
+static inline uint64_t test_timeNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return (((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec);
+}
+
+#endif /* TEST_COMMON_H */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,116 @@
+/***************************************************************************//**
+* \file test_dds.c
+*
+* \brief
+* The host test of the DDS waveform generator: the generated IDAC current is
+* compared with the reference sine by the single-bin DFT at the expected
+* frequency, and the residual against the reference is bounded.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include <math.h>
+#include "test_common.h"
+#include "cy_csdidac_dds.h"
+
+#define TEST_PI                                 (3.14159265358979323846)
+#define TEST_TICK_FREQUENCY                     (10000u)
+#define TEST_SAMPLES                            (10000u)
+
+/* The spectral comparison result of one DDS setting */
+typedef struct
+{
+    double amplitude;   /* The fundamental amplitude in nA */
+    double phase;       /* The fundamental phase in rad relative to the reference sine */
+    double thdn;        /* The THD+N relative to the fundamental */
+    double maxError;    /* The maximum deviation from the reference sine in nA */
+} test_spectrum_t;
+
+/* Generates TEST_SAMPLES samples and compares them with the reference sine */
+static void test_analyze(cy_stc_csdidac_dds_t * dds, uint32_t frequency, uint32_t amplitude, test_spectrum_t * result)
+{
+    double re = 0.0;
+    double im = 0.0;
+    double power = 0.0;
+    double fundamental;
+    double cycles = ((double)frequency / 1000.0) * ((double)TEST_SAMPLES / (double)TEST_TICK_FREQUENCY);
+    uint32_t n;
+
+    result->maxError = 0.0;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_DdsSetFrequency(frequency, dds));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_DdsSetAmplitude(amplitude, dds));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_DdsStart(dds));
+    for (n = 0u; n < TEST_SAMPLES; n++)
+    {
+        double angle = (2.0 * TEST_PI * cycles * (double)n) / (double)TEST_SAMPLES;
+        double sample;
+        double error;
+
+        Cy_CSDIDAC_DdsTick(dds);
+        sample = (double)test_regCurrentPa(TEST_IDACA) / 1000.0;
+        re += sample * sin(angle);
+        im += sample * cos(angle);
+        power += sample * sample;
+        error = fabs(sample - ((double)amplitude * sin(angle)));
+        if (error > result->maxError)
+        {
+            result->maxError = error;
+        }
+    }
+    re = (2.0 * re) / (double)TEST_SAMPLES;
+    im = (2.0 * im) / (double)TEST_SAMPLES;
+    result->amplitude = sqrt((re * re) + (im * im));
+    result->phase = atan2(im, re);
+    fundamental = (result->amplitude * result->amplitude) / 2.0;
+    power /= (double)TEST_SAMPLES;
+    result->thdn = sqrt(fabs(power - fundamental) / fundamental);
+    TEST_CHECK_STATUS(Cy_CSDIDAC_DdsStop(dds));
+}
+
+int main(void)
+{
+    static const uint32_t frequencies[] = {10000u, 50000u, 100000u, 250000u, 1000000u};
+    static const uint32_t amplitudes[] = {3000u, 30000u, 150000u, 500000u};
+    cy_stc_csdidac_dds_config_t ddsConfig = {CY_CSDIDAC_A, CY_CSDIDAC_DDS_SINE, TEST_TICK_FREQUENCY};
+    cy_stc_csdidac_dds_t dds;
+    test_spectrum_t result;
+    uint32_t i;
+    uint32_t j;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_DdsInit(&ddsConfig, &dds, &test_context));
+
+    /* The frequency must be below the Nyquist frequency */
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_DdsSetFrequency(TEST_TICK_FREQUENCY * 500u, &dds));
+
+    for (i = 0u; i < (sizeof(frequencies) / sizeof(frequencies[0u])); i++)
+    {
+        for (j = 0u; j < (sizeof(amplitudes) / sizeof(amplitudes[0u])); j++)
+        {
+            double lsbNa;
+
+            test_analyze(&dds, frequencies[i], amplitudes[j], &result);
+            lsbNa = (double)cy_csdidac_lsbPa[dds.lsbIndex] / 1000.0;
+            (void)printf("  %7.1f Hz %6u nA: amplitude %9.1f nA, phase %+.4f rad, THD+N %5.2f%%, max error %7.1f nA\n",
+                         (double)frequencies[i] / 1000.0, (unsigned)amplitudes[j], result.amplitude,
+                         result.phase, 100.0 * result.thdn, result.maxError);
+            /* The fundamental matches the reference sine within one LSB */
+            TEST_CHECK(fabs(result.amplitude - (double)amplitudes[j]) <= lsbNa);
+            TEST_CHECK(fabs(result.phase) <= 0.05);
+            /* The residual is bounded by the quantization and the table interpolation */
+            TEST_CHECK(result.thdn <= 0.05);
+            TEST_CHECK(result.maxError <= (0.06 * (double)amplitudes[j]) + lsbNa);
+        }
+    }
+
+    /* The zero amplitude keeps the output at the zero code */
+    test_analyze(&dds, 100000u, 0u, &result);
+    TEST_CHECK(0.0 == result.amplitude);
+
+    return (TEST_RESULT("test_dds"));
+}
@@ -0,0 +1,144 @@
+/***************************************************************************//**
+* \file test_diff.c
+*
+* \brief
+* The host test of the differential source/sink pair against two simulated
+* IDACs with the opposite gain errors and the zero-code offset currents:
+* the corrected currents and the pair mismatch in both current directions,
+* the back-to-back writes in one critical section, the context coherence,
+* and the configuration and the calibration validation.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_csdidac_diff.h"
+
+/* The simulated IDACs: the gain in 1/1024 units and the current at the zero code in pA */
+#define TEST_GAIN_A                             (1055)
+#define TEST_OFFSET_A                           (60000)
+#define TEST_GAIN_B                             (990)
+#define TEST_OFFSET_B                           (-90000)
+
+#define TEST_STEP_NA                            (37)
+
+static uint32_t test_writes;
+static bool test_writeUnmasked;
+
+static void test_csdWriteHook(const CSD_Type * base, uint32_t offset, uint32_t value)
+{
+    (void)base;
+    (void)value;
+    if ((CY_CSD_REG_OFFSET_IDACA == offset) || (CY_CSD_REG_OFFSET_IDACB == offset))
+    {
+        test_writes++;
+        test_writeUnmasked |= (false == cy_stub_intrMasked);
+    }
+}
+
+/* Returns the simulated output current in pA */
+static int64_t test_outputPa(uint32_t idacRegValue, int64_t gain, int64_t offset)
+{
+    return (((test_regCurrentPa(idacRegValue) * gain) / 1024) + offset);
+}
+
+int main(void)
+{
+    cy_stc_csdidac_range_cal_t calA[CY_CSDIDAC_LSB_NUM];
+    cy_stc_csdidac_range_cal_t calB[CY_CSDIDAC_LSB_NUM];
+    cy_stc_csdidac_diff_config_t diffConfig = {calA, calB};
+    cy_stc_csdidac_diff_t diff;
+    int64_t lsb;
+    int64_t target;
+    int64_t currentA;
+    int64_t currentB;
+    int64_t mismatch;
+    double maxMismatch[2u] = {0.0, 0.0};
+    double maxError = 0.0;
+    int32_t current;
+    uint32_t direction;
+    uint32_t i;
+
+    for (i = 0u; i < CY_CSDIDAC_LSB_NUM; i++)
+    {
+        calA[i].gain = (uint32_t)((TEST_GAIN_A << CY_CSDIDAC_CAL_GAIN_SHIFT) / 1024);
+        calA[i].offset = TEST_OFFSET_A;
+        calA[i].inl = 0;
+        calA[i].dnl = 0;
+        calB[i].gain = (uint32_t)((TEST_GAIN_B << CY_CSDIDAC_CAL_GAIN_SHIFT) / 1024);
+        calB[i].offset = TEST_OFFSET_B;
+        calB[i].inl = 0;
+        calB[i].dnl = 0;
+    }
+
+    /* The configuration and the calibration validation */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_JOIN));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_DiffInit(&diffConfig, &diff, &test_context));
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_AMUX));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_DiffInit(NULL, &diff, &test_context));
+    calB[0u].gain = 1u;
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_DiffInit(&diffConfig, &diff, &test_context));
+    calB[0u].gain = calB[1u].gain;
+    calA[0u].offset = -(int32_t)(CY_CSDIDAC_LSB_37 * (CY_CSDIDAC_MAX_CODE + 1u));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_DiffInit(&diffConfig, &diff, &test_context));
+    calA[0u].offset = TEST_OFFSET_A;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_DiffInit(&diffConfig, &diff, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_DiffSet((int32_t)CY_CSDIDAC_MAX_CURRENT_NA + 1, &diff));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_DiffStart(&diff));
+
+    /*
+    * Both directions: the calibration of the sourcing IDAC A and the sinking
+    * IDAC B is applied to the reversed polarities with the offset sign of
+    * the active polarity, so the pair stays matched.
+    */
+    cy_stub_csdWriteHook = &test_csdWriteHook;
+    for (direction = 0u; direction < 2u; direction++)
+    {
+        for (current = 1000; current <= 550000; current += TEST_STEP_NA)
+        {
+            target = (int64_t)((0u == direction) ? current : -current) * 1000;
+            test_writes = 0u;
+            test_writeUnmasked = false;
+            TEST_CHECK_STATUS(Cy_CSDIDAC_DiffSet((int32_t)(target / 1000), &diff));
+            TEST_CHECK(2u == test_writes);
+            TEST_CHECK(false == test_writeUnmasked);
+            TEST_CHECK(TEST_IDACA == test_context.idacRegValueA);
+            TEST_CHECK(TEST_IDACB == test_context.idacRegValueB);
+
+            /* The conversion truncation, the correction rounding, and the gain of the measured LSB */
+            lsb = (int64_t)cy_csdidac_lsbPa[Cy_CSDIDAC_GetIdacRegLsb(TEST_IDACA)];
+            currentA = test_outputPa(TEST_IDACA, TEST_GAIN_A, TEST_OFFSET_A);
+            currentB = test_outputPa(TEST_IDACB, TEST_GAIN_B, TEST_OFFSET_B);
+            TEST_CHECK((2 * lsb) >= llabs(currentA - target));
+            TEST_CHECK((2 * lsb) >= llabs(currentB + target));
+            mismatch = llabs(currentA + currentB);
+            TEST_CHECK(((3 * lsb) / 2) >= mismatch);
+            if (((double)mismatch / (double)lsb) > maxMismatch[direction])
+            {
+                maxMismatch[direction] = (double)mismatch / (double)lsb;
+            }
+            if (((double)llabs(currentA - target) / (double)lsb) > maxError)
+            {
+                maxError = (double)llabs(currentA - target) / (double)lsb;
+            }
+        }
+    }
+    cy_stub_csdWriteHook = NULL;
+    (void)printf("max pair mismatch %.2f LSB positive, %.2f LSB negative, max IDAC A error %.2f LSB\n",
+                 maxMismatch[0u], maxMismatch[1u], maxError);
+
+    TEST_CHECK_STATUS(Cy_CSDIDAC_DiffStop(&diff));
+    TEST_CHECK(CY_CSDIDAC_DISABLE == test_context.channelStateA);
+    TEST_CHECK(CY_CSDIDAC_DISABLE == test_context.channelStateB);
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_DiffStop(NULL));
+
+    return (TEST_RESULT("test_diff"));
+}
+
+
+/* [] END OF FILE */
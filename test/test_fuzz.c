@@ -0,0 +1,98 @@
+/***************************************************************************//**
+* \file test_fuzz.c
+*
+* \brief
+* The deterministic driver of the fuzz harness of the fuzz directory:
+* the pseudo-random inputs of a fixed seed, the mismatch count against
+* the reference model, and the detection of an injected register
+* corruption by the oracle.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "fuzz/fuzz_csdidac.h"
+
+#define TEST_INPUTS                             (20000u)
+#define TEST_MAX_OPS                            (200u)
+#define TEST_SEED                               (0x2545F491u)
+
+static uint32_t test_state = TEST_SEED;
+
+/* The xorshift32 generator, the same sequence on each host */
+static uint32_t test_random(void)
+{
+    test_state ^= test_state << 13u;
+    test_state ^= test_state >> 17u;
+    test_state ^= test_state << 5u;
+    return (test_state);
+}
+
+int main(void)
+{
+    /* GPIO A and B: A enabled, the setpoint committed to A, B enabled */
+    static const uint8_t owned[] =
+    {
+        0x05u,
+        (uint8_t)FUZZ_OP_ENABLE, 0x10u, 0x27u, 0x00u, 0x00u,
+        (uint8_t)FUZZ_OP_SETPOINT, 0x30u, 0x75u, 0x00u, 0x00u,
+        (uint8_t)(FUZZ_OP_ENABLE | (1u << FUZZ_OP_CH_POS)), 0xE8u, 0x03u, 0x00u, 0x00u,
+    };
+    static uint8_t input[1u + (FUZZ_OP_SIZE * TEST_MAX_OPS)];
+    uint32_t mismatches = 0u;
+    uint32_t failedInputs = 0u;
+    uint64_t totalOps = 0u;
+    uint32_t ops;
+    uint32_t size;
+    uint64_t startNs;
+    uint64_t elapsedNs;
+    uint32_t i;
+    uint32_t j;
+
+    startNs = test_timeNs();
+    for (i = 0u; i < TEST_INPUTS; i++)
+    {
+        size = 1u + (FUZZ_OP_SIZE * (test_random() % (TEST_MAX_OPS + 1u))) + (test_random() % FUZZ_OP_SIZE);
+        size = (size > sizeof(input)) ? (uint32_t)sizeof(input) : size;
+        for (j = 0u; j < size; j++)
+        {
+            input[j] = (uint8_t)test_random();
+        }
+        ops = 0u;
+        j = fuzz_csdidacRun(input, size, &ops);
+        if ((0u != j) && (0u == failedInputs))
+        {
+            (void)printf("input %u: %u mismatches\n", (unsigned)i, (unsigned)j);
+        }
+        failedInputs += (0u != j) ? 1u : 0u;
+        mismatches += j;
+        totalOps += ops;
+    }
+    elapsedNs = test_timeNs() - startNs;
+    (void)printf("%u inputs, %llu operations: %u mismatches, %.1f M operations/s\n", (unsigned)TEST_INPUTS,
+                 (unsigned long long)totalOps, (unsigned)mismatches, ((double)totalOps * 1e3) / (double)elapsedNs);
+    TEST_CHECK(0u == mismatches);
+
+    /* The oracle compares the HW state, so the setpoint module may own an enabled channel */
+    TEST_CHECK(0u == fuzz_csdidacRun(owned, sizeof(owned), &ops));
+    TEST_CHECK(4u == ops);
+    TEST_CHECK(0 == LLVMFuzzerTestOneInput(owned, sizeof(owned)));
+
+    /* An injected corruption of the output is detected */
+    fuzz_csd.reg[CY_CSD_REG_OFFSET_IDACA >> 2u] ^= 1u;
+    TEST_CHECK(false == fuzz_csdidacCheck());
+    fuzz_csd.reg[CY_CSD_REG_OFFSET_IDACA >> 2u] ^= 1u;
+    TEST_CHECK(true == fuzz_csdidacCheck());
+    fuzz_csd.reg[CY_CSD_REG_OFFSET_SW_BYP_SEL >> 2u] = 0u;
+    TEST_CHECK(false == fuzz_csdidacCheck());
+
+    return (TEST_RESULT("test_fuzz"));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,158 @@
+/***************************************************************************//**
+* \file test_join.c
+*
+* \brief
+* The host test of the joined-channel current split: the error of the summed
+* output current of both IDACs against the single-channel conversion over
+* the whole joined range, and the register and the context state of the
+* joined output.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_csdidac_join.h"
+
+#define TEST_NA_TO_PA                           (1000)
+#define TEST_FINE_LIMIT_NA                      (614400)
+#define TEST_BAND_NUM                           (4u)
+
+/* The current bands of the report: the single-channel steps of 37.5 nA, 2.4 uA, 4.8 uA, and no single channel */
+static const int32_t test_bands[TEST_BAND_NUM + 1u] =
+{
+    0, 4762, 304800, 609600, (int32_t)CY_CSDIDAC_JOIN_MAX_CURRENT_NA + 1,
+};
+
+static int64_t test_abs(int64_t value)
+{
+    return ((0 > value) ? -value : value);
+}
+
+/* Returns the single-channel conversion error in pA */
+static int64_t test_singleError(int32_t current)
+{
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t code;
+
+    Cy_CSDIDAC_ConvertCurrent(current, &polarity, &lsbIndex, &code);
+
+    return (test_abs(test_regCurrentPa(Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, code)) -
+                     ((int64_t)current * TEST_NA_TO_PA)));
+}
+
+int main(void)
+{
+    cy_stc_csdidac_join_t join;
+    uint32_t regA;
+    uint32_t regB;
+    int64_t error;
+    int64_t bound;
+    int64_t maxJoined;
+    int64_t maxSingle;
+    double sumJoined;
+    double sumSingle;
+    uint32_t count;
+    uint32_t band;
+    int32_t current;
+
+    /* No channel is joined */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_GPIO));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_JoinInit(&join, &test_context));
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_JOIN));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_JoinInit(NULL, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_JoinInit(&join, NULL));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_JoinInit(&join, &test_context));
+
+    /* The range and the pointer validation */
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_JoinConvertCurrent((int32_t)CY_CSDIDAC_JOIN_MAX_CURRENT_NA + 1, &regA, &regB));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_JoinConvertCurrent(-(int32_t)CY_CSDIDAC_JOIN_MAX_CURRENT_NA - 1, &regA, &regB));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_JoinConvertCurrent(INT32_MIN, &regA, &regB));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_JoinConvertCurrent(0, NULL, &regB));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_JoinConvertCurrent(0, &regA, NULL));
+
+    /* Each current of both polarities: the joined split against the single channel */
+    for (band = 0u; band < TEST_BAND_NUM; band++)
+    {
+        maxJoined = 0;
+        maxSingle = 0;
+        sumJoined = 0.0;
+        sumSingle = 0.0;
+        count = 0u;
+        for (current = test_bands[band]; current < test_bands[band + 1u]; current++)
+        {
+            TEST_CHECK_STATUS(Cy_CSDIDAC_JoinConvertCurrent(current, &regA, &regB));
+            TEST_CHECK(CY_CSDIDAC_LSB_4800_IDX == Cy_CSDIDAC_GetIdacRegLsb(regA));
+            error = test_abs(test_regCurrentPa(regA) + test_regCurrentPa(regB) - ((int64_t)current * TEST_NA_TO_PA));
+
+            /* Half of the finest step: 37.5 nA up to 614.4 uA, the LSB of the IDAC B above */
+            bound = (TEST_FINE_LIMIT_NA >= current) ? (int64_t)(cy_csdidac_lsbPa[CY_CSDIDAC_LSB_37_IDX] / 2u) :
+                                                      (int64_t)(cy_csdidac_lsbPa[Cy_CSDIDAC_GetIdacRegLsb(regB)] / 2u);
+            TEST_CHECK(error <= bound);
+            maxJoined = (error > maxJoined) ? error : maxJoined;
+            sumJoined += (double)error;
+
+            TEST_CHECK_STATUS(Cy_CSDIDAC_JoinConvertCurrent(-current, &regA, &regB));
+            TEST_CHECK(test_abs(test_regCurrentPa(regA) + test_regCurrentPa(regB) + ((int64_t)current * TEST_NA_TO_PA)) == error);
+
+            if ((int32_t)CY_CSDIDAC_MAX_CURRENT_NA >= current)
+            {
+                error = test_singleError(current);
+                maxSingle = (error > maxSingle) ? error : maxSingle;
+                sumSingle += (double)error;
+            }
+            count++;
+        }
+        if ((int32_t)CY_CSDIDAC_MAX_CURRENT_NA > test_bands[band])
+        {
+            TEST_CHECK(maxJoined <= maxSingle);
+            (void)printf("%7d..%7d nA: joined max %5.1f mean %5.2f nA | single max %6.1f mean %6.2f nA\n",
+                         (int)test_bands[band], (int)test_bands[band + 1u] - 1,
+                         (double)maxJoined / 1000.0, sumJoined / ((double)count * 1000.0),
+                         (double)maxSingle / 1000.0, sumSingle / ((double)count * 1000.0));
+        }
+        else
+        {
+            (void)printf("%7d..%7d nA: joined max %5.1f mean %5.2f nA | single out of range\n",
+                         (int)test_bands[band], (int)test_bands[band + 1u] - 1,
+                         (double)maxJoined / 1000.0, sumJoined / ((double)count * 1000.0));
+        }
+    }
+
+    /* The joined output: both registers written, the context coherent */
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_JoinStart(NULL));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_JoinStart(&join));
+    TEST_CHECK(CY_CSDIDAC_ENABLE == test_context.channelStateA);
+    TEST_CHECK(CY_CSDIDAC_ENABLE == test_context.channelStateB);
+    TEST_CHECK(0 == test_regCurrentPa(TEST_IDACA) + test_regCurrentPa(TEST_IDACB));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_JoinSet(123456, NULL));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_JoinSet((int32_t)CY_CSDIDAC_JOIN_MAX_CURRENT_NA + 1, &join));
+    for (current = -(int32_t)CY_CSDIDAC_JOIN_MAX_CURRENT_NA; current <= (int32_t)CY_CSDIDAC_JOIN_MAX_CURRENT_NA; current += 76207)
+    {
+        TEST_CHECK_STATUS(Cy_CSDIDAC_JoinConvertCurrent(current, &regA, &regB));
+        TEST_CHECK_STATUS(Cy_CSDIDAC_JoinSet(current, &join));
+        TEST_CHECK(regA == TEST_IDACA);
+        TEST_CHECK(regB == TEST_IDACB);
+        TEST_CHECK(regA == join.idacRegValueA);
+        TEST_CHECK(regB == join.idacRegValueB);
+        TEST_CHECK(TEST_IDACA == test_context.idacRegValueA);
+        TEST_CHECK(TEST_IDACB == test_context.idacRegValueB);
+    }
+
+    /* The stop disables both channels */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_JoinStop(&join));
+    TEST_CHECK(CY_CSDIDAC_DISABLE == test_context.channelStateA);
+    TEST_CHECK(CY_CSDIDAC_DISABLE == test_context.channelStateB);
+    TEST_CHECK(0u == join.idacRegValueA);
+    TEST_CHECK(0u == join.idacRegValueB);
+
+    return (TEST_RESULT("test_join"));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,145 @@
+/***************************************************************************//**
+* \file test_latch.c
+*
+* \brief
+* The host test of the trigger-latched setpoints with a simulated trigger
+* source: the latched register values, the overrun accounting of random
+* staging between the triggers, the latch cost, and the jitter of the IDAC
+* register write instants relative to the trigger.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_csdidac_latch.h"
+
+#define TEST_EVENTS                             (100000u)
+#define TEST_MAX_STAGED_NA                      (300000)
+
+/* The simulated trigger: the cycle of the trigger ISR entry and the offsets of the IDAC writes */
+static uint32_t test_triggerCycle;
+static uint32_t test_writes;
+static uint32_t test_minOffset[2u] = {UINT32_MAX, UINT32_MAX};
+static uint32_t test_maxOffset[2u];
+
+static void test_csdWriteHook(const CSD_Type * base, uint32_t offset, uint32_t value)
+{
+    uint32_t ch = (CY_CSD_REG_OFFSET_IDACA == offset) ? 0u : 1u;
+    uint32_t delay = cy_stub_cycles - test_triggerCycle;
+
+    (void)base;
+    (void)value;
+    if ((CY_CSD_REG_OFFSET_IDACA == offset) || (CY_CSD_REG_OFFSET_IDACB == offset))
+    {
+        test_writes++;
+        test_minOffset[ch] = (delay < test_minOffset[ch]) ? delay : test_minOffset[ch];
+        test_maxOffset[ch] = (delay > test_maxOffset[ch]) ? delay : test_maxOffset[ch];
+    }
+}
+
+static int32_t test_randomCurrent(void)
+{
+    return ((rand() % (2 * TEST_MAX_STAGED_NA)) - TEST_MAX_STAGED_NA);
+}
+
+int main(void)
+{
+    cy_stc_csdidac_latch_t latch;
+    cy_stc_csdidac_setpoint_t setpoint;
+    int32_t stagedCurrent[2u] = {0, 0};
+    bool staged[2u] = {false, false};
+    uint32_t expectedOverruns = 0u;
+    uint32_t overruns = 0u;
+    uint32_t overrun;
+    uint32_t minCost = UINT32_MAX;
+    uint32_t maxCost = 0u;
+    uint32_t cost;
+    uint32_t expectedWrites;
+    uint32_t event;
+    int32_t current;
+
+    srand(1u);
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_GPIO));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_AB, 0, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_LatchInit(&latch, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_LatchStage(CY_CSDIDAC_AB, (int32_t)CY_CSDIDAC_MAX_CURRENT_NA + 1, &latch));
+    TEST_CHECK(0u == Cy_CSDIDAC_LatchGetPending(&latch));
+
+    cy_stub_csdWriteHook = &test_csdWriteHook;
+    for (event = 0u; event < TEST_EVENTS; event++)
+    {
+        switch (rand() % 4)
+        {
+            case 0:
+                /* The software stages the channel A */
+                current = test_randomCurrent();
+                TEST_CHECK_STATUS(Cy_CSDIDAC_LatchStage(CY_CSDIDAC_A, current, &latch));
+                expectedOverruns += (true == staged[0u]) ? 1u : 0u;
+                staged[0u] = true;
+                stagedCurrent[0u] = current;
+                break;
+            case 1:
+                /* The software stages both channels */
+                current = test_randomCurrent();
+                TEST_CHECK_STATUS(Cy_CSDIDAC_LatchStage(CY_CSDIDAC_AB, current, &latch));
+                expectedOverruns += ((true == staged[0u]) ? 1u : 0u) + ((true == staged[1u]) ? 1u : 0u);
+                staged[0u] = true;
+                staged[1u] = true;
+                stagedCurrent[0u] = current;
+                stagedCurrent[1u] = current;
+                break;
+            default:
+                /* The trigger ISR latches the pending channels */
+                expectedWrites = ((true == staged[0u]) ? 1u : 0u) + ((true == staged[1u]) ? 1u : 0u);
+                test_writes = 0u;
+                test_triggerCycle = cy_stub_cycles;
+                Cy_CSDIDAC_LatchTrigger(&latch);
+                cost = cy_stub_cycles - test_triggerCycle;
+                TEST_CHECK(expectedWrites == test_writes);
+                if (2u == expectedWrites)
+                {
+                    minCost = (cost < minCost) ? cost : minCost;
+                    maxCost = (cost > maxCost) ? cost : maxCost;
+                }
+                if (true == staged[0u])
+                {
+                    TEST_CHECK_STATUS(Cy_CSDIDAC_SetpointPrepare(CY_CSDIDAC_A, stagedCurrent[0u], &setpoint, &test_context));
+                    TEST_CHECK(setpoint.idacRegValue == TEST_IDACA);
+                }
+                if (true == staged[1u])
+                {
+                    TEST_CHECK_STATUS(Cy_CSDIDAC_SetpointPrepare(CY_CSDIDAC_B, stagedCurrent[1u], &setpoint, &test_context));
+                    TEST_CHECK(setpoint.idacRegValue == TEST_IDACB);
+                }
+                staged[0u] = false;
+                staged[1u] = false;
+                TEST_CHECK(0u == Cy_CSDIDAC_LatchGetPending(&latch));
+                break;
+        }
+        overrun = Cy_CSDIDAC_LatchGetOverrun(&latch);
+        overruns += (0u != (overrun & CY_CSDIDAC_LATCH_A_MSK)) ? 1u : 0u;
+        overruns += (0u != (overrun & CY_CSDIDAC_LATCH_B_MSK)) ? 1u : 0u;
+        TEST_CHECK(expectedOverruns == overruns);
+    }
+    cy_stub_csdWriteHook = NULL;
+
+    /* The write instants do not depend on the staging history */
+    (void)printf("latch of both channels: %u..%u cycles, %u missed updates\n",
+                 (unsigned)minCost, (unsigned)maxCost, (unsigned)overruns);
+    (void)printf("write instant after the trigger: A %u..%u cycles, B %u..%u cycles\n",
+                 (unsigned)test_minOffset[0u], (unsigned)test_maxOffset[0u],
+                 (unsigned)test_minOffset[1u], (unsigned)test_maxOffset[1u]);
+    TEST_CHECK(minCost == maxCost);
+    TEST_CHECK(test_minOffset[0u] == test_maxOffset[0u]);
+    TEST_CHECK(1u >= (test_maxOffset[1u] - test_minOffset[1u]));
+
+    return (TEST_RESULT("test_latch"));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,116 @@
+/***************************************************************************//**
+* \file test_linear.c
+*
+* \brief
+* The host test of the unified linear code space: the monotonic table,
+* the nearest index search, the single IDAC register write of the start,
+* and the coherence of the CSDIDAC context with the output.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_gpio.h"
+#include "cy_csdidac_linear.h"
+
+static uint32_t test_idacWrites;
+
+static void test_csdWriteHook(const CSD_Type * base, uint32_t offset, uint32_t value)
+{
+    (void)base;
+    (void)value;
+    if (CY_CSD_REG_OFFSET_IDACA == offset)
+    {
+        test_idacWrites++;
+    }
+}
+
+static bool test_isCoherent(void)
+{
+    return (TEST_IDACA == test_context.idacRegValueA);
+}
+
+int main(void)
+{
+    cy_stc_csdidac_linear_t linear;
+    int64_t current;
+    int64_t previous = INT64_MIN;
+    int64_t error;
+    int64_t maxError = 0;
+    int32_t index;
+    int32_t nearest;
+    int32_t nA;
+
+    /* The index is strictly monotonic in the current and matches the register value */
+    for (index = -CY_CSDIDAC_LINEAR_MAX_INDEX; index <= CY_CSDIDAC_LINEAR_MAX_INDEX; index++)
+    {
+        current = Cy_CSDIDAC_LinearGetCurrentPa(index);
+        TEST_CHECK(current > previous);
+        TEST_CHECK(current == test_regCurrentPa(Cy_CSDIDAC_LinearGetRegValue(index)));
+        previous = current;
+    }
+    TEST_CHECK((int64_t)CY_CSDIDAC_MAX_CURRENT_NA * 1000 == Cy_CSDIDAC_LinearGetCurrentPa(CY_CSDIDAC_LINEAR_MAX_INDEX));
+
+    /* The search returns the nearest current */
+    for (nA = -(int32_t)CY_CSDIDAC_MAX_CURRENT_NA; nA <= (int32_t)CY_CSDIDAC_MAX_CURRENT_NA; nA++)
+    {
+        index = Cy_CSDIDAC_LinearFindIndex(nA);
+        error = (int64_t)Cy_CSDIDAC_LinearGetCurrentPa(index) - ((int64_t)nA * 1000);
+        error = (0 > error) ? -error : error;
+        for (nearest = index - 1; nearest <= (index + 1); nearest++)
+        {
+            int64_t other = (int64_t)Cy_CSDIDAC_LinearGetCurrentPa(nearest) - ((int64_t)nA * 1000);
+
+            TEST_CHECK(error <= ((0 > other) ? -other : other));
+        }
+        maxError = (error > maxError) ? error : maxError;
+    }
+    /* The equally near currents resolve to the smaller magnitude, also across the LSB boundaries */
+    TEST_CHECK(9600000 == Cy_CSDIDAC_LinearGetCurrentPa(Cy_CSDIDAC_LinearFindIndex(9750)));
+    TEST_CHECK(-9600000 == Cy_CSDIDAC_LinearGetCurrentPa(Cy_CSDIDAC_LinearFindIndex(-9750)));
+    TEST_CHECK(4762500 == Cy_CSDIDAC_LinearGetCurrentPa(Cy_CSDIDAC_LinearFindIndex(4781)));
+    TEST_CHECK(4800000 == Cy_CSDIDAC_LinearGetCurrentPa(Cy_CSDIDAC_LinearFindIndex(4782)));
+    TEST_CHECK(-CY_CSDIDAC_LINEAR_MAX_INDEX == Cy_CSDIDAC_LinearFindIndex(INT32_MIN));
+    TEST_CHECK(CY_CSDIDAC_LINEAR_MAX_INDEX == Cy_CSDIDAC_LinearFindIndex(INT32_MAX));
+    (void)printf("search: max error %.1f nA\n", (double)maxError / 1000.0);
+
+    /* The start connects the output by one IDAC register write */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_LinearInit(CY_CSDIDAC_B, &linear, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_LinearInit(CY_CSDIDAC_A, &linear, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_LinearStart(CY_CSDIDAC_LINEAR_MAX_INDEX + 1, &linear));
+    cy_stub_csdWriteHook = &test_csdWriteHook;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_LinearStart(-300, &linear));
+    cy_stub_csdWriteHook = NULL;
+    TEST_CHECK(1u == test_idacWrites);
+    TEST_CHECK(Cy_CSDIDAC_LinearGetRegValue(-300) == TEST_IDACA);
+    TEST_CHECK(-300 == Cy_CSDIDAC_LinearGetIndex(&linear));
+    TEST_CHECK(CY_CSDIDAC_ENABLE == test_context.channelStateA);
+    TEST_CHECK(HSIOM_SEL_AMUXA == Cy_GPIO_GetHSIOM(test_pinA.ioPcPtr, test_pinA.pin));
+    TEST_CHECK(true == test_isCoherent());
+
+    /* Each step keeps the context coherent and the index is clamped */
+    for (index = 0; index < 1100; index++)
+    {
+        Cy_CSDIDAC_LinearStep(1, &linear);
+        TEST_CHECK(true == test_isCoherent());
+        TEST_CHECK(Cy_CSDIDAC_LinearGetRegValue(Cy_CSDIDAC_LinearGetIndex(&linear)) == TEST_IDACA);
+    }
+    TEST_CHECK(CY_CSDIDAC_LINEAR_MAX_INDEX == Cy_CSDIDAC_LinearGetIndex(&linear));
+    Cy_CSDIDAC_LinearStep(INT32_MIN, &linear);
+    TEST_CHECK(-CY_CSDIDAC_LINEAR_MAX_INDEX == Cy_CSDIDAC_LinearGetIndex(&linear));
+    TEST_CHECK(true == test_isCoherent());
+    Cy_CSDIDAC_LinearSet(Cy_CSDIDAC_LinearFindIndex(-12345), &linear);
+    TEST_CHECK(CY_CSDIDAC_SINK == Cy_CSDIDAC_GetIdacRegPolarity(test_context.idacRegValueA));
+    TEST_CHECK(true == test_isCoherent());
+
+    return (TEST_RESULT("test_linear"));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,116 @@
+/***************************************************************************//**
+* \file test_masked.c
+*
+* \brief
+* The host test of the interrupt-masked region of the output enable path:
+* the pin drive mode and HSIOM read-modify-writes are performed with
+* interrupts disabled, and the masked cycles reported by
+* Cy_CSDIDAC_GetMaxMaskedCycles() stay within the budget of each channel
+* configuration. The test is built with the charge accounting, the write
+* verification, and the automatic routing, that are updated outside of
+* the masked region: their cost does not change the budgets.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+
+/*
+* The masked-cycle budgets in the simulated cycles: a GPIO write costs three
+* cycles, a CSD register write or read-modify-write costs one or two cycles.
+*/
+#define TEST_BUDGET_ONE_PIN                     (12u)
+#define TEST_BUDGET_TWO_PINS                    (20u)
+#define TEST_BUDGET_AMUX                        (6u)
+
+/* The cycles of the verification callback, that must not be masked */
+#define TEST_CALLBACK_CYCLES                    (100u)
+
+static uint32_t test_calls;
+static bool test_callbackMasked;
+
+static void test_callback(cy_en_csdidac_status_t status, cy_en_csdidac_choice_t ch, void * param)
+{
+    (void)status;
+    (void)ch;
+    (void)param;
+    test_calls++;
+    test_callbackMasked |= cy_stub_intrMasked;
+    cy_stub_cycles += TEST_CALLBACK_CYCLES;
+}
+
+static void test_enable(const char * name, cy_en_csdidac_channel_config_t configA,
+                        cy_en_csdidac_channel_config_t configB, cy_en_csdidac_choice_t ch, uint32_t budget)
+{
+    uint32_t maxCycles;
+
+    TEST_CHECK_STATUS(test_init(configA, configB));
+    Cy_CSDIDAC_ResetMaxMaskedCycles(&test_context);
+    cy_stub_gpioWrites = 0u;
+    cy_stub_gpioWritesUnmasked = 0u;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(ch, -500000, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(ch, 200000, &test_context));
+    maxCycles = Cy_CSDIDAC_GetMaxMaskedCycles(&test_context);
+    (void)printf("%-16s %2u masked cycles (budget %2u), %u GPIO writes, %u unmasked\n", name,
+                 (unsigned)maxCycles, (unsigned)budget, (unsigned)cy_stub_gpioWrites,
+                 (unsigned)cy_stub_gpioWritesUnmasked);
+
+    /* The port registers are never read-modify-written with interrupts enabled */
+    TEST_CHECK(0u == cy_stub_gpioWritesUnmasked);
+    TEST_CHECK(false == cy_stub_intrMasked);
+    TEST_CHECK(0u != maxCycles);
+    TEST_CHECK(budget >= maxCycles);
+}
+
+int main(void)
+{
+    test_enable("GPIO A:", CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED, CY_CSDIDAC_A, TEST_BUDGET_ONE_PIN);
+    test_enable("GPIO B:", CY_CSDIDAC_DISABLED, CY_CSDIDAC_GPIO, CY_CSDIDAC_B, TEST_BUDGET_ONE_PIN);
+    test_enable("GPIO A and B:", CY_CSDIDAC_GPIO, CY_CSDIDAC_GPIO, CY_CSDIDAC_AB, TEST_BUDGET_TWO_PINS);
+    test_enable("GPIO A joined:", CY_CSDIDAC_GPIO, CY_CSDIDAC_JOIN, CY_CSDIDAC_B, TEST_BUDGET_ONE_PIN);
+    test_enable("AMUX A:", CY_CSDIDAC_AMUX, CY_CSDIDAC_DISABLED, CY_CSDIDAC_A, TEST_BUDGET_AMUX);
+
+    /* The verification of each write reports the taken CSD HW block to the callback */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SetVerify(1u, &test_callback, NULL, &test_context));
+    test_csdContext.lockKey = CY_CSD_NONE_KEY;
+    Cy_CSDIDAC_ResetMaxMaskedCycles(&test_context);
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, -500000, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 200000, &test_context));
+    (void)printf("%-16s %2u masked cycles (budget %2u), %u callbacks\n", "Verify A:",
+                 (unsigned)Cy_CSDIDAC_GetMaxMaskedCycles(&test_context), (unsigned)TEST_BUDGET_ONE_PIN,
+                 (unsigned)test_calls);
+    TEST_CHECK(2u == test_calls);
+    TEST_CHECK(false == test_callbackMasked);
+    TEST_CHECK(TEST_BUDGET_ONE_PIN >= Cy_CSDIDAC_GetMaxMaskedCycles(&test_context));
+    TEST_CHECK(CY_CSDIDAC_HW_LOCKED == Cy_CSDIDAC_GetVerifyStatus(&test_context));
+
+    /* The automatic routing connects the output in the masked region of the write */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SetAutoRoute(true, 0u, &test_context));
+    Cy_CSDIDAC_ResetMaxMaskedCycles(&test_context);
+    cy_stub_gpioWrites = 0u;
+    cy_stub_gpioWritesUnmasked = 0u;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, -500000, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 200000, &test_context));
+    (void)printf("%-16s %2u masked cycles (budget %2u), %u GPIO writes, %u unmasked\n", "Autoroute A:",
+                 (unsigned)Cy_CSDIDAC_GetMaxMaskedCycles(&test_context), (unsigned)TEST_BUDGET_ONE_PIN,
+                 (unsigned)cy_stub_gpioWrites, (unsigned)cy_stub_gpioWritesUnmasked);
+    TEST_CHECK(0u != cy_stub_gpioWrites);
+    TEST_CHECK(0u == cy_stub_gpioWritesUnmasked);
+    TEST_CHECK(TEST_BUDGET_ONE_PIN >= Cy_CSDIDAC_GetMaxMaskedCycles(&test_context));
+
+    /* The reset clears the maximum */
+    Cy_CSDIDAC_ResetMaxMaskedCycles(&test_context);
+    TEST_CHECK(0u == Cy_CSDIDAC_GetMaxMaskedCycles(&test_context));
+
+    return (TEST_RESULT("test_masked"));
+}
+
+
+/* [] END OF FILE */
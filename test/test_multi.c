@@ -0,0 +1,202 @@
+/***************************************************************************//**
+* \file test_multi.c
+*
+* \brief
+* The host test of the multi-instance manager over three simulated CSD HW
+* blocks: the single settling wait of the interleaved startup, the release
+* of the captured blocks on a failure, the staging validation, and the
+* order, the register values and the critical section of the group update
+* against the same outputs set by Cy_CSDIDAC_OutputEnable() of each instance.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_csdidac_multi.h"
+
+#define TEST_INSTANCES                          (3u)
+#define TEST_ROUNDS                             (100000u)
+#define TEST_WRITE_NUM                          (16u)
+
+static CSD_Type test_csds[TEST_INSTANCES];
+static cy_stc_csd_context_t test_csdContexts[TEST_INSTANCES];
+static cy_stc_csdidac_config_t test_configs[TEST_INSTANCES];
+static cy_stc_csdidac_multi_t test_multi;
+
+/* The instance 2 has the IDAC B disabled: the virtual channel 5 */
+static const int32_t test_currents[2u * TEST_INSTANCES] = {1000, -250000, 37, 600000, -9000, 0};
+
+/* The IDAC register writes of the group update */
+static uint32_t test_writeChannel[TEST_WRITE_NUM];
+static uint32_t test_writeCount;
+static bool test_writeUnmasked;
+
+static void test_csdWriteHook(const CSD_Type * base, uint32_t offset, uint32_t value)
+{
+    uint32_t instance = (uint32_t)(base - test_csds);
+
+    (void)value;
+    if ((CY_CSD_REG_OFFSET_IDACA == offset) || (CY_CSD_REG_OFFSET_IDACB == offset))
+    {
+        if (test_writeCount < TEST_WRITE_NUM)
+        {
+            test_writeChannel[test_writeCount] = (2u * instance) + ((CY_CSD_REG_OFFSET_IDACA == offset) ? 0u : 1u);
+        }
+        test_writeCount++;
+        test_writeUnmasked |= (false == cy_stub_intrMasked);
+    }
+}
+
+static uint32_t test_idacReg(uint32_t channel)
+{
+    return (test_csds[channel >> 1u].reg[((0u == (channel & 1u)) ? CY_CSD_REG_OFFSET_IDACA : CY_CSD_REG_OFFSET_IDACB) >> 2u]);
+}
+
+static void test_setup(void)
+{
+    uint32_t i;
+
+    cy_stub_reset();
+    (void)memset((void *)test_csds, 0, sizeof(test_csds));
+    (void)memset(test_csdContexts, 0, sizeof(test_csdContexts));
+    (void)memset(&test_multi, 0, sizeof(test_multi));
+    for (i = 0u; i < TEST_INSTANCES; i++)
+    {
+        (void)memset(&test_configs[i], 0, sizeof(test_configs[i]));
+        test_configs[i].base = &test_csds[i];
+        test_configs[i].csdCxtPtr = &test_csdContexts[i];
+        test_configs[i].configA = CY_CSDIDAC_GPIO;
+        test_configs[i].configB = (2u == i) ? CY_CSDIDAC_DISABLED : CY_CSDIDAC_AMUX;
+        test_configs[i].ptrPinA = &test_pinA;
+        test_configs[i].ptrPinB = &test_pinB;
+        test_configs[i].cpuClk = 48000000u;
+        test_configs[i].csdInitTime = (uint8_t)(10u + (5u * i));
+    }
+}
+
+int main(void)
+{
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    cy_stc_csdidac_context_t * ptrContext;
+    uint32_t idacCode;
+    uint32_t multiCycles;
+    uint32_t enableCycles;
+    uint32_t channel;
+    uint32_t i;
+
+    /* The parameter validation */
+    test_setup();
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_MultiInit(NULL, 1u, &test_multi));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_MultiInit(test_configs, 0u, &test_multi));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_MultiInit(test_configs, CY_CSDIDAC_MULTI_MAX_INSTANCES + 1u, &test_multi));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_MultiStart(&test_multi));
+    TEST_CHECK(NULL == Cy_CSDIDAC_MultiGetContext(0u, &test_multi));
+
+    /* The block owned by other middleware fails the startup and releases the captured ones */
+    test_csdContexts[1u].lockKey = CY_CSD_CAPSENSE_KEY;
+    TEST_CHECK(CY_CSDIDAC_SUCCESS != Cy_CSDIDAC_MultiInit(test_configs, TEST_INSTANCES, &test_multi));
+    TEST_CHECK(CY_CSD_NONE_KEY == test_csdContexts[0u].lockKey);
+    TEST_CHECK(CY_CSD_CAPSENSE_KEY == test_csdContexts[1u].lockKey);
+    TEST_CHECK(CY_CSD_NONE_KEY == test_csdContexts[2u].lockKey);
+    TEST_CHECK(0u == test_multi.instanceCount);
+    TEST_CHECK(0u == cy_stub_delays);
+
+    /* The startup waits once for the slowest block */
+    test_setup();
+    TEST_CHECK_STATUS(Cy_CSDIDAC_MultiInit(test_configs, TEST_INSTANCES, &test_multi));
+    TEST_CHECK(1u == cy_stub_delays);
+    TEST_CHECK(test_configs[TEST_INSTANCES - 1u].csdInitTime == cy_stub_delayUs);
+    for (i = 0u; i < TEST_INSTANCES; i++)
+    {
+        TEST_CHECK(CY_CSD_IDAC_KEY == test_csdContexts[i].lockKey);
+        TEST_CHECK(&test_multi.context[i] == Cy_CSDIDAC_MultiGetContext(i, &test_multi));
+    }
+    TEST_CHECK(NULL == Cy_CSDIDAC_MultiGetContext(TEST_INSTANCES, &test_multi));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_MultiStart(&test_multi));
+
+    /* The staging validation */
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_MultiStage(5u, 1000, &test_multi));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_MultiStage(2u * TEST_INSTANCES, 1000, &test_multi));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_MultiStage(0u, (int32_t)CY_CSDIDAC_MAX_CURRENT_NA + 1, &test_multi));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_MultiStage(0u, 1000, NULL));
+
+    /* The staged outputs are written by the update only, in the ascending order and with the interrupts masked */
+    for (channel = 5u; channel > 0u; channel--)
+    {
+        TEST_CHECK_STATUS(Cy_CSDIDAC_MultiStage(channel - 1u, test_currents[channel - 1u], &test_multi));
+    }
+    TEST_CHECK(0u == (test_idacReg(0u) & CY_CSDIDAC_MAX_CODE));
+    test_writeCount = 0u;
+    test_writeUnmasked = false;
+    cy_stub_csdWriteHook = &test_csdWriteHook;
+    Cy_CSDIDAC_MultiUpdate(&test_multi);
+    cy_stub_csdWriteHook = NULL;
+    TEST_CHECK(5u == test_writeCount);
+    TEST_CHECK(false == test_writeUnmasked);
+    TEST_CHECK(false == cy_stub_intrMasked);
+    for (channel = 0u; channel < 5u; channel++)
+    {
+        TEST_CHECK(channel == test_writeChannel[channel]);
+        Cy_CSDIDAC_ConvertCurrent(test_currents[channel], &polarity, &lsbIndex, &idacCode);
+        TEST_CHECK(Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, idacCode) == test_idacReg(channel));
+        ptrContext = Cy_CSDIDAC_MultiGetContext(channel >> 1u, &test_multi);
+        TEST_CHECK(test_idacReg(channel) == ((0u == (channel & 1u)) ? ptrContext->idacRegValueA : ptrContext->idacRegValueB));
+    }
+    TEST_CHECK(0u == test_multi.pending);
+
+    /* The update without the staged outputs writes nothing */
+    test_writeCount = 0u;
+    cy_stub_csdWriteHook = &test_csdWriteHook;
+    Cy_CSDIDAC_MultiUpdate(&test_multi);
+    cy_stub_csdWriteHook = NULL;
+    TEST_CHECK(0u == test_writeCount);
+
+    /* The group update against the output enable of each channel */
+    cy_stub_reset();
+    for (i = 0u; i < TEST_ROUNDS; i++)
+    {
+        for (channel = 0u; channel < 5u; channel++)
+        {
+            (void)Cy_CSDIDAC_MultiStage(channel, test_currents[channel], &test_multi);
+        }
+        Cy_CSDIDAC_MultiUpdate(&test_multi);
+    }
+    multiCycles = cy_stub_cycles;
+    cy_stub_reset();
+    for (i = 0u; i < TEST_ROUNDS; i++)
+    {
+        for (channel = 0u; channel < 5u; channel++)
+        {
+            (void)Cy_CSDIDAC_OutputEnable((0u == (channel & 1u)) ? CY_CSDIDAC_A : CY_CSDIDAC_B, test_currents[channel],
+                                          &test_multi.context[channel >> 1u]);
+        }
+    }
+    enableCycles = cy_stub_cycles;
+    (void)printf("5 channels: %.2f cycles per staged group update, %.2f cycles by OutputEnable\n",
+                 (double)multiCycles / (double)TEST_ROUNDS, (double)enableCycles / (double)TEST_ROUNDS);
+    TEST_CHECK(multiCycles < enableCycles);
+
+    /* The stop and the release of all blocks */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_MultiStop(&test_multi));
+    for (channel = 0u; channel < 5u; channel++)
+    {
+        TEST_CHECK(0u == (test_idacReg(channel) & CY_CSDIDAC_MAX_CODE));
+    }
+    TEST_CHECK_STATUS(Cy_CSDIDAC_MultiDeInit(&test_multi));
+    for (i = 0u; i < TEST_INSTANCES; i++)
+    {
+        TEST_CHECK(CY_CSD_NONE_KEY == test_csdContexts[i].lockKey);
+    }
+    TEST_CHECK(NULL == Cy_CSDIDAC_MultiGetContext(0u, &test_multi));
+
+    return (TEST_RESULT("test_multi"));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,117 @@
+/***************************************************************************//**
+* \file test_pa.c
+*
+* \brief
+* The host test of the picoampere current API against the exact
+* integer-division reference for every pA value of the output range:
+* the chosen LSB, the rounded code, the sign symmetry, the range check,
+* and the reciprocal of the division-free rounding.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+
+/* The reciprocal ceil(2^42 / 9375) of the conversion, exact for the dividends below 2^28 */
+#define TEST_RECIPROCAL                         (469124962uLL)
+#define TEST_RECIPROCAL_SHIFT                   (42u)
+#define TEST_RECIPROCAL_RANGE                   (1uL << 28u)
+#define TEST_SYMMETRY_STRIDE                    (0xFFFu)
+
+/* The reference: the smallest LSB, which code rounded half away from zero fits */
+static void test_reference(uint64_t absCurrent, uint32_t * lsbIndex, uint32_t * code)
+{
+    uint32_t i;
+    uint64_t rounded = 0u;
+
+    for (i = 0u; i < CY_CSDIDAC_LSB_NUM; i++)
+    {
+        rounded = ((2u * absCurrent) + cy_csdidac_lsbPa[i]) / (2u * (uint64_t)cy_csdidac_lsbPa[i]);
+        if (CY_CSDIDAC_MAX_CODE >= rounded)
+        {
+            break;
+        }
+    }
+    *lsbIndex = i;
+    *code = (uint32_t)rounded;
+}
+
+int main(void)
+{
+    static const int64_t outOfRange[] =
+    {
+        (int64_t)CY_CSDIDAC_MAX_CURRENT_PA + 1, -(int64_t)CY_CSDIDAC_MAX_CURRENT_PA - 1,
+        INT64_MIN, INT64_MAX, (int64_t)1 << 32u,
+    };
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    cy_en_csdidac_lsb_t sinkLsbIndex;
+    uint32_t code;
+    uint32_t sinkCode;
+    uint32_t refLsbIndex;
+    uint32_t refCode;
+    uint32_t mismatches = 0u;
+    uint64_t startNs;
+    uint64_t elapsedNs;
+    uint64_t i;
+
+    /* Every pA value of the output range */
+    startNs = test_timeNs();
+    for (i = 0u; i <= CY_CSDIDAC_MAX_CURRENT_PA; i++)
+    {
+        test_reference(i, &refLsbIndex, &refCode);
+        if ((CY_CSDIDAC_SUCCESS != Cy_CSDIDAC_ConvertCurrentPa((int64_t)i, &polarity, &lsbIndex, &code)) ||
+            (refLsbIndex != (uint32_t)lsbIndex) || (refCode != code) || (CY_CSDIDAC_SOURCE != polarity))
+        {
+            if (0u == mismatches)
+            {
+                (void)printf("%llu pA: LSB index %u code %u, reference %u %u\n", (unsigned long long)i,
+                             (unsigned)lsbIndex, (unsigned)code, (unsigned)refLsbIndex, (unsigned)refCode);
+            }
+            mismatches++;
+        }
+        /* The sinking current is converted with the same LSB and code */
+        if (0u == (i & TEST_SYMMETRY_STRIDE))
+        {
+            TEST_CHECK_STATUS(Cy_CSDIDAC_ConvertCurrentPa(-(int64_t)i, &polarity, &sinkLsbIndex, &sinkCode));
+            TEST_CHECK((sinkLsbIndex == lsbIndex) && (sinkCode == code));
+            TEST_CHECK((0u == i) || (CY_CSDIDAC_SINK == polarity));
+        }
+    }
+    elapsedNs = test_timeNs() - startNs;
+    TEST_CHECK(0u == mismatches);
+    (void)printf("%llu currents checked, %u mismatches, %.1f ns per conversion with the reference\n",
+                 (unsigned long long)CY_CSDIDAC_MAX_CURRENT_PA + 1u, (unsigned)mismatches,
+                 (double)elapsedNs / ((double)CY_CSDIDAC_MAX_CURRENT_PA + 1.0));
+
+    for (i = 0u; i < (sizeof(outOfRange) / sizeof(outOfRange[0u])); i++)
+    {
+        TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ConvertCurrentPa(outOfRange[i], &polarity, &lsbIndex, &code));
+    }
+
+    /* The reciprocal is exact for all the dividends of the conversion */
+    for (i = 0u; i < TEST_RECIPROCAL_RANGE; i++)
+    {
+        if (((i * TEST_RECIPROCAL) >> TEST_RECIPROCAL_SHIFT) != (i / 9375u))
+        {
+            TEST_CHECK(false);
+            break;
+        }
+    }
+
+    /* The output enable writes the converted register value */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnablePa(CY_CSDIDAC_A, -1012500, &test_context));
+    TEST_CHECK(-1012500 == test_regCurrentPa(TEST_IDACA));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_OutputEnablePa(CY_CSDIDAC_A, INT64_MIN, &test_context));
+
+    return (TEST_RESULT("test_pa"));
+}
+
+
+/* [] END OF FILE */
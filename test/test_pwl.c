@@ -0,0 +1,165 @@
+/***************************************************************************//**
+* \file test_pwl.c
+*
+* \brief
+* The host test of the piecewise-linear profile interpolator: the deviation
+* from the exact linear interpolation over short, long, steep, and
+* full-scale segments of both polarities, the breakpoint callbacks, the
+* breakpoint validation, the IDAC register and context coherence, and
+* the looped profile cost per tick.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_csdidac_pwl.h"
+
+#define TEST_LOOP_TICKS                         (1000000u)
+
+static const cy_stc_csdidac_pwl_point_t test_points[] =
+{
+    {0u, 0}, {7u, 1001}, {1000u, -609600}, {1003u, 609600}, {100000u, 3}, {100001u, -5},
+};
+
+#define TEST_POINT_NUM                          (sizeof(test_points) / sizeof(test_points[0u]))
+
+static const cy_stc_csdidac_pwl_point_t test_triangle[] =
+{
+    {0u, -500000}, {50000u, 500000}, {100000u, -500000},
+};
+
+static uint32_t test_progress;
+static uint32_t test_lastPoint;
+static int32_t test_complete = -1;
+
+static void test_progressCallback(uint32_t point, void * param)
+{
+    (void)param;
+    test_progress++;
+    test_lastPoint = point;
+}
+
+static void test_completeCallback(uint32_t point, void * param)
+{
+    (void)param;
+    test_complete = (int32_t)point;
+}
+
+/* Returns the exact current of the profile in pA */
+static double test_exactPa(uint32_t time)
+{
+    uint32_t segment = 0u;
+
+    while (time >= test_points[segment + 1u].time)
+    {
+        segment++;
+    }
+
+    return (1000.0 * ((double)test_points[segment].current +
+                      (((double)test_points[segment + 1u].current - (double)test_points[segment].current) *
+                       (double)(time - test_points[segment].time)) /
+                      (double)(test_points[segment + 1u].time - test_points[segment].time)));
+}
+
+int main(void)
+{
+    cy_stc_csdidac_pwl_config_t pwlConfig =
+    {
+        CY_CSDIDAC_A, test_points, TEST_POINT_NUM, false, &test_progressCallback, &test_completeCallback, NULL,
+    };
+    cy_stc_csdidac_pwl_point_t badPoints[2u] = {{0u, 0}, {0u, 1}};
+    cy_stc_csdidac_pwl_t pwl;
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t idacCode;
+    uint32_t ticks = 0u;
+    uint32_t writes;
+    uint64_t startNs;
+    double error;
+    double maxError = 0.0;
+    uint32_t i;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+
+    /* The breakpoint validation */
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_PwlInit(NULL, &pwl, &test_context));
+    pwlConfig.pointCount = 1u;
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_PwlInit(&pwlConfig, &pwl, &test_context));
+    pwlConfig.pointCount = 2u;
+    pwlConfig.ptrPoints = badPoints;
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_PwlInit(&pwlConfig, &pwl, &test_context));
+    badPoints[1u].time = 1u;
+    badPoints[1u].current = (int32_t)CY_CSDIDAC_MAX_CURRENT_NA + 1;
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_PwlInit(&pwlConfig, &pwl, &test_context));
+    badPoints[1u].current = -(int32_t)CY_CSDIDAC_MAX_CURRENT_NA;
+    pwlConfig.ch = CY_CSDIDAC_B;
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_PwlInit(&pwlConfig, &pwl, &test_context));
+    pwlConfig.ch = CY_CSDIDAC_A;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_PwlInit(&pwlConfig, &pwl, &test_context));
+
+    /* The profile follows the exact interpolation within the Q32 rounding */
+    pwlConfig.ptrPoints = test_points;
+    pwlConfig.pointCount = TEST_POINT_NUM;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_PwlInit(&pwlConfig, &pwl, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_PwlStart(&pwl));
+    TEST_CHECK(CY_CSDIDAC_ENABLE == test_context.channelStateA);
+    while (true == Cy_CSDIDAC_PwlIsBusy(&pwl))
+    {
+        error = test_exactPa(ticks) - (double)Cy_CSDIDAC_PwlGetCurrentPa(&pwl);
+        error = (0.0 > error) ? -error : error;
+        maxError = (error > maxError) ? error : maxError;
+
+        /* The IDAC and the context follow the interpolated current */
+        TEST_CHECK_STATUS(Cy_CSDIDAC_ConvertCurrentPa(Cy_CSDIDAC_PwlGetCurrentPa(&pwl), &polarity, &lsbIndex, &idacCode));
+        TEST_CHECK(Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, idacCode) == TEST_IDACA);
+        TEST_CHECK(TEST_IDACA == test_context.idacRegValueA);
+        Cy_CSDIDAC_PwlTick(&pwl);
+        ticks++;
+    }
+    (void)printf("profile: %u ticks, max error %.3f pA from the exact interpolation\n", (unsigned)ticks, maxError);
+    TEST_CHECK(test_points[TEST_POINT_NUM - 1u].time == ticks);
+    TEST_CHECK(1.0 > maxError);
+    TEST_CHECK(((int64_t)test_points[TEST_POINT_NUM - 1u].current * 1000) == Cy_CSDIDAC_PwlGetCurrentPa(&pwl));
+    TEST_CHECK((TEST_POINT_NUM - 1u) == test_progress);
+    TEST_CHECK((TEST_POINT_NUM - 1u) == test_lastPoint);
+    TEST_CHECK((int32_t)(TEST_POINT_NUM - 1u) == test_complete);
+
+    /* The ticks after the completion do nothing */
+    writes = cy_stub_csdWrites;
+    Cy_CSDIDAC_PwlTick(&pwl);
+    TEST_CHECK(writes == cy_stub_csdWrites);
+
+    /* The looped triangle runs until stopped */
+    pwlConfig.ptrPoints = test_triangle;
+    pwlConfig.pointCount = sizeof(test_triangle) / sizeof(test_triangle[0u]);
+    pwlConfig.loop = true;
+    pwlConfig.ptrProgressCallback = NULL;
+    pwlConfig.ptrCompleteCallback = NULL;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_PwlInit(&pwlConfig, &pwl, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_PwlStart(&pwl));
+    cy_stub_reset();
+    startNs = test_timeNs();
+    for (i = 0u; i < TEST_LOOP_TICKS; i++)
+    {
+        Cy_CSDIDAC_PwlTick(&pwl);
+    }
+    (void)printf("looped: %.1f ns, %.2f cycles, %.3f IDAC writes per tick\n",
+                 (double)(test_timeNs() - startNs) / (double)TEST_LOOP_TICKS,
+                 (double)cy_stub_cycles / (double)TEST_LOOP_TICKS, (double)cy_stub_csdWrites / (double)TEST_LOOP_TICKS);
+    TEST_CHECK(true == Cy_CSDIDAC_PwlIsBusy(&pwl));
+    TEST_CHECK(-500000000 == Cy_CSDIDAC_PwlGetCurrentPa(&pwl));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_PwlStop(&pwl));
+    TEST_CHECK(false == Cy_CSDIDAC_PwlIsBusy(&pwl));
+    TEST_CHECK(CY_CSDIDAC_DISABLE == test_context.channelStateA);
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_PwlStop(NULL));
+
+    return (TEST_RESULT("test_pwl"));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,138 @@
+/***************************************************************************//**
+* \file test_regulator.c
+*
+* \brief
+* The host test of the closed-loop current regulator against a simulated
+* plant: the feedback is the IDAC current scaled by the load gain with
+* a leakage offset and a slow drift.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_csdidac_regulator.h"
+
+/* The simulated plant: the gain in 1/1024 units and the leakage in nA */
+typedef struct
+{
+    int64_t gain;
+    int64_t leakage;
+    int64_t drift;
+} test_plant_t;
+
+static int32_t test_plantFeedback(test_plant_t * plant)
+{
+    int64_t currentNa = test_regCurrentPa(TEST_IDACA) / 1000;
+
+    plant->leakage += plant->drift;
+    return ((int32_t)(((currentNa * plant->gain) / 1024) - plant->leakage));
+}
+
+static uint32_t test_lastIdacA;
+static uint32_t test_idacWrites;
+static uint32_t test_repeatedWrites;
+
+static void test_csdWriteHook(const CSD_Type * base, uint32_t offset, uint32_t value)
+{
+    (void)base;
+    if (CY_CSD_REG_OFFSET_IDACA == offset)
+    {
+        test_idacWrites++;
+        if (value == test_lastIdacA)
+        {
+            test_repeatedWrites++;
+        }
+        test_lastIdacA = value;
+    }
+}
+
+/* Runs the regulation steps and returns the last tracking error in nA */
+static int32_t test_regulate(int32_t target, uint32_t steps, test_plant_t * plant, cy_stc_csdidac_regulator_t * regulator)
+{
+    int32_t feedback = 0;
+    uint32_t i;
+
+    TEST_CHECK_STATUS(Cy_CSDIDAC_RegulatorSetTarget(target, regulator));
+    for (i = 0u; i < steps; i++)
+    {
+        feedback = test_plantFeedback(plant);
+        TEST_CHECK_STATUS(Cy_CSDIDAC_RegulatorUpdate(feedback, regulator));
+    }
+
+    return (target - feedback);
+}
+
+int main(void)
+{
+    static const int32_t targets[] = {1000, -3000, 20000, 150000, 400000, 9000, -250000, 600};
+    cy_stc_csdidac_regulator_config_t config = {CY_CSDIDAC_A, 64u, 48u, NULL, NULL};
+    cy_stc_csdidac_regulator_t regulator;
+    test_plant_t plant = {922, 500, 0};
+    int32_t error;
+    int32_t tolerance;
+    uint32_t i;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_GPIO));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_RegulatorInit(&config, &regulator, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_RegulatorStart(&regulator));
+
+    /* Tracking across the LSB ranges: the residual error is within two LSBs of the output range */
+    for (i = 0u; i < (sizeof(targets) / sizeof(targets[0])); i++)
+    {
+        error = test_regulate(targets[i], 200u, &plant, &regulator);
+        tolerance = (int32_t)((2u * cy_csdidac_lsbPa[regulator.lsbIndex]) / 1000u) + 1;
+        (void)printf("target %7d nA: error %5d nA, LSB index %u\n", targets[i], error, (unsigned)regulator.lsbIndex);
+        TEST_CHECK((error <= tolerance) && (error >= -tolerance));
+        TEST_CHECK(false == regulator.saturated);
+        TEST_CHECK((uint32_t)regulator.lsbIndex == Cy_CSDIDAC_GetIdacRegLsb(test_context.idacRegValueA));
+    }
+
+    /* Drift compensation */
+    plant.drift = 2;
+    error = test_regulate(50000, 400u, &plant, &regulator);
+    (void)printf("drift: error %d nA\n", error);
+    TEST_CHECK((error <= 50) && (error >= -50));
+    plant.drift = 0;
+
+    /* Anti-windup: an unreachable target saturates the output at the maximum code of the maximum LSB */
+    plant.gain = 512;
+    (void)test_regulate(600000, 500u, &plant, &regulator);
+    TEST_CHECK(true == regulator.saturated);
+    TEST_CHECK(CY_CSDIDAC_LSB_4800_IDX == regulator.lsbIndex);
+    TEST_CHECK(CY_CSDIDAC_MAX_CODE == (TEST_IDACA & CY_CSDIDAC_MAX_CODE));
+
+    /* The frozen integral lets the output leave the saturation without the windup delay */
+    for (i = 1u; i <= 100u; i++)
+    {
+        error = test_regulate(100000, 1u, &plant, &regulator);
+        if ((error <= 4800) && (error >= -4800))
+        {
+            break;
+        }
+    }
+    (void)printf("recovery after saturation: %u steps\n", (unsigned)i);
+    TEST_CHECK(false == regulator.saturated);
+    TEST_CHECK(40u >= i);
+
+    /* The register is written only when its value changes */
+    test_lastIdacA = TEST_IDACA;
+    cy_stub_csdWriteHook = &test_csdWriteHook;
+    (void)test_regulate(100000, 300u, &plant, &regulator);
+    cy_stub_csdWriteHook = NULL;
+    (void)printf("steady state: %u IDAC writes in 300 steps\n", (unsigned)test_idacWrites);
+    TEST_CHECK(0u == test_repeatedWrites);
+    TEST_CHECK(300u > test_idacWrites);
+
+    TEST_CHECK_STATUS(Cy_CSDIDAC_RegulatorStop(&regulator));
+    TEST_CHECK(0u == TEST_IDACA);
+
+    return (TEST_RESULT("test_regulator"));
+}
+
+
+/* [] END OF FILE */
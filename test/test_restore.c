@@ -0,0 +1,90 @@
+/***************************************************************************//**
+* \file test_restore.c
+*
+* \brief
+* The host test of the CSD HW block handoff: the Cy_CSDIDAC_Save() and
+* Cy_CSDIDAC_Restore() round trips of the separated and joined IDACs,
+* the selected flash configuration, the parameter and lock handling, and
+* the register writes and host time per round trip.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+
+#define TEST_ROUNDS                             (100000u)
+
+#define TEST_SW_REFGEN_SEL                      (test_csd.reg[CY_CSD_REG_OFFSET_SW_REFGEN_SEL >> 2u])
+#define TEST_IBCB_ON                            (0x00000010uL)
+#define TEST_IAIB_ON                            (0x00000001uL)
+
+/* The handoff to other middleware and back, with the output restored by the application */
+static void test_roundTrip(cy_en_csdidac_channel_config_t configB, uint32_t swRefgenSel)
+{
+    uint64_t startNs;
+    uint32_t idacRegValue;
+    uint32_t i;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, configB));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 5000, &test_context));
+    idacRegValue = TEST_IDACA;
+
+    /* The other middleware can not restore the block, that is still captured */
+    TEST_CHECK(CY_CSDIDAC_HW_LOCKED == Cy_CSDIDAC_Restore(&test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_Save(&test_context));
+    TEST_CHECK(CY_CSD_NONE_KEY == test_csdContext.lockKey);
+    TEST_CHECK(CY_CSDIDAC_DISABLE == test_context.channelStateA);
+    TEST_CHECK(CY_CSDIDAC_HW_LOCKED == Cy_CSDIDAC_Save(&test_context));
+
+    /* The other middleware leaves its configuration */
+    (void)memset((void *)&test_csd, 0xA5, sizeof(test_csd));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_Restore(&test_context));
+    TEST_CHECK(CY_CSD_IDAC_KEY == test_csdContext.lockKey);
+    TEST_CHECK(swRefgenSel == TEST_SW_REFGEN_SEL);
+    TEST_CHECK(0u == TEST_IDACA);
+    TEST_CHECK(0u == TEST_IDACB);
+    TEST_CHECK(0u == TEST_SW_BYP_SEL);
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 5000, &test_context));
+    TEST_CHECK(idacRegValue == TEST_IDACA);
+
+    cy_stub_reset();
+    startNs = test_timeNs();
+    for (i = 0u; i < TEST_ROUNDS; i++)
+    {
+        (void)Cy_CSDIDAC_Save(&test_context);
+        (void)Cy_CSDIDAC_Restore(&test_context);
+    }
+    (void)printf("%s: %.2f CSD writes, %.2f cycles, %.1f ns per Save and Restore\n",
+                 (CY_CSDIDAC_JOIN == configB) ? "joined   " : "separated",
+                 (double)cy_stub_csdWrites / (double)TEST_ROUNDS, (double)cy_stub_cycles / (double)TEST_ROUNDS,
+                 (double)(test_timeNs() - startNs) / (double)TEST_ROUNDS);
+    TEST_CHECK(CY_CSD_IDAC_KEY == test_csdContext.lockKey);
+    TEST_CHECK(swRefgenSel == TEST_SW_REFGEN_SEL);
+}
+
+int main(void)
+{
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_Save(NULL));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_Restore(NULL));
+
+    test_roundTrip(CY_CSDIDAC_AMUX, TEST_IBCB_ON);
+    test_roundTrip(CY_CSDIDAC_JOIN, TEST_IBCB_ON | TEST_IAIB_ON);
+
+    /* The joined configuration is not kept after the reinitialization with the separated IDACs */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_DeInit(&test_context));
+    test_config.configB = CY_CSDIDAC_GPIO;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_Init(&test_config, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_Save(&test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_Restore(&test_context));
+    TEST_CHECK(TEST_IBCB_ON == TEST_SW_REFGEN_SEL);
+
+    return (TEST_RESULT("test_restore"));
+}
+
+
+/* [] END OF FILE */
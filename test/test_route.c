@@ -0,0 +1,175 @@
+/***************************************************************************//**
+* \file test_route.c
+*
+* \brief
+* The host test of the automatic output routing: the connection on the first
+* nonzero code, the immediate and the idle-tick disconnection, the hot-path
+* IDAC register writes, the joined channels, the restoration of the default
+* policy, the context coherence, and the routing writes of a pulsed output
+* against the default policy.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_gpio.h"
+
+#define TEST_PULSES                             (1000u)
+#define TEST_PULSE_UPDATES                      (8u)
+#define TEST_BYPA                               (0x00001000uL)
+#define TEST_BYPB                               (0x00010000uL)
+
+static bool test_routedA(void)
+{
+    return ((HSIOM_SEL_AMUXA == Cy_GPIO_GetHSIOM(test_pinA.ioPcPtr, test_pinA.pin)) &&
+            (0u != (TEST_SW_BYP_SEL & TEST_BYPA)));
+}
+
+static bool test_unroutedA(void)
+{
+    return ((HSIOM_SEL_GPIO == Cy_GPIO_GetHSIOM(test_pinA.ioPcPtr, test_pinA.pin)) &&
+            (0u == (TEST_SW_BYP_SEL & TEST_BYPA)));
+}
+
+static bool test_routedB(void)
+{
+    return ((HSIOM_SEL_AMUXB == Cy_GPIO_GetHSIOM(test_pinB.ioPcPtr, test_pinB.pin)) &&
+            (0u != (TEST_SW_BYP_SEL & TEST_BYPB)));
+}
+
+/* The context describes the registers of the enabled channels */
+static bool test_coherent(void)
+{
+    return (((CY_CSDIDAC_DISABLE == test_context.channelStateA) || (TEST_IDACA == test_context.idacRegValueA)) &&
+            ((CY_CSDIDAC_DISABLE == test_context.channelStateB) || (TEST_IDACB == test_context.idacRegValueB)));
+}
+
+/* Returns the GPIO writes of the pulsed output: the nonzero updates separated by the zero output */
+static uint32_t test_pulses(bool autoRoute)
+{
+    uint32_t i;
+    uint32_t j;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SetAutoRoute(autoRoute, 0u, &test_context));
+    cy_stub_reset();
+    for (i = 0u; i < TEST_PULSES; i++)
+    {
+        for (j = 0u; j < TEST_PULSE_UPDATES; j++)
+        {
+            (void)Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, (int32_t)((j + 1u) * 1000u), &test_context);
+        }
+        (void)Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 0, &test_context);
+    }
+
+    return (cy_stub_gpioWrites);
+}
+
+int main(void)
+{
+    uint32_t routeWrites;
+    uint32_t savedWrites;
+    uint32_t defaultWrites;
+    uint32_t autoWrites;
+    uint32_t i;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_GPIO));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_SetAutoRoute(true, 0u, NULL));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_GetAutoRouteCounters(NULL, &savedWrites, &test_context));
+
+    /* The default policy connects the zero output */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 0, &test_context));
+    TEST_CHECK(true == test_routedA());
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SetAutoRoute(true, 0u, &test_context));
+    TEST_CHECK(true == test_unroutedA());
+
+    /* The immediate disconnection */
+    for (i = 0u; i < 10u; i++)
+    {
+        TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 0, &test_context));
+        TEST_CHECK(true == test_unroutedA());
+    }
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 1000, &test_context));
+    TEST_CHECK(true == test_routedA());
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 2000, &test_context));
+    TEST_CHECK(true == test_routedA());
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 0, &test_context));
+    TEST_CHECK(true == test_unroutedA());
+    TEST_CHECK(CY_CSDIDAC_ENABLE == test_context.channelStateA);
+    TEST_CHECK(true == test_coherent());
+
+    /* The hot-path IDAC register writes of the middleware modules */
+    Cy_CSDIDAC_WriteIdacReg(CY_CSDIDAC_A, Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 5u), &test_context);
+    TEST_CHECK(true == test_routedA());
+    Cy_CSDIDAC_WriteIdacReg(CY_CSDIDAC_A, Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 0u), &test_context);
+    TEST_CHECK(true == test_unroutedA());
+    TEST_CHECK(true == test_coherent());
+
+    /* The disconnection after the idle ticks */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SetAutoRoute(true, 3u, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 1000, &test_context));
+    Cy_CSDIDAC_AutoRouteTick(&test_context);
+    Cy_CSDIDAC_AutoRouteTick(&test_context);
+    Cy_CSDIDAC_AutoRouteTick(&test_context);
+    TEST_CHECK(true == test_routedA());
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 0, &test_context));
+    Cy_CSDIDAC_AutoRouteTick(&test_context);
+    Cy_CSDIDAC_AutoRouteTick(&test_context);
+    TEST_CHECK(true == test_routedA());
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 1000, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 0, &test_context));
+    Cy_CSDIDAC_AutoRouteTick(&test_context);
+    Cy_CSDIDAC_AutoRouteTick(&test_context);
+    TEST_CHECK(true == test_routedA());
+    Cy_CSDIDAC_AutoRouteTick(&test_context);
+    TEST_CHECK(true == test_unroutedA());
+    TEST_CHECK(true == test_coherent());
+
+    /* Both channels */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputDisable(CY_CSDIDAC_A, &test_context));
+    TEST_CHECK(true == test_unroutedA());
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_AB, -3000, &test_context));
+    TEST_CHECK((true == test_routedA()) && (true == test_routedB()));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputDisable(CY_CSDIDAC_AB, &test_context));
+    TEST_CHECK((true == test_unroutedA()) && (false == test_routedB()));
+
+    /* The disabled automatic routing connects the enabled outputs again */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_B, 0, &test_context));
+    TEST_CHECK(false == test_routedB());
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SetAutoRoute(false, 0u, &test_context));
+    TEST_CHECK(true == test_routedB());
+    TEST_CHECK(true == test_coherent());
+    TEST_CHECK_STATUS(Cy_CSDIDAC_GetAutoRouteCounters(&routeWrites, &savedWrites, &test_context));
+    TEST_CHECK(0u != routeWrites);
+    TEST_CHECK(0u != savedWrites);
+
+    /* The joined channel keeps the output of its partner connected */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_JOIN));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SetAutoRoute(true, 0u, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_B, 0, &test_context));
+    TEST_CHECK(true == test_unroutedA());
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_B, 500, &test_context));
+    TEST_CHECK(true == test_routedA());
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_B, 0, &test_context));
+    TEST_CHECK(true == test_unroutedA());
+    TEST_CHECK(true == test_coherent());
+
+    /* The routing writes of the pulsed output */
+    defaultWrites = test_pulses(false);
+    autoWrites = test_pulses(true);
+    TEST_CHECK_STATUS(Cy_CSDIDAC_GetAutoRouteCounters(&routeWrites, &savedWrites, &test_context));
+    (void)printf("%u pulses of %u updates: %u GPIO writes by default, %u with the automatic routing, %u saved\n",
+                 (unsigned)TEST_PULSES, (unsigned)TEST_PULSE_UPDATES, (unsigned)defaultWrites, (unsigned)autoWrites,
+                 (unsigned)savedWrites);
+    TEST_CHECK(autoWrites < defaultWrites);
+
+    return (TEST_RESULT("test_route"));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,220 @@
+/***************************************************************************//**
+* \file test_scan.c
+*
+* \brief
+* The host test of the time-multiplexed pin scan: the context coherence,
+* the drive mode restoration, and the pin switching against a GPIO model,
+* that applies each HSIOM write after a latency in CPU cycles.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_gpio.h"
+#include "cy_csdidac_scan.h"
+
+#define TEST_PIN_NUM                            (4u)
+#define TEST_EVENT_NUM                          (64u)
+#define TEST_MAX_LATENCY                        (4u)
+
+static const cy_stc_csdidac_pin_t test_scanPins[TEST_PIN_NUM] =
+{
+    {&test_port, 3u}, {&test_port, 4u}, {&test_port, 5u}, {&test_port, 6u},
+};
+
+/* The timeline of one pin switch: the IDAC code and the HSIOM of the scanned pins */
+typedef struct
+{
+    uint32_t cycle;
+    uint32_t code;
+    uint32_t hsiom;
+    bool isIdac;
+} test_event_t;
+
+static test_event_t test_events[TEST_EVENT_NUM];
+static uint32_t test_eventCount;
+static uint32_t test_idacWrites;
+
+static uint32_t test_amuxPins(uint32_t hsiom)
+{
+    uint32_t pins = 0u;
+    uint32_t i;
+
+    for (i = 0u; i < TEST_PIN_NUM; i++)
+    {
+        if (HSIOM_SEL_AMUXA == ((hsiom >> CY_STUB_GPIO_FIELD_POS(test_scanPins[i].pin)) & CY_STUB_GPIO_FIELD_MSK))
+        {
+            pins++;
+        }
+    }
+    return (pins);
+}
+
+static void test_record(bool isIdac, uint32_t code)
+{
+    if (test_eventCount < TEST_EVENT_NUM)
+    {
+        test_events[test_eventCount].cycle = cy_stub_cycles;
+        test_events[test_eventCount].code = code;
+        test_events[test_eventCount].hsiom = test_port.HSIOM;
+        test_events[test_eventCount].isIdac = isIdac;
+        test_eventCount++;
+    }
+}
+
+static void test_csdWriteHook(const CSD_Type * base, uint32_t offset, uint32_t value)
+{
+    (void)base;
+    if (CY_CSD_REG_OFFSET_IDACA == offset)
+    {
+        test_idacWrites++;
+        test_record(true, value & CY_CSDIDAC_MAX_CODE);
+    }
+}
+
+static void test_gpioWriteHook(void)
+{
+    test_record(false, 0u);
+}
+
+/*
+* Replays the recorded switch with each HSIOM write applied after the latency
+* and returns the number of cycles, when a nonzero code is driven to other
+* than one pin: an interrupted or a shared output current.
+*/
+static uint32_t test_glitchCycles(uint32_t latency, uint32_t initialHsiom, uint32_t initialCode)
+{
+    uint32_t glitch = 0u;
+    uint32_t code = initialCode;
+    uint32_t hsiom = initialHsiom;
+    uint32_t end = test_events[test_eventCount - 1u].cycle + latency;
+    uint32_t cycle;
+    uint32_t i;
+
+    for (cycle = test_events[0u].cycle; cycle <= end; cycle++)
+    {
+        for (i = 0u; i < test_eventCount; i++)
+        {
+            if ((true == test_events[i].isIdac) && (test_events[i].cycle == cycle))
+            {
+                code = test_events[i].code;
+            }
+            if ((false == test_events[i].isIdac) && ((test_events[i].cycle + latency) == cycle))
+            {
+                hsiom = test_events[i].hsiom;
+            }
+        }
+        if ((0u != code) && (1u != test_amuxPins(hsiom)))
+        {
+            glitch++;
+        }
+    }
+
+    return (glitch);
+}
+
+int main(void)
+{
+    cy_stc_csdidac_scan_config_t scanConfig = {CY_CSDIDAC_A, test_scanPins, TEST_PIN_NUM};
+    cy_stc_csdidac_scan_t scan;
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t code;
+    uint32_t hsiom;
+    uint32_t startCycles;
+    uint32_t i;
+    uint32_t j;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ScanInit(&scanConfig, &scan, &test_context));
+    for (i = 0u; i < TEST_PIN_NUM; i++)
+    {
+        TEST_CHECK_STATUS(Cy_CSDIDAC_ScanSetCurrent(i, (int32_t)((i + 1u) * 1000u) * ((0u == (i & 1u)) ? 1 : -1), &scan));
+        Cy_GPIO_SetDrivemode(test_scanPins[i].ioPcPtr, test_scanPins[i].pin,
+                             (0u == (i & 1u)) ? CY_GPIO_DM_STRONG_IN_OFF : CY_GPIO_DM_HIGHZ);
+    }
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ScanSelect(0u, &scan));
+
+    /* The scan enables the channel and keeps the configuration intact */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ScanStart(&scan));
+    TEST_CHECK(&test_pinA == test_context.cfgCopy.ptrPinA);
+    TEST_CHECK(CY_CSDIDAC_ENABLE == test_context.channelStateA);
+    TEST_CHECK(HSIOM_SEL_GPIO == Cy_GPIO_GetHSIOM(test_pinA.ioPcPtr, test_pinA.pin));
+    TEST_CHECK(1u == test_amuxPins(test_port.HSIOM));
+    TEST_CHECK(0u != TEST_SW_BYP_SEL);
+
+    cy_stub_csdWriteHook = &test_csdWriteHook;
+    cy_stub_gpioWriteHook = &test_gpioWriteHook;
+    for (i = 0u; i < (3u * TEST_PIN_NUM); i++)
+    {
+        uint32_t index = (i + 1u) % TEST_PIN_NUM;
+        uint32_t initialHsiom = test_port.HSIOM;
+        uint32_t initialCode = TEST_IDACA & CY_CSDIDAC_MAX_CODE;
+
+        test_eventCount = 0u;
+        test_idacWrites = 0u;
+        startCycles = cy_stub_cycles;
+        Cy_CSDIDAC_ScanNext(&scan);
+
+        /* The context follows the connected pin */
+        TEST_CHECK(index == scan.index);
+        TEST_CHECK(scan.idacRegValue[index] == TEST_IDACA);
+        TEST_CHECK(scan.idacRegValue[index] == test_context.idacRegValueA);
+        TEST_CHECK(HSIOM_SEL_AMUXA == Cy_GPIO_GetHSIOM(test_scanPins[index].ioPcPtr, test_scanPins[index].pin));
+        TEST_CHECK(1u == test_amuxPins(test_port.HSIOM));
+        TEST_CHECK(2u == test_idacWrites);
+
+        /* No current is interrupted or shared if the HSIOM write takes effect within the bus write */
+        TEST_CHECK(0u == test_glitchCycles(0u, initialHsiom, initialCode));
+        TEST_CHECK(0u == test_glitchCycles(1u, initialHsiom, initialCode));
+        if (0u == i)
+        {
+            (void)printf("switch: %u cycles, %u IDAC writes, %u events\n",
+                         (unsigned)(cy_stub_cycles - startCycles), (unsigned)test_idacWrites, (unsigned)test_eventCount);
+            for (j = 0u; j <= TEST_MAX_LATENCY; j++)
+            {
+                (void)printf("  HSIOM latency %u cycles: %u glitch cycles\n",
+                             (unsigned)j, (unsigned)test_glitchCycles(j, initialHsiom, initialCode));
+            }
+        }
+    }
+    cy_stub_csdWriteHook = NULL;
+    cy_stub_gpioWriteHook = NULL;
+
+    /* The selected pin and the setpoint update of the connected pin */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ScanSelect(2u, &scan));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ScanSetCurrent(2u, 20000, &scan));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_GetOutputSettings(CY_CSDIDAC_A, &polarity, &lsbIndex, &code, &test_context));
+    TEST_CHECK(CY_CSDIDAC_SOURCE == polarity);
+    TEST_CHECK(scan.idacRegValue[2u] == Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, code));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_GetOutputSettings(CY_CSDIDAC_AB, &polarity, &lsbIndex, &code, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_GetOutputSettings(CY_CSDIDAC_A, &polarity, &lsbIndex, NULL, &test_context));
+    TEST_CHECK(scan.idacRegValue[2u] == TEST_IDACA);
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ScanSelect(TEST_PIN_NUM, &scan));
+
+    /* The stop disconnects the pins and restores their drive modes */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_ScanStop(&scan));
+    TEST_CHECK(CY_CSDIDAC_DISABLE == test_context.channelStateA);
+    TEST_CHECK(0u == (test_context.idacRegValueA & CY_CSDIDAC_MAX_CODE));
+    TEST_CHECK(0u == (TEST_IDACA & CY_CSDIDAC_MAX_CODE));
+    hsiom = test_port.HSIOM;
+    TEST_CHECK(0u == test_amuxPins(hsiom));
+    for (i = 0u; i < TEST_PIN_NUM; i++)
+    {
+        TEST_CHECK(((0u == (i & 1u)) ? CY_GPIO_DM_STRONG_IN_OFF : CY_GPIO_DM_HIGHZ) ==
+                   Cy_GPIO_GetDrivemode(test_scanPins[i].ioPcPtr, test_scanPins[i].pin));
+    }
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_ScanStop(&scan));
+
+    /* The configured pin works after the scan */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 5000, &test_context));
+    TEST_CHECK(HSIOM_SEL_AMUXA == Cy_GPIO_GetHSIOM(test_pinA.ioPcPtr, test_pinA.pin));
+    TEST_CHECK(0u == test_amuxPins(test_port.HSIOM));
+
+    return (TEST_RESULT("test_scan"));
+}
@@ -0,0 +1,196 @@
+/***************************************************************************//**
+* \file test_seq.c
+*
+* \brief
+* The host test of the current sequencer: the verification of the sequences
+* including the zero-duration loop bodies, the calculated duration against
+* the executed ticks, the ramps, the IDAC register writes per tick, and
+* the coherence of the CSDIDAC context with the output.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_csdidac_seq.h"
+
+#define TEST_BUFFER_SIZE                        (32u)
+#define TEST_LENGTH(program)                    ((uint32_t)(sizeof(program) / sizeof((program)[0u])))
+
+static const uint32_t test_program[] =
+{
+    CY_CSDIDAC_SEQ_SET_CURRENT(20000),
+    CY_CSDIDAC_SEQ_WAIT(5u),
+    CY_CSDIDAC_SEQ_LOOP(3u),
+        CY_CSDIDAC_SEQ_SET_RAW(CY_CSDIDAC_SINK, CY_CSDIDAC_LSB_2400_IDX, 10u),
+        CY_CSDIDAC_SEQ_RAMP(100u, 7u),
+        CY_CSDIDAC_SEQ_LOOP(2u),
+            CY_CSDIDAC_SEQ_RAMP(3u, 200u),
+            CY_CSDIDAC_SEQ_WAIT(2u),
+        CY_CSDIDAC_SEQ_LOOP_END,
+    CY_CSDIDAC_SEQ_LOOP_END,
+    CY_CSDIDAC_SEQ_SET_CURRENT(-1000),
+    CY_CSDIDAC_SEQ_DISABLE,
+    CY_CSDIDAC_SEQ_END,
+};
+
+#define TEST_PROGRAM_DURATION                   (5u + (3u * (7u + (2u * (200u + 2u)))))
+
+/* The loop body without WAIT or RAMP would run all its iterations in one tick */
+static const uint32_t test_zeroLoop[] =
+{
+    CY_CSDIDAC_SEQ_LOOP(0x0FFFFFFFu),
+        CY_CSDIDAC_SEQ_SET_CURRENT(1000),
+        CY_CSDIDAC_SEQ_DISABLE,
+    CY_CSDIDAC_SEQ_LOOP_END,
+    CY_CSDIDAC_SEQ_END,
+};
+
+/* The outer body takes its ticks in the nested loop */
+static const uint32_t test_nestedLoop[] =
+{
+    CY_CSDIDAC_SEQ_LOOP(4u),
+        CY_CSDIDAC_SEQ_SET_CURRENT(1000),
+        CY_CSDIDAC_SEQ_LOOP(3u),
+            CY_CSDIDAC_SEQ_SET_CURRENT(2000),
+            CY_CSDIDAC_SEQ_WAIT(1u),
+        CY_CSDIDAC_SEQ_LOOP_END,
+        CY_CSDIDAC_SEQ_SET_CURRENT(3000),
+    CY_CSDIDAC_SEQ_LOOP_END,
+    CY_CSDIDAC_SEQ_END,
+};
+
+static const uint32_t test_emptyNested[] =
+{
+    CY_CSDIDAC_SEQ_LOOP(2u),
+        CY_CSDIDAC_SEQ_WAIT(1u),
+        CY_CSDIDAC_SEQ_LOOP(2u),
+            CY_CSDIDAC_SEQ_DISABLE,
+        CY_CSDIDAC_SEQ_LOOP_END,
+    CY_CSDIDAC_SEQ_LOOP_END,
+    CY_CSDIDAC_SEQ_END,
+};
+
+static const uint32_t test_saturated[] =
+{
+    CY_CSDIDAC_SEQ_SET_CURRENT(-609600),
+    CY_CSDIDAC_SEQ_LOOP(0x0FFFFFFFu),
+        CY_CSDIDAC_SEQ_LOOP(0x0FFFFFFFu),
+            CY_CSDIDAC_SEQ_WAIT(0x0FFFFFFFu),
+        CY_CSDIDAC_SEQ_LOOP_END,
+    CY_CSDIDAC_SEQ_LOOP_END,
+    CY_CSDIDAC_SEQ_END,
+};
+
+static uint32_t test_idacWrites;
+
+static void test_csdWriteHook(const CSD_Type * base, uint32_t offset, uint32_t value)
+{
+    (void)base;
+    (void)value;
+    if (CY_CSD_REG_OFFSET_IDACA == offset)
+    {
+        test_idacWrites++;
+    }
+}
+
+/* Runs the loaded sequence and returns the number of ticks until the END instruction */
+static uint32_t test_run(cy_stc_csdidac_seq_t * seq, uint32_t length, uint32_t * maxWrites)
+{
+    uint32_t ticks = 0u;
+
+    *maxWrites = 0u;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SeqStart(seq));
+    cy_stub_csdWriteHook = &test_csdWriteHook;
+    while (true == Cy_CSDIDAC_SeqIsBusy(seq))
+    {
+        test_idacWrites = 0u;
+        Cy_CSDIDAC_SeqTick(seq);
+        ticks++;
+        /* Each instruction is executed at most once per tick */
+        TEST_CHECK(length >= test_idacWrites);
+        *maxWrites = (test_idacWrites > *maxWrites) ? test_idacWrites : *maxWrites;
+        TEST_CHECK(TEST_IDACA == test_context.idacRegValueA);
+    }
+    cy_stub_csdWriteHook = NULL;
+
+    return (ticks);
+}
+
+int main(void)
+{
+    static const uint32_t badWait[] = {CY_CSDIDAC_SEQ_WAIT(0u), CY_CSDIDAC_SEQ_END};
+    static const uint32_t badEnd[] = {CY_CSDIDAC_SEQ_END, CY_CSDIDAC_SEQ_WAIT(1u), CY_CSDIDAC_SEQ_END};
+    static const uint32_t badRaw[] = {CY_CSDIDAC_SEQ_SET_RAW(0u, 0u, 0u) | 0x200u, CY_CSDIDAC_SEQ_END};
+    static const uint32_t badCurrent[] = {CY_CSDIDAC_SEQ_SET_CURRENT(-609601), CY_CSDIDAC_SEQ_END};
+    static const uint32_t badNesting[] = {CY_CSDIDAC_SEQ_LOOP(1u), CY_CSDIDAC_SEQ_WAIT(1u), CY_CSDIDAC_SEQ_END};
+    cy_stc_csdidac_seq_t seq;
+    uint32_t buffer[TEST_BUFFER_SIZE];
+    uint32_t ticks = 0u;
+    uint32_t maxWrites;
+    uint32_t maxStep = 0u;
+    uint32_t previous;
+    uint32_t step;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SeqInit(CY_CSDIDAC_A, &seq, &test_context));
+
+    /* The verification */
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_SeqLoad(test_program, TEST_LENGTH(test_program), NULL, &seq));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_SeqLoad(test_zeroLoop, TEST_LENGTH(test_zeroLoop), buffer, &seq));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_SeqLoad(test_emptyNested, TEST_LENGTH(test_emptyNested), buffer, &seq));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_SeqLoad(badWait, TEST_LENGTH(badWait), buffer, &seq));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_SeqLoad(badEnd, TEST_LENGTH(badEnd), buffer, &seq));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_SeqLoad(badRaw, TEST_LENGTH(badRaw), buffer, &seq));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_SeqLoad(badCurrent, TEST_LENGTH(badCurrent), buffer, &seq));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_SeqLoad(badNesting, TEST_LENGTH(badNesting), buffer, &seq));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SeqLoad(test_saturated, TEST_LENGTH(test_saturated), buffer, &seq));
+    TEST_CHECK(0xFFFFFFFFu == Cy_CSDIDAC_SeqGetDuration(&seq));
+
+    /* The nested loop provides the ticks of the outer body */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SeqLoad(test_nestedLoop, TEST_LENGTH(test_nestedLoop), buffer, &seq));
+    TEST_CHECK(12u == Cy_CSDIDAC_SeqGetDuration(&seq));
+    TEST_CHECK((Cy_CSDIDAC_SeqGetDuration(&seq) + 1u) == test_run(&seq, TEST_LENGTH(test_nestedLoop), &maxWrites));
+    (void)printf("nested loop: %u IDAC writes per tick at most\n", (unsigned)maxWrites);
+
+    /* The executed ticks match the calculated duration, the ramps reach their targets by single steps */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SeqLoad(test_program, TEST_LENGTH(test_program), buffer, &seq));
+    TEST_CHECK(TEST_PROGRAM_DURATION == Cy_CSDIDAC_SeqGetDuration(&seq));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SeqStart(&seq));
+    previous = TEST_IDACA;
+    while (true == Cy_CSDIDAC_SeqIsBusy(&seq))
+    {
+        Cy_CSDIDAC_SeqTick(&seq);
+        ticks++;
+        if (1u == ticks)
+        {
+            TEST_CHECK(Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_300_IDX, 66u) == TEST_IDACA);
+        }
+        if ((5u + 7u) == ticks)
+        {
+            TEST_CHECK(100u == (TEST_IDACA & CY_CSDIDAC_MAX_CODE));
+        }
+        if ((ticks > 6u) && (ticks < TEST_PROGRAM_DURATION))
+        {
+            step = (uint32_t)abs((int)(TEST_IDACA & CY_CSDIDAC_MAX_CODE) - (int)(previous & CY_CSDIDAC_MAX_CODE));
+            maxStep = (step > maxStep) ? step : maxStep;
+        }
+        previous = TEST_IDACA;
+    }
+    (void)printf("program: %u ticks, duration %u, max ramp step %u codes\n",
+                 (unsigned)ticks, (unsigned)Cy_CSDIDAC_SeqGetDuration(&seq), (unsigned)maxStep);
+    TEST_CHECK((TEST_PROGRAM_DURATION + 1u) == ticks);
+    TEST_CHECK(0u == TEST_IDACA);
+    TEST_CHECK(0u == (test_context.idacRegValueA & CY_CSDIDAC_MAX_CODE));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SeqStop(&seq));
+    TEST_CHECK(CY_CSDIDAC_DISABLE == test_context.channelStateA);
+
+    return (TEST_RESULT("test_seq"));
+}
+
+
+/* [] END OF FILE */
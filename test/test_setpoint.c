@@ -0,0 +1,114 @@
+/***************************************************************************//**
+* \file test_setpoint.c
+*
+* \brief
+* The host benchmark of the prepared setpoint commit against
+* Cy_CSDIDAC_OutputEnable() for the same current sequence: the register
+* accesses, the simulated cycles, and the host time per update. The test
+* also checks, that both paths produce the same output and context.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_csdidac_setpoint.h"
+
+#define TEST_SETPOINT_NUM                       (16u)
+#define TEST_ROUNDS                             (100000u)
+
+/* The access counts and the host time of one update path */
+typedef struct
+{
+    uint32_t csdWrites;
+    uint32_t gpioWrites;
+    uint32_t cycles;
+    uint64_t timeNs;
+} test_cost_t;
+
+static int32_t test_currents[TEST_SETPOINT_NUM];
+
+static void test_report(const char * name, const test_cost_t * cost)
+{
+    (void)printf("%-16s %5.2f CSD writes, %5.2f GPIO writes, %6.2f cycles, %6.1f ns per update\n", name,
+                 (double)cost->csdWrites / (double)(TEST_ROUNDS * TEST_SETPOINT_NUM),
+                 (double)cost->gpioWrites / (double)(TEST_ROUNDS * TEST_SETPOINT_NUM),
+                 (double)cost->cycles / (double)(TEST_ROUNDS * TEST_SETPOINT_NUM),
+                 (double)cost->timeNs / (double)(TEST_ROUNDS * TEST_SETPOINT_NUM));
+}
+
+int main(void)
+{
+    cy_stc_csdidac_setpoint_t setpoints[TEST_SETPOINT_NUM];
+    test_cost_t enableCost;
+    test_cost_t commitCost;
+    uint32_t registers[TEST_SETPOINT_NUM];
+    uint64_t startNs;
+    uint32_t round;
+    uint32_t i;
+
+    for (i = 0u; i < TEST_SETPOINT_NUM; i++)
+    {
+        test_currents[i] = (int32_t)((i * 39871u) % CY_CSDIDAC_MAX_CURRENT_NA) * ((0u == (i & 1u)) ? 1 : -1);
+    }
+
+    /* The reference: the output enable of each current */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    for (i = 0u; i < TEST_SETPOINT_NUM; i++)
+    {
+        TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, test_currents[i], &test_context));
+        registers[i] = TEST_IDACA;
+    }
+    cy_stub_reset();
+    startNs = test_timeNs();
+    for (round = 0u; round < TEST_ROUNDS; round++)
+    {
+        for (i = 0u; i < TEST_SETPOINT_NUM; i++)
+        {
+            (void)Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, test_currents[i], &test_context);
+        }
+    }
+    enableCost.timeNs = test_timeNs() - startNs;
+    enableCost.csdWrites = cy_stub_csdWrites;
+    enableCost.gpioWrites = cy_stub_gpioWrites;
+    enableCost.cycles = cy_stub_cycles;
+
+    /* The prepared setpoints committed to the enabled output */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 0, &test_context));
+    for (i = 0u; i < TEST_SETPOINT_NUM; i++)
+    {
+        TEST_CHECK_STATUS(Cy_CSDIDAC_SetpointPrepare(CY_CSDIDAC_A, test_currents[i], &setpoints[i], &test_context));
+        Cy_CSDIDAC_SetpointCommit(&setpoints[i]);
+        TEST_CHECK(registers[i] == TEST_IDACA);
+        /* The context is coherent with the committed output */
+        TEST_CHECK(TEST_IDACA == test_context.idacRegValueA);
+    }
+    cy_stub_reset();
+    startNs = test_timeNs();
+    for (round = 0u; round < TEST_ROUNDS; round++)
+    {
+        for (i = 0u; i < TEST_SETPOINT_NUM; i++)
+        {
+            Cy_CSDIDAC_SetpointCommit(&setpoints[i]);
+        }
+    }
+    commitCost.timeNs = test_timeNs() - startNs;
+    commitCost.csdWrites = cy_stub_csdWrites;
+    commitCost.gpioWrites = cy_stub_gpioWrites;
+    commitCost.cycles = cy_stub_cycles;
+
+    test_report("OutputEnable:", &enableCost);
+    test_report("SetpointCommit:", &commitCost);
+
+    /* The commit performs one IDAC register write and no pin configuration */
+    TEST_CHECK((TEST_ROUNDS * TEST_SETPOINT_NUM) == commitCost.csdWrites);
+    TEST_CHECK(0u == commitCost.gpioWrites);
+    TEST_CHECK(commitCost.cycles < enableCost.cycles);
+
+    return (TEST_RESULT("test_setpoint"));
+}
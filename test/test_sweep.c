@@ -0,0 +1,119 @@
+/***************************************************************************//**
+* \file test_sweep.c
+*
+* \brief
+* The host test of the calibration sweep against a simulated IDAC with
+* a gain error, an offset and a bowed transfer curve: the recovered
+* calibration and the coherence of the CSDIDAC context at each sweep point.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_csdidac_sweep.h"
+
+/* The simulated IDAC: the gain in 1/1024 units, the offset in pA, and the bow in 1/1024 LSB */
+#define TEST_GAIN                               (1044)
+#define TEST_OFFSET                             (-5000)
+#define TEST_BOW                                (512)
+#define TEST_DWELL                              (2u)
+
+static uint32_t test_measurements;
+static uint32_t test_incoherent;
+
+/* The bow is zero at the endpoints, so the endpoint fit sees it as INL only */
+static cy_en_csdidac_status_t test_measure(int32_t * current, void * param)
+{
+    uint32_t code = TEST_IDACA & CY_CSDIDAC_MAX_CODE;
+    int64_t ideal = test_regCurrentPa(TEST_IDACA);
+    int64_t lsb = (int64_t)cy_csdidac_lsbPa[Cy_CSDIDAC_GetIdacRegLsb(TEST_IDACA)];
+    int64_t bow = (((int64_t)code * (int64_t)(CY_CSDIDAC_MAX_CODE - code) * 4 * TEST_BOW * lsb) /
+                   ((int64_t)CY_CSDIDAC_MAX_CODE * (int64_t)CY_CSDIDAC_MAX_CODE)) / 1024;
+
+    (void)param;
+    test_measurements++;
+    /* The context describes the measured point */
+    if (TEST_IDACA != test_context.idacRegValueA)
+    {
+        test_incoherent++;
+    }
+    if (0 > ideal)
+    {
+        bow = -bow;
+    }
+    *current = (int32_t)(((ideal * TEST_GAIN) / 1024) + bow + TEST_OFFSET);
+
+    return (CY_CSDIDAC_SUCCESS);
+}
+
+static void test_sweep(cy_en_csdidac_polarity_t polarity, cy_en_csdidac_sweep_order_t order, uint32_t lsbMask)
+{
+    static int32_t results[CY_CSDIDAC_LSB_NUM * CY_CSDIDAC_SWEEP_RANGE_POINTS];
+    cy_stc_csdidac_sweep_config_t sweepConfig =
+    {
+        CY_CSDIDAC_A, polarity, order, lsbMask, TEST_DWELL, &test_measure, NULL, results,
+    };
+    cy_stc_csdidac_range_cal_t cal[CY_CSDIDAC_LSB_NUM];
+    cy_stc_csdidac_sweep_t sweep;
+    uint32_t ranges = 0u;
+    uint32_t calls = 0u;
+    uint32_t i;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SweepInit(&sweepConfig, &sweep, &test_context));
+    test_measurements = 0u;
+    test_incoherent = 0u;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SweepStart(&sweep));
+    TEST_CHECK(CY_CSDIDAC_ENABLE == test_context.channelStateA);
+    while (true == Cy_CSDIDAC_SweepIsBusy(&sweep))
+    {
+        TEST_CHECK_STATUS(Cy_CSDIDAC_SweepProcess(&sweep));
+        calls++;
+    }
+    for (i = 0u; i < CY_CSDIDAC_LSB_NUM; i++)
+    {
+        ranges += (lsbMask >> i) & 1u;
+    }
+    TEST_CHECK((ranges * CY_CSDIDAC_SWEEP_RANGE_POINTS) == test_measurements);
+    TEST_CHECK((ranges * CY_CSDIDAC_SWEEP_RANGE_POINTS * (TEST_DWELL + 1u)) == calls);
+    TEST_CHECK(0u == test_incoherent);
+    TEST_CHECK(CY_CSDIDAC_DISABLE == test_context.channelStateA);
+    TEST_CHECK(0u == (test_context.idacRegValueA & CY_CSDIDAC_MAX_CODE));
+
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SweepGetCalibration(&sweep, cal));
+    for (i = 0u; i < CY_CSDIDAC_LSB_NUM; i++)
+    {
+        if (0u != (lsbMask & (1u << i)))
+        {
+            /* The gain, the offset, and the bow recovered within the rounding */
+            int32_t inl = (0 > cal[i].inl) ? -cal[i].inl : cal[i].inl;
+            int32_t expectedInl = (int32_t)((TEST_BOW << CY_CSDIDAC_CAL_LINEARITY_SHIFT) / TEST_GAIN);
+
+            (void)printf("  %s LSB %u: gain %.4f, offset %d pA, INL %.3f, DNL %.3f LSB\n",
+                         (CY_CSDIDAC_SOURCE == polarity) ? "source" : "sink  ", (unsigned)i,
+                         (double)cal[i].gain / (double)(1u << CY_CSDIDAC_CAL_GAIN_SHIFT), (int)cal[i].offset,
+                         (double)cal[i].inl / (double)(1u << CY_CSDIDAC_CAL_LINEARITY_SHIFT),
+                         (double)cal[i].dnl / (double)(1u << CY_CSDIDAC_CAL_LINEARITY_SHIFT));
+            TEST_CHECK(64u > (uint32_t)abs((int)cal[i].gain - (int)((TEST_GAIN << CY_CSDIDAC_CAL_GAIN_SHIFT) / 1024)));
+            TEST_CHECK(TEST_OFFSET == cal[i].offset);
+            TEST_CHECK(8 >= abs(inl - expectedInl));
+        }
+        else
+        {
+            TEST_CHECK((1u << CY_CSDIDAC_CAL_GAIN_SHIFT) == cal[i].gain);
+        }
+    }
+}
+
+int main(void)
+{
+    test_sweep(CY_CSDIDAC_SOURCE, CY_CSDIDAC_SWEEP_ASCENDING, CY_CSDIDAC_SWEEP_ALL_RANGES);
+    test_sweep(CY_CSDIDAC_SINK, CY_CSDIDAC_SWEEP_DESCENDING, 0x15u);
+
+    return (TEST_RESULT("test_sweep"));
+}
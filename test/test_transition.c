@@ -0,0 +1,204 @@
+/***************************************************************************//**
+* \file test_transition.c
+*
+* \brief
+* The host model of the intermediate output states of the LSB range
+* transitions: the summed current of both IDACs after each register write,
+* the range changes at the zero code only, and the validation of the bridged
+* mode configuration.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_csdidac_transition.h"
+
+#define TEST_RANGE_MSK                          (CY_CSDIDAC_POLARITY_MASK | CY_CSDIDAC_RANGE_MASK)
+
+static const int32_t test_targets[] =
+{
+    0, 1000, 4000, 4762, 4763, 9000, 9525, 20000, 38100, 50000, 76200, 100000, 304800, 400000, 609600,
+};
+
+static const uint32_t test_codes[] = {0u, 1u, 5u, 63u, 64u, 100u, 127u};
+
+/* The model state: the IDAC register values and the summed output current after each write */
+static uint32_t test_regA;
+static uint32_t test_regB;
+static int64_t test_minSum;
+static int64_t test_maxSum;
+static uint32_t test_writes;
+static uint32_t test_maskedWrites;
+static uint32_t test_hotRangeChanges;
+
+static void test_csdWriteHook(const CSD_Type * base, uint32_t offset, uint32_t value)
+{
+    uint32_t * reg = (CY_CSD_REG_OFFSET_IDACA == offset) ? &test_regA : &test_regB;
+    int64_t sum;
+
+    (void)base;
+    if ((CY_CSD_REG_OFFSET_IDACA == offset) || (CY_CSD_REG_OFFSET_IDACB == offset))
+    {
+        /* The range or the polarity is changed only at the zero code */
+        if (((*reg & TEST_RANGE_MSK) != (value & TEST_RANGE_MSK)) &&
+            ((0u != (*reg & CY_CSDIDAC_MAX_CODE)) || (0u != (value & CY_CSDIDAC_MAX_CODE))))
+        {
+            test_hotRangeChanges++;
+        }
+        *reg = value;
+        sum = test_regCurrentPa(test_regA) + test_regCurrentPa(test_regB);
+        test_minSum = (sum < test_minSum) ? sum : test_minSum;
+        test_maxSum = (sum > test_maxSum) ? sum : test_maxSum;
+        test_writes++;
+        if (true == cy_stub_intrMasked)
+        {
+            test_maskedWrites++;
+        }
+    }
+}
+
+static void test_startModel(void)
+{
+    test_regA = TEST_IDACA;
+    test_regB = TEST_IDACB;
+    test_minSum = test_regCurrentPa(test_regA) + test_regCurrentPa(test_regB);
+    test_maxSum = test_minSum;
+    test_writes = 0u;
+    test_maskedWrites = 0u;
+    test_hotRangeChanges = 0u;
+    cy_stub_csdWriteHook = &test_csdWriteHook;
+}
+
+static int64_t test_abs(int64_t value)
+{
+    return ((0 > value) ? -value : value);
+}
+
+int main(void)
+{
+    cy_en_csdidac_polarity_t polarity;
+    cy_en_csdidac_lsb_t lsbIndex;
+    uint32_t code;
+    uint32_t oldLsb;
+    uint32_t newLsb;
+    uint32_t newRegValue;
+    int64_t oldSum;
+    int64_t newSum;
+    int64_t lo;
+    int64_t hi;
+    int64_t overshoot;
+    int64_t dip;
+    double maxDip = 0.0;
+    uint32_t maxWrites = 0u;
+    uint32_t maxMasked = 0u;
+    uint32_t transitions = 0u;
+    uint32_t sign;
+    uint32_t lsb;
+    uint32_t i;
+    uint32_t j;
+
+    /* The bridged mode needs the joined output channel and the idle channel, that provides the output */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_GPIO));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_B, 1000, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_OutputTransition(CY_CSDIDAC_B, 100000, CY_CSDIDAC_TRANSITION_BRIDGED, &test_context));
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_JOIN));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 1000, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_OutputTransition(CY_CSDIDAC_A, 100000, CY_CSDIDAC_TRANSITION_BRIDGED, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_B, 1000, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_OutputTransition(CY_CSDIDAC_B, 100000, CY_CSDIDAC_TRANSITION_BRIDGED, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_OutputTransition(CY_CSDIDAC_B, INT32_MIN, CY_CSDIDAC_TRANSITION_DIRECT, &test_context));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_OutputTransition(CY_CSDIDAC_AB, 1000, CY_CSDIDAC_TRANSITION_DIRECT, &test_context));
+
+    /* Each start range and code to each target current of both polarities */
+    for (sign = 0u; sign < 2u; sign++)
+    {
+        for (lsb = 0u; lsb < CY_CSDIDAC_LSB_NUM; lsb++)
+        {
+            for (i = 0u; i < (sizeof(test_codes) / sizeof(test_codes[0u])); i++)
+            {
+                for (j = 0u; j < (sizeof(test_targets) / sizeof(test_targets[0u])); j++)
+                {
+                    int32_t target = (0u == sign) ? test_targets[j] : -test_targets[j];
+
+                    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_JOIN));
+                    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnableExt(CY_CSDIDAC_B, (0u == sign) ? CY_CSDIDAC_SOURCE : CY_CSDIDAC_SINK,
+                                                                 (cy_en_csdidac_lsb_t)lsb, test_codes[i], &test_context));
+                    Cy_CSDIDAC_ConvertCurrent(target, &polarity, &lsbIndex, &code);
+                    newRegValue = Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, code);
+                    oldSum = test_regCurrentPa(TEST_IDACB);
+                    newSum = test_regCurrentPa(newRegValue);
+                    oldLsb = cy_csdidac_lsbPa[lsb];
+                    newLsb = cy_csdidac_lsbPa[lsbIndex];
+
+                    test_startModel();
+                    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputTransition(CY_CSDIDAC_B, target, CY_CSDIDAC_TRANSITION_BRIDGED, &test_context));
+                    cy_stub_csdWriteHook = NULL;
+                    transitions++;
+                    maxWrites = (test_writes > maxWrites) ? test_writes : maxWrites;
+                    maxMasked = (test_maskedWrites > maxMasked) ? test_maskedWrites : maxMasked;
+
+                    /* The output never exceeds the larger current */
+                    lo = (test_abs(oldSum) < test_abs(newSum)) ? test_abs(oldSum) : test_abs(newSum);
+                    hi = (test_abs(oldSum) > test_abs(newSum)) ? test_abs(oldSum) : test_abs(newSum);
+                    overshoot = ((0u == sign) ? test_maxSum : -test_minSum) - hi;
+                    TEST_CHECK(overshoot <= 0);
+
+                    /* The dip is limited to one LSB of the coarser range */
+                    dip = lo - ((0u == sign) ? test_minSum : -test_maxSum);
+                    TEST_CHECK(dip <= (int64_t)((oldLsb > newLsb) ? oldLsb : newLsb));
+                    if ((0 < dip) && (((double)dip / (double)((oldLsb > newLsb) ? oldLsb : newLsb)) > maxDip))
+                    {
+                        maxDip = (double)dip / (double)((oldLsb > newLsb) ? oldLsb : newLsb);
+                    }
+                    TEST_CHECK(0u == test_hotRangeChanges);
+
+                    /* The final state: the target on the output IDAC, the idle IDAC cleared and disabled */
+                    TEST_CHECK(newRegValue == TEST_IDACB);
+                    TEST_CHECK(0u == TEST_IDACA);
+                    TEST_CHECK(CY_CSDIDAC_DISABLE == test_context.channelStateA);
+                    TEST_CHECK(0u == test_context.idacRegValueA);
+                    TEST_CHECK(TEST_IDACB == test_context.idacRegValueB);
+                }
+            }
+        }
+    }
+    (void)printf("bridged: %u transitions, max %u IDAC writes, max %u masked writes, max dip %.2f coarser LSB\n",
+                 (unsigned)transitions, (unsigned)maxWrites, (unsigned)maxMasked, maxDip);
+
+    /* The polarity change passes the zero current monotonically */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_JOIN));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_B, 300000, &test_context));
+    test_startModel();
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputTransition(CY_CSDIDAC_B, -2000, CY_CSDIDAC_TRANSITION_BRIDGED, &test_context));
+    cy_stub_csdWriteHook = NULL;
+    TEST_CHECK(test_regCurrentPa(TEST_IDACB) == test_minSum);
+    TEST_CHECK(test_maxSum <= 300000000);
+    TEST_CHECK(0u == test_hotRangeChanges);
+
+    /* The direct mode keeps each intermediate current between the old and the new ones */
+    for (i = 0u; i < (sizeof(test_targets) / sizeof(test_targets[0u])); i++)
+    {
+        for (j = 0u; j < (sizeof(test_targets) / sizeof(test_targets[0u])); j++)
+        {
+            TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+            TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, test_targets[i], &test_context));
+            oldSum = test_regCurrentPa(TEST_IDACA);
+            test_startModel();
+            TEST_CHECK_STATUS(Cy_CSDIDAC_OutputTransition(CY_CSDIDAC_A, test_targets[j], CY_CSDIDAC_TRANSITION_DIRECT, &test_context));
+            cy_stub_csdWriteHook = NULL;
+            newSum = test_regCurrentPa(TEST_IDACA);
+            TEST_CHECK(((oldSum < newSum) ? oldSum : newSum) == test_minSum);
+            TEST_CHECK(((oldSum > newSum) ? oldSum : newSum) == test_maxSum);
+        }
+    }
+
+    return (TEST_RESULT("test_transition"));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,153 @@
+/***************************************************************************//**
+* \file test_verify.c
+*
+* \brief
+* The host test of the write-verify mode: the sampling ratio, the detection
+* of the corrupted IDAC register, the open bypass switch, and the lost CSD
+* lock, the read-and-clear status, the callback after the critical section,
+* and the simulated cycles added per IDAC register write for several ratios.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include "test_common.h"
+#include "cy_csdidac_setpoint.h"
+#include "cy_csdidac_join.h"
+
+#define TEST_COMMITS                            (10000u)
+
+static const uint32_t test_ratios[] = {0u, 1u, 4u, 16u};
+
+static uint32_t test_calls;
+static cy_en_csdidac_status_t test_lastStatus;
+static cy_en_csdidac_choice_t test_lastCh;
+static bool test_corrupt;
+static bool test_callbackMasked;
+
+static void test_callback(cy_en_csdidac_status_t status, cy_en_csdidac_choice_t ch, void * param)
+{
+    (void)param;
+    test_calls++;
+    test_lastStatus = status;
+    test_lastCh = ch;
+    test_callbackMasked |= cy_stub_intrMasked;
+}
+
+/* Flips the code LSB of the IDAC A register after the write, as a disturbed register */
+static void test_csdWriteHook(const CSD_Type * base, uint32_t offset, uint32_t value)
+{
+    (void)base;
+    (void)value;
+    if ((true == test_corrupt) && (CY_CSD_REG_OFFSET_IDACA == offset))
+    {
+        TEST_IDACA ^= 1u;
+    }
+}
+
+int main(void)
+{
+    cy_stc_csdidac_setpoint_t setpoint;
+    cy_stc_csdidac_join_t join;
+    uint32_t cycles[sizeof(test_ratios) / sizeof(test_ratios[0u])];
+    uint32_t i;
+    uint32_t j;
+
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_AMUX));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_SetVerify(1u, &test_callback, NULL, NULL));
+    TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_GetVerifyStatus(NULL));
+
+    /* No mismatch without the disturbance */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SetVerify(3u, &test_callback, NULL, &test_context));
+    for (i = 0u; i < 9u; i++)
+    {
+        TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 1000, &test_context));
+    }
+    TEST_CHECK(0u == test_calls);
+    TEST_CHECK_STATUS(Cy_CSDIDAC_GetVerifyStatus(&test_context));
+
+    /* Each third write is verified */
+    cy_stub_csdWriteHook = &test_csdWriteHook;
+    test_corrupt = true;
+    for (i = 0u; i < 6u; i++)
+    {
+        TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 1000, &test_context));
+    }
+    test_corrupt = false;
+    cy_stub_csdWriteHook = NULL;
+    TEST_CHECK(2u == test_calls);
+    TEST_CHECK(CY_CSDIDAC_HW_FAILURE == test_lastStatus);
+    TEST_CHECK(CY_CSDIDAC_A == test_lastCh);
+
+    /* The status is the first mismatch and is cleared by the read */
+    TEST_CHECK(CY_CSDIDAC_HW_FAILURE == Cy_CSDIDAC_GetVerifyStatus(&test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_GetVerifyStatus(&test_context));
+
+    /* The open bypass switch of the enabled output */
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SetVerify(1u, &test_callback, NULL, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_B, -2000, &test_context));
+    TEST_CHECK(2u == test_calls);
+    TEST_SW_BYP_SEL = 0u;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SetpointPrepare(CY_CSDIDAC_B, -3000, &setpoint, &test_context));
+    Cy_CSDIDAC_SetpointCommit(&setpoint);
+    TEST_CHECK(3u == test_calls);
+    TEST_CHECK(CY_CSDIDAC_HW_FAILURE == test_lastStatus);
+    TEST_CHECK(CY_CSDIDAC_B == test_lastCh);
+    TEST_CHECK(CY_CSDIDAC_HW_FAILURE == Cy_CSDIDAC_GetVerifyStatus(&test_context));
+
+    /* The CSD HW block taken by other middleware */
+    test_csdContext.lockKey = CY_CSD_NONE_KEY;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_B, -500, &test_context));
+    TEST_CHECK(CY_CSDIDAC_HW_LOCKED == test_lastStatus);
+    TEST_CHECK(CY_CSDIDAC_HW_LOCKED == Cy_CSDIDAC_GetVerifyStatus(&test_context));
+
+    /* The mismatch of the write in the critical section is reported after its exit */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_JOIN));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SetVerify(1u, &test_callback, NULL, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_JoinInit(&join, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_JoinStart(&join));
+    test_calls = 0u;
+    test_callbackMasked = false;
+    cy_stub_csdWriteHook = &test_csdWriteHook;
+    test_corrupt = true;
+    TEST_CHECK_STATUS(Cy_CSDIDAC_JoinSet(3000, &join));
+    test_corrupt = false;
+    cy_stub_csdWriteHook = NULL;
+    TEST_CHECK(1u == test_calls);
+    TEST_CHECK(false == test_callbackMasked);
+    TEST_CHECK(CY_CSDIDAC_HW_FAILURE == test_lastStatus);
+    TEST_CHECK(CY_CSDIDAC_A == test_lastCh);
+    TEST_CHECK(CY_CSDIDAC_HW_FAILURE == Cy_CSDIDAC_GetVerifyStatus(&test_context));
+
+    /* The verification cost of the setpoint commit, one IDAC register write */
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_DISABLED));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_OutputEnable(CY_CSDIDAC_A, 1000, &test_context));
+    TEST_CHECK_STATUS(Cy_CSDIDAC_SetpointPrepare(CY_CSDIDAC_A, 20000, &setpoint, &test_context));
+    test_calls = 0u;
+    for (i = 0u; i < (sizeof(test_ratios) / sizeof(test_ratios[0u])); i++)
+    {
+        TEST_CHECK_STATUS(Cy_CSDIDAC_SetVerify(test_ratios[i], &test_callback, NULL, &test_context));
+        cy_stub_reset();
+        for (j = 0u; j < TEST_COMMITS; j++)
+        {
+            Cy_CSDIDAC_SetpointCommit(&setpoint);
+        }
+        cycles[i] = cy_stub_cycles;
+        (void)printf("ratio %2u: %.2f cycles per IDAC register write\n",
+                     (unsigned)test_ratios[i], (double)cycles[i] / (double)TEST_COMMITS);
+    }
+    TEST_CHECK(0u == test_calls);
+    /* The verification reads the IDAC and the bypass switch registers */
+    TEST_CHECK((cycles[0u] + (2u * TEST_COMMITS)) == cycles[1u]);
+    TEST_CHECK(cycles[2u] < cycles[1u]);
+    TEST_CHECK(cycles[3u] < cycles[2u]);
+
+    return (TEST_RESULT("test_verify"));
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,198 @@
+/***************************************************************************//**
+* \file test_wave.c
+*
+* \brief
+* The host test of the compressed waveform codec and player: the round trip
+* of the encoder, the decoder, and the player against the source samples,
+* the compression ratio, the simulated cycles per played sample, and
+* the rejection of the invalid samples and waveforms.
+*
+********************************************************************************
+* \copyright
+* Copyright 2020, Cypress Semiconductor Corporation.  All rights reserved.
+* You may use this file only in accordance with the license, terms, conditions,
+* disclaimers, and limitations in the end user license agreement accompanying
+* the software package with which this file was provided.
+*******************************************************************************/
+
+#include <math.h>
+#include "test_common.h"
+#include "cy_csdidac_wave.h"
+
+#define TEST_SAMPLES                            (20000u)
+#define TEST_TRIALS                             (50u)
+#define TEST_SINE_AMPLITUDE                     (300000.0)
+
+static uint32_t test_samples[TEST_SAMPLES];
+static uint32_t test_decoded[TEST_SAMPLES];
+static uint8_t test_data[3u * TEST_SAMPLES];
+
+/* The first trial is a sine wave, the others are random walks with the steps, the holds, and the range changes */
+static void test_generate(uint32_t trial)
+{
+    cy_en_csdidac_polarity_t polarity = CY_CSDIDAC_SOURCE;
+    cy_en_csdidac_lsb_t lsbIndex = CY_CSDIDAC_LSB_300_IDX;
+    uint32_t code = 60u;
+    int32_t step;
+    uint32_t r;
+    uint32_t i;
+
+    for (i = 0u; i < TEST_SAMPLES; i++)
+    {
+        if (0u == trial)
+        {
+            Cy_CSDIDAC_ConvertCurrent((int32_t)(TEST_SINE_AMPLITUDE * sin((double)i * 0.01)), &polarity, &lsbIndex, &code);
+        }
+        else
+        {
+            r = (uint32_t)rand() % 100u;
+            if (2u > r)
+            {
+                polarity = (cy_en_csdidac_polarity_t)((uint32_t)rand() % 2u);
+                lsbIndex = (cy_en_csdidac_lsb_t)((uint32_t)rand() % CY_CSDIDAC_LSB_NUM);
+                code = (uint32_t)rand() % (CY_CSDIDAC_MAX_CODE + 1u);
+            }
+            else if (50u <= r)
+            {
+                step = (int32_t)code + (rand() % 41) - 20;
+                code = (uint32_t)((0 > step) ? 0 : ((int32_t)CY_CSDIDAC_MAX_CODE < step) ? (int32_t)CY_CSDIDAC_MAX_CODE : step);
+            }
+            else
+            {
+                /* The sample is held */
+            }
+        }
+        test_samples[i] = Cy_CSDIDAC_GetIdacRegValue(polarity, lsbIndex, code);
+    }
+}
+
+int main(void)
+{
+    static const uint8_t badEmpty[] = {0xFFu};
+    static const uint8_t badDelta[] = {0xC0u, 5u, 0x40u, 0xFFu};
+    static const uint8_t badLsb[] = {0xC6u, 5u, 0xFFu};
+    static const uint8_t badEnd[] = {0xC0u, 5u};
+    static const uint8_t badCode[] = {0xC0u, 128u, 0xFFu};
+    static const uint8_t badFirst[] = {0x80u, 0xFFu};
+    static const uint8_t badReserved[] = {0xD0u, 5u, 0xFFu};
+    static const uint8_t * const badData[] = {badEmpty, badDelta, badLsb, badEnd, badCode, badFirst, badReserved};
+    static const uint32_t badSize[] =
+    {
+        sizeof(badEmpty), sizeof(badDelta), sizeof(badLsb), sizeof(badEnd), sizeof(badCode), sizeof(badFirst), sizeof(badReserved),
+    };
+    cy_stc_csdidac_wave_config_t waveConfig;
+    cy_stc_csdidac_wave_t wave;
+    uint32_t badSamples[3u];
+    uint32_t length;
+    uint32_t totalLength = 0u;
+    uint32_t trial;
+    uint32_t repeat;
+    uint32_t mismatches;
+    uint32_t cycles;
+    uint32_t maxCycles = 0u;
+    uint64_t totalCycles = 0u;
+    uint64_t ticks = 0u;
+    uint64_t decodeNs = 0u;
+    uint64_t startNs;
+    uint32_t i;
+
+    srand(3u);
+    TEST_CHECK_STATUS(test_init(CY_CSDIDAC_GPIO, CY_CSDIDAC_GPIO));
+    for (trial = 0u; trial < TEST_TRIALS; trial++)
+    {
+        test_generate(trial);
+        length = Cy_CSDIDAC_WaveEncode(test_samples, TEST_SAMPLES, test_data, sizeof(test_data));
+        TEST_CHECK(0u != length);
+        totalLength += length;
+
+        /* The decoder round trip */
+        (void)memset(test_decoded, 0, sizeof(test_decoded));
+        startNs = test_timeNs();
+        TEST_CHECK(TEST_SAMPLES == Cy_CSDIDAC_WaveDecode(test_data, length, test_decoded, TEST_SAMPLES));
+        decodeNs += test_timeNs() - startNs;
+        TEST_CHECK(0 == memcmp(test_samples, test_decoded, sizeof(test_samples)));
+        TEST_CHECK(0u == Cy_CSDIDAC_WaveDecode(test_data, length, test_decoded, TEST_SAMPLES - 1u));
+        TEST_CHECK(TEST_SAMPLES == Cy_CSDIDAC_WaveDecode(test_data, length, NULL, 0u));
+
+        /* The player round trip, the looped waveform is played twice */
+        waveConfig.ch = CY_CSDIDAC_B;
+        waveConfig.ptrData = test_data;
+        waveConfig.size = length;
+        waveConfig.loop = (0u != (trial & 1u));
+        TEST_CHECK_STATUS(Cy_CSDIDAC_WaveInit(&waveConfig, &wave, &test_context));
+        TEST_CHECK(TEST_SAMPLES == Cy_CSDIDAC_WaveGetSampleCount(&wave));
+        TEST_CHECK_STATUS(Cy_CSDIDAC_WaveStart(&wave));
+        mismatches = 0u;
+        for (repeat = 0u; repeat < ((true == waveConfig.loop) ? 2u : 1u); repeat++)
+        {
+            for (i = 0u; i < TEST_SAMPLES; i++)
+            {
+                cycles = cy_stub_cycles;
+                Cy_CSDIDAC_WaveTick(&wave);
+                cycles = cy_stub_cycles - cycles;
+                totalCycles += cycles;
+                maxCycles = (cycles > maxCycles) ? cycles : maxCycles;
+                ticks++;
+                if ((test_samples[i] != TEST_IDACB) ||
+                    (TEST_IDACB != test_context.idacRegValueB))
+                {
+                    mismatches++;
+                }
+            }
+        }
+        TEST_CHECK(0u == mismatches);
+        if (false == waveConfig.loop)
+        {
+            Cy_CSDIDAC_WaveTick(&wave);
+            TEST_CHECK(false == Cy_CSDIDAC_WaveIsBusy(&wave));
+            TEST_CHECK(test_samples[TEST_SAMPLES - 1u] == TEST_IDACB);
+        }
+        TEST_CHECK_STATUS(Cy_CSDIDAC_WaveStop(&wave));
+
+        if (2u > trial)
+        {
+            (void)printf("%s: %u bytes for %u samples, ratio %.2f to the register values\n",
+                         (0u == trial) ? "sine" : "random walk", (unsigned)length, (unsigned)TEST_SAMPLES,
+                         (double)(4u * TEST_SAMPLES) / (double)length);
+        }
+
+        /* The buffer too small for the END token */
+        TEST_CHECK(0u == Cy_CSDIDAC_WaveEncode(test_samples, TEST_SAMPLES, test_data, length - 1u));
+    }
+    (void)printf("all trials: ratio %.2f, player %.2f cycles per sample (max %u), decoder %.1f ns per sample\n",
+                 (double)(4u * TEST_SAMPLES * TEST_TRIALS) / (double)totalLength,
+                 (double)totalCycles / (double)ticks, (unsigned)maxCycles,
+                 (double)decodeNs / (double)(TEST_SAMPLES * TEST_TRIALS));
+    /* At most one IDAC register write per sample */
+    TEST_CHECK(1u >= maxCycles);
+
+    /* The invalid samples: no leg1, the reserved LSB field, and the bits other than the sample fields */
+    badSamples[0u] = Cy_CSDIDAC_GetIdacRegValue(CY_CSDIDAC_SOURCE, CY_CSDIDAC_LSB_37_IDX, 1u);
+    badSamples[1u] = badSamples[0u];
+    badSamples[2u] = badSamples[0u];
+    TEST_CHECK(0u != Cy_CSDIDAC_WaveEncode(badSamples, 3u, test_data, sizeof(test_data)));
+    badSamples[2u] &= ~CY_CSDIDAC_LEG1_EN_MASK;
+    TEST_CHECK(0u == Cy_CSDIDAC_WaveEncode(badSamples, 3u, test_data, sizeof(test_data)));
+    badSamples[2u] = badSamples[0u] | CY_CSDIDAC_LSB_MASK;
+    TEST_CHECK(0u == Cy_CSDIDAC_WaveEncode(badSamples, 3u, test_data, sizeof(test_data)));
+    badSamples[2u] = badSamples[0u] | (1uL << 9u);
+    TEST_CHECK(0u == Cy_CSDIDAC_WaveEncode(badSamples, 3u, test_data, sizeof(test_data)));
+    TEST_CHECK(0u == Cy_CSDIDAC_WaveEncode(NULL, 3u, test_data, sizeof(test_data)));
+    TEST_CHECK(0u == Cy_CSDIDAC_WaveEncode(badSamples, 0u, test_data, sizeof(test_data)));
+
+    /* The invalid waveforms */
+    for (i = 0u; i < (sizeof(badSize) / sizeof(badSize[0u])); i++)
+    {
+        waveConfig.ch = CY_CSDIDAC_A;
+        waveConfig.ptrData = badData[i];
+        waveConfig.size = badSize[i];
+        waveConfig.loop = false;
+        TEST_CHECK(0u == Cy_CSDIDAC_WaveDecode(badData[i], badSize[i], NULL, 0u));
+        TEST_CHECK(CY_CSDIDAC_BAD_PARAM == Cy_CSDIDAC_WaveInit(&waveConfig, &wave, &test_context));
+    }
+
+    return (TEST_RESULT("test_wave"));
+}
+
+
+/* [] END OF FILE */